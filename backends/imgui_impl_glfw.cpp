@@ -20,6 +20,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: Inputs: Gamepad connection is tracked with glfwSetJoystickCallback() (GLFW 3.2+) and nothing is polled while no gamepad is connected. Only gamepad buttons/axes which changed since the last frame are submitted, analog values go through a small deadband.
 //  2023-07-18: Inputs: Revert ignoring mouse data on GLFW_CURSOR_DISABLED as it can be used differently. User may set ImGuiConfigFLags_NoMouse if desired. (#5625, #6609)
 //  2023-06-12: Accept glfwGetTime() not returning a monotonically increasing value. This seems to happens on some Windows setup when peripherals disconnect, and is likely to also happen on browser + Emscripten. (#6491)
 //  2023-04-04: Inputs: Added support for io.AddMouseSourceEvent() to discriminate ImGuiMouseSource_Mouse/ImGuiMouseSource_TouchScreen/ImGuiMouseSource_Pen on Windows ONLY, using a custom WndProc hook. (#2702)
@@ -106,6 +107,7 @@
 #define GLFW_HAS_GAMEPAD_API            (GLFW_VERSION_COMBINED >= 3300) // 3.3+ glfwGetGamepadState() new api
 #define GLFW_HAS_GETKEYNAME             (GLFW_VERSION_COMBINED >= 3200) // 3.2+ glfwGetKeyName()
 #define GLFW_HAS_GETERROR               (GLFW_VERSION_COMBINED >= 3300) // 3.3+ glfwGetError()
+#define GLFW_HAS_JOYSTICK_CALLBACK      (GLFW_VERSION_COMBINED >= 3200) // 3.2+ glfwSetJoystickCallback()
 
 // GLFW data
 enum GlfwClientApi
@@ -126,6 +128,13 @@ struct ImGui_ImplGlfw_Data
     bool                    InstalledCallbacks;
     bool                    CallbacksChainForAllWindows;
 
+    // Gamepad: connection state is only refreshed on joystick events, key state is what we last submitted to Dear ImGui.
+    bool                    WantUpdateGamepad;
+    bool                    WantResyncGamepadKeys;
+    bool                    GamepadConnected;
+    bool                    GamepadKeyDown[ImGuiKey_GamepadRStickDown - ImGuiKey_GamepadStart + 1];
+    float                   GamepadKeyValue[ImGuiKey_GamepadRStickDown - ImGuiKey_GamepadStart + 1];
+
     // Chain GLFW callbacks: our callbacks will call the user's previously installed callbacks, if any.
     GLFWwindowfocusfun      PrevUserCallbackWindowFocus;
     GLFWcursorposfun        PrevUserCallbackCursorPos;
@@ -135,6 +144,9 @@ struct ImGui_ImplGlfw_Data
     GLFWkeyfun              PrevUserCallbackKey;
     GLFWcharfun             PrevUserCallbackChar;
     GLFWmonitorfun          PrevUserCallbackMonitor;
+#if GLFW_HAS_JOYSTICK_CALLBACK
+    GLFWjoystickfun         PrevUserCallbackJoystick;
+#endif
 #ifdef _WIN32
     WNDPROC                 GlfwWndProc;
 #endif
@@ -383,6 +395,7 @@ void ImGui_ImplGlfw_WindowFocusCallback(GLFWwindow* window, int focused)
 
     ImGuiIO& io = ImGui::GetIO();
     io.AddFocusEvent(focused != 0);
+    bd->WantResyncGamepadKeys = true; // Losing focus clears all keys on Dear ImGui side
 }
 
 void ImGui_ImplGlfw_CursorPosCallback(GLFWwindow* window, double x, double y)
@@ -433,6 +446,19 @@ void ImGui_ImplGlfw_MonitorCallback(GLFWmonitor*, int)
 	// Unused in 'master' branch but 'docking' branch will use this, so we declare it ahead of it so if you have to install callbacks you can install this one too.
 }
 
+void ImGui_ImplGlfw_JoystickCallback(int jid, int event)
+{
+    ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
+#if GLFW_HAS_JOYSTICK_CALLBACK
+    if (bd->PrevUserCallbackJoystick != nullptr)
+        bd->PrevUserCallbackJoystick(jid, event);
+#else
+    IM_UNUSED(event);
+#endif
+    if (jid == GLFW_JOYSTICK_1)
+        bd->WantUpdateGamepad = true;
+}
+
 #ifdef __EMSCRIPTEN__
 static EM_BOOL ImGui_ImplEmscripten_WheelCallback(int, const EmscriptenWheelEvent* ev, void*)
 {
@@ -494,6 +520,9 @@ void ImGui_ImplGlfw_InstallCallbacks(GLFWwindow* window)
     bd->PrevUserCallbackKey = glfwSetKeyCallback(window, ImGui_ImplGlfw_KeyCallback);
     bd->PrevUserCallbackChar = glfwSetCharCallback(window, ImGui_ImplGlfw_CharCallback);
     bd->PrevUserCallbackMonitor = glfwSetMonitorCallback(ImGui_ImplGlfw_MonitorCallback);
+#if GLFW_HAS_JOYSTICK_CALLBACK
+    bd->PrevUserCallbackJoystick = glfwSetJoystickCallback(ImGui_ImplGlfw_JoystickCallback);
+#endif
     bd->InstalledCallbacks = true;
 }
 
@@ -511,6 +540,9 @@ void ImGui_ImplGlfw_RestoreCallbacks(GLFWwindow* window)
     glfwSetKeyCallback(window, bd->PrevUserCallbackKey);
     glfwSetCharCallback(window, bd->PrevUserCallbackChar);
     glfwSetMonitorCallback(bd->PrevUserCallbackMonitor);
+#if GLFW_HAS_JOYSTICK_CALLBACK
+    glfwSetJoystickCallback(bd->PrevUserCallbackJoystick);
+#endif
     bd->InstalledCallbacks = false;
     bd->PrevUserCallbackWindowFocus = nullptr;
     bd->PrevUserCallbackCursorEnter = nullptr;
@@ -520,6 +552,9 @@ void ImGui_ImplGlfw_RestoreCallbacks(GLFWwindow* window)
     bd->PrevUserCallbackKey = nullptr;
     bd->PrevUserCallbackChar = nullptr;
     bd->PrevUserCallbackMonitor = nullptr;
+#if GLFW_HAS_JOYSTICK_CALLBACK
+    bd->PrevUserCallbackJoystick = nullptr;
+#endif
 }
 
 // Set to 'true' to enable chaining installed callbacks for all windows (including secondary viewports created by backends or by user.
@@ -547,6 +582,7 @@ static bool ImGui_ImplGlfw_Init(GLFWwindow* window, bool install_callbacks, Glfw
 
     bd->Window = window;
     bd->Time = 0.0;
+    bd->WantUpdateGamepad = true;
 
     io.SetClipboardTextFn = ImGui_ImplGlfw_SetClipboardText;
     io.GetClipboardTextFn = ImGui_ImplGlfw_GetClipboardText;
@@ -713,27 +749,88 @@ static void ImGui_ImplGlfw_UpdateMouseCursor()
 
 // Update gamepad inputs
 static inline float Saturate(float v) { return v < 0.0f ? 0.0f : v  > 1.0f ? 1.0f : v; }
+
+// Submit a gamepad key only when it changed since the last submitted value.
+// Small analog variations (sensor noise on a held stick or trigger) are ignored, but reaching 0.0f or 1.0f is always submitted.
+static void ImGui_ImplGlfw_UpdateGamepadKey(ImGui_ImplGlfw_Data* bd, ImGuiKey key, bool down, float value)
+{
+    const float analog_deadband = 1.0f / 64.0f;
+    const int n = key - ImGuiKey_GamepadStart;
+    if (!bd->WantResyncGamepadKeys && bd->GamepadKeyDown[n] == down)
+    {
+        const float delta = value - bd->GamepadKeyValue[n];
+        if (delta == 0.0f || (value > 0.0f && value < 1.0f && delta < analog_deadband && delta > -analog_deadband))
+            return;
+    }
+    bd->GamepadKeyDown[n] = down;
+    bd->GamepadKeyValue[n] = value;
+    ImGui::GetIO().AddKeyAnalogEvent(key, down, value);
+}
+
+static void ImGui_ImplGlfw_ReleaseGamepadKeys(ImGui_ImplGlfw_Data* bd)
+{
+    for (int key = ImGuiKey_GamepadStart; key <= ImGuiKey_GamepadRStickDown; key++)
+        if (bd->WantResyncGamepadKeys || bd->GamepadKeyDown[key - ImGuiKey_GamepadStart] || bd->GamepadKeyValue[key - ImGuiKey_GamepadStart] != 0.0f)
+        {
+            bd->GamepadKeyDown[key - ImGuiKey_GamepadStart] = false;
+            bd->GamepadKeyValue[key - ImGuiKey_GamepadStart] = 0.0f;
+            ImGui::GetIO().AddKeyAnalogEvent((ImGuiKey)key, false, 0.0f);
+        }
+    bd->WantResyncGamepadKeys = false;
+}
+
 static void ImGui_ImplGlfw_UpdateGamepads()
 {
     ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
     if ((io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad) == 0) // FIXME: Technically feeding gamepad shouldn't depend on this now that they are regular inputs.
+    {
+        bd->WantResyncGamepadKeys = true;
         return;
+    }
+
+    // Query connection state only when GLFW reported a joystick event.
+    // Without our callbacks installed we don't get those events (unless the user forwards ImGui_ImplGlfw_JoystickCallback), so check every frame.
+#if GLFW_HAS_JOYSTICK_CALLBACK
+    if (bd->WantUpdateGamepad || !bd->InstalledCallbacks)
+#endif
+    {
+#if GLFW_HAS_GAMEPAD_API && !defined(__EMSCRIPTEN__)
+        bd->GamepadConnected = glfwJoystickIsGamepad(GLFW_JOYSTICK_1) != 0;
+#else
+        bd->GamepadConnected = glfwJoystickPresent(GLFW_JOYSTICK_1) != 0;
+#endif
+        bd->WantUpdateGamepad = false;
+    }
 
+    // Nothing connected: don't poll, and release whatever was held when the gamepad got disconnected.
     io.BackendFlags &= ~ImGuiBackendFlags_HasGamepad;
+    if (!bd->GamepadConnected)
+    {
+        ImGui_ImplGlfw_ReleaseGamepadKeys(bd);
+        return;
+    }
+
 #if GLFW_HAS_GAMEPAD_API && !defined(__EMSCRIPTEN__)
     GLFWgamepadstate gamepad;
     if (!glfwGetGamepadState(GLFW_JOYSTICK_1, &gamepad))
+    {
+        ImGui_ImplGlfw_ReleaseGamepadKeys(bd);
         return;
-    #define MAP_BUTTON(KEY_NO, BUTTON_NO, _UNUSED)          do { io.AddKeyEvent(KEY_NO, gamepad.buttons[BUTTON_NO] != 0); } while (0)
-    #define MAP_ANALOG(KEY_NO, AXIS_NO, _UNUSED, V0, V1)    do { float v = gamepad.axes[AXIS_NO]; v = (v - V0) / (V1 - V0); io.AddKeyAnalogEvent(KEY_NO, v > 0.10f, Saturate(v)); } while (0)
+    }
+    #define MAP_BUTTON(KEY_NO, BUTTON_NO, _UNUSED)          do { bool down = gamepad.buttons[BUTTON_NO] != 0; ImGui_ImplGlfw_UpdateGamepadKey(bd, KEY_NO, down, down ? 1.0f : 0.0f); } while (0)
+    #define MAP_ANALOG(KEY_NO, AXIS_NO, _UNUSED, V0, V1)    do { float v = gamepad.axes[AXIS_NO]; v = (v - V0) / (V1 - V0); ImGui_ImplGlfw_UpdateGamepadKey(bd, KEY_NO, v > 0.10f, Saturate(v)); } while (0)
 #else
     int axes_count = 0, buttons_count = 0;
     const float* axes = glfwGetJoystickAxes(GLFW_JOYSTICK_1, &axes_count);
     const unsigned char* buttons = glfwGetJoystickButtons(GLFW_JOYSTICK_1, &buttons_count);
     if (axes_count == 0 || buttons_count == 0)
+    {
+        ImGui_ImplGlfw_ReleaseGamepadKeys(bd);
         return;
-    #define MAP_BUTTON(KEY_NO, _UNUSED, BUTTON_NO)          do { io.AddKeyEvent(KEY_NO, (buttons_count > BUTTON_NO && buttons[BUTTON_NO] == GLFW_PRESS)); } while (0)
-    #define MAP_ANALOG(KEY_NO, _UNUSED, AXIS_NO, V0, V1)    do { float v = (axes_count > AXIS_NO) ? axes[AXIS_NO] : V0; v = (v - V0) / (V1 - V0); io.AddKeyAnalogEvent(KEY_NO, v > 0.10f, Saturate(v)); } while (0)
+    }
+    #define MAP_BUTTON(KEY_NO, _UNUSED, BUTTON_NO)          do { bool down = (buttons_count > BUTTON_NO && buttons[BUTTON_NO] == GLFW_PRESS); ImGui_ImplGlfw_UpdateGamepadKey(bd, KEY_NO, down, down ? 1.0f : 0.0f); } while (0)
+    #define MAP_ANALOG(KEY_NO, _UNUSED, AXIS_NO, V0, V1)    do { float v = (axes_count > AXIS_NO) ? axes[AXIS_NO] : V0; v = (v - V0) / (V1 - V0); ImGui_ImplGlfw_UpdateGamepadKey(bd, KEY_NO, v > 0.10f, Saturate(v)); } while (0)
 #endif
     io.BackendFlags |= ImGuiBackendFlags_HasGamepad;
     MAP_BUTTON(ImGuiKey_GamepadStart,       GLFW_GAMEPAD_BUTTON_START,          7);
@@ -762,6 +859,7 @@ static void ImGui_ImplGlfw_UpdateGamepads()
     MAP_ANALOG(ImGuiKey_GamepadRStickDown,  GLFW_GAMEPAD_AXIS_RIGHT_Y,          3,      +0.25f,  +1.0f);
     #undef MAP_BUTTON
     #undef MAP_ANALOG
+    bd->WantResyncGamepadKeys = false;
 }
 
 void ImGui_ImplGlfw_NewFrame()
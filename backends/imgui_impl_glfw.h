@@ -49,5 +49,6 @@ IMGUI_IMPL_API void     ImGui_ImplGlfw_ScrollCallback(GLFWwindow* window, double
 IMGUI_IMPL_API void     ImGui_ImplGlfw_KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
 IMGUI_IMPL_API void     ImGui_ImplGlfw_CharCallback(GLFWwindow* window, unsigned int c);
 IMGUI_IMPL_API void     ImGui_ImplGlfw_MonitorCallback(GLFWmonitor* monitor, int event);
+IMGUI_IMPL_API void     ImGui_ImplGlfw_JoystickCallback(int jid, int event);                       // Gamepad connection changes (when callbacks are not installed by the backend, the connection state is also queried every frame)
 
 #endif // #ifndef IMGUI_DISABLE
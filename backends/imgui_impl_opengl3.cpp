@@ -22,6 +22,9 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: OpenGL: Added ImGui_ImplOpenGL3_SetExclusiveContext(): when the application owns the GL context, skip the per-frame backup/restore of GL state and only issue state changes which differ from a shadow copy.
+//  2026-10-19: OpenGL: On GL 4.4+, batch consecutive draw commands sharing a texture into glMultiDrawElementsIndirect() calls, clipping in the fragment shader instead of with glScissor().
+//  2026-10-19: OpenGL: On GL 4.4+ or with GL_ARB_buffer_storage, upload the whole frame into a persistently mapped ring of 3 regions guarded by fences, instead of calling glBufferData() for each draw list.
 //  2023-06-20: OpenGL: Fixed erroneous use glGetIntegerv(GL_CONTEXT_PROFILE_MASK) on contexts lower than 3.2. (#6539, #6333)
 //  2023-05-09: OpenGL: Support for glBindSampler() backup/restore on ES3. (#6375)
 //  2023-04-18: OpenGL: Restore front and back polygon mode separately when supported by context. (#6333)
@@ -198,6 +201,16 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_EXTENSIONS
 #endif
 
+// Desktop GL 4.4+ has glBufferStorage() (also available through GL_ARB_buffer_storage), used for our persistently mapped upload ring.
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(IMGUI_IMPL_OPENGL_ES3) && defined(IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET) && (defined(GL_VERSION_4_4) || defined(GL_ARB_buffer_storage))
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+#endif
+
+// Desktop GL 4.3+ has glMultiDrawElementsIndirect(). We only use it along with the persistently mapped ring, which also holds the indirect commands.
+#if defined(IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE) && defined(GL_VERSION_4_3)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_MULTI_DRAW_INDIRECT
+#endif
+
 // [Debugging]
 //#define IMGUI_IMPL_OPENGL_DEBUG
 #ifdef IMGUI_IMPL_OPENGL_DEBUG
@@ -207,6 +220,58 @@
 #define GL_CALL(_CALL)      _CALL   // Call without error check
 #endif
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+// Vertex/index buffers persistently mapped for writing, split into IMGUI_IMPL_OPENGL_RING_FRAMES regions.
+// Each frame copies all its draw lists into the next region, after waiting on the fence of the frame which last used it.
+#define IMGUI_IMPL_OPENGL_RING_FRAMES   3
+
+// Layout mandated by glMultiDrawElementsIndirect()
+struct ImGui_ImplOpenGL3_DrawElementsIndirectCommand
+{
+    GLuint          Count;
+    GLuint          InstanceCount;
+    GLuint          FirstIndex;
+    GLint           BaseVertex;
+    GLuint          BaseInstance;            // We use it to fetch the clip rectangle of the draw (instanced vertex attribute)
+};
+
+struct ImGui_ImplOpenGL3_Ring
+{
+    GLuint          VboHandle, ElementsHandle;
+    GLuint          IndirectHandle, ClipRectsHandle;    // Only when using multi-draw-indirect
+    ImDrawVert*     VtxMapped;
+    ImDrawIdx*      IdxMapped;
+    ImGui_ImplOpenGL3_DrawElementsIndirectCommand* IndirectMapped;
+    ImVec4*         ClipRectsMapped;         // Framebuffer space (x0, y0, x1, y1), as glScissor() would use them
+    int             VtxCapacity;             // Per region, in vertices
+    int             IdxCapacity;             // Per region, in indices
+    int             CmdCapacity;             // Per region, in draw commands
+    int             FrameIndex;              // Region to write next
+    GLsync          Fences[IMGUI_IMPL_OPENGL_RING_FRAMES];
+};
+
+// Fixed attribute locations of the multi-draw-indirect shader program
+enum { ImGui_ImplOpenGL3_MdiLocationPos, ImGui_ImplOpenGL3_MdiLocationUV, ImGui_ImplOpenGL3_MdiLocationColor, ImGui_ImplOpenGL3_MdiLocationClipRect };
+#endif
+
+// Shadow of the GL state set by the backend, only used with ImGui_ImplOpenGL3_SetExclusiveContext(true).
+// Handles set to (GLuint)-1 and rectangles with a width of -1 are unknown and will be set again on next use.
+struct ImGui_ImplOpenGL3_StateCache
+{
+    bool            Valid;                   // Fixed render state (blending, depth/stencil/cull tests, polygon mode, sampler...) is set up
+    bool            ClipOriginLowerLeft;
+    GLuint          VertexArrayObject;       // Persistent VAO (otherwise we create one every frame)
+    GLuint          BoundVertexArray;
+    GLuint          Program;
+    GLuint          Texture;
+    GLuint          ArrayBuffer;
+    GLuint          AttribsVbo;              // Vertex buffer our vertex attributes were last set up with
+    bool            AttribsMdi;
+    GLint           Viewport[4];
+    GLint           Scissor[4];
+    float           ProjMtx[4][4];
+};
+
 // OpenGL Data
 struct ImGui_ImplOpenGL3_Data
 {
@@ -228,6 +293,16 @@ struct ImGui_ImplOpenGL3_Data
     GLsizeiptr      IndexBufferSize;
     bool            HasClipOrigin;
     bool            UseBufferSubData;
+    bool            UseBufferStorage;        // Upload through Ring (GL 4.4 or GL_ARB_buffer_storage). Cleared if creating the ring fails.
+    bool            UseMultiDrawIndirect;    // Batch draws with glMultiDrawElementsIndirect() (GL 4.3 + UseBufferStorage). Cleared if the shader fails to build.
+    GLuint          ShaderHandleMdi;         // Program used with UseMultiDrawIndirect, clipping in the fragment shader
+    GLint           AttribLocationTexMdi;
+    GLint           AttribLocationProjMtxMdi;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    ImGui_ImplOpenGL3_Ring Ring;
+#endif
+    bool            ExclusiveContext;        // Set with ImGui_ImplOpenGL3_SetExclusiveContext(): no backup/restore, state changes filtered through StateCache
+    ImGui_ImplOpenGL3_StateCache StateCache;
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
@@ -263,6 +338,178 @@ struct ImGui_ImplOpenGL3_VtxAttribState
 };
 #endif
 
+// Backup of the GL state we modify, restored at the end of ImGui_ImplOpenGL3_RenderDrawData()
+struct ImGui_ImplOpenGL3_RenderStateBackup
+{
+    GLenum      ActiveTexture;
+    GLuint      Program;
+    GLuint      Texture;
+    GLuint      Sampler;
+    GLuint      ArrayBuffer;
+    GLuint      DrawIndirectBuffer;
+    bool        HasDrawIndirectBuffer;
+#ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+    GLint       ElementArrayBuffer;
+    ImGui_ImplOpenGL3_VtxAttribState VtxAttribStatePos, VtxAttribStateUV, VtxAttribStateColor;
+#endif
+    GLuint      VertexArrayObject;
+    GLint       PolygonMode[2];
+    GLint       Viewport[4];
+    GLint       ScissorBox[4];
+    GLenum      BlendSrcRgb, BlendDstRgb, BlendSrcAlpha, BlendDstAlpha;
+    GLenum      BlendEquationRgb, BlendEquationAlpha;
+    GLboolean   EnableBlend, EnableCullFace, EnableDepthTest, EnableStencilTest, EnableScissorTest, EnablePrimitiveRestart;
+
+    void Backup(ImGui_ImplOpenGL3_Data* bd)
+    {
+        glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&ActiveTexture);
+        glActiveTexture(GL_TEXTURE0);
+        glGetIntegerv(GL_CURRENT_PROGRAM, (GLint*)&Program);
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, (GLint*)&Texture);
+        Sampler = 0;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
+        if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
+            glGetIntegerv(GL_SAMPLER_BINDING, (GLint*)&Sampler);
+#endif
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, (GLint*)&ArrayBuffer);
+        DrawIndirectBuffer = 0;
+        HasDrawIndirectBuffer = false;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_MULTI_DRAW_INDIRECT
+        HasDrawIndirectBuffer = bd->UseMultiDrawIndirect;
+        if (HasDrawIndirectBuffer)
+            glGetIntegerv(GL_DRAW_INDIRECT_BUFFER_BINDING, (GLint*)&DrawIndirectBuffer);
+#endif
+#ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+        // This is part of VAO on OpenGL 3.0+ and OpenGL ES 3.0+.
+        glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &ElementArrayBuffer);
+        VtxAttribStatePos.GetState(bd->AttribLocationVtxPos);
+        VtxAttribStateUV.GetState(bd->AttribLocationVtxUV);
+        VtxAttribStateColor.GetState(bd->AttribLocationVtxColor);
+#endif
+        VertexArrayObject = 0;
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, (GLint*)&VertexArrayObject);
+#endif
+#ifdef IMGUI_IMPL_HAS_POLYGON_MODE
+        glGetIntegerv(GL_POLYGON_MODE, PolygonMode);
+#endif
+        glGetIntegerv(GL_VIEWPORT, Viewport);
+        glGetIntegerv(GL_SCISSOR_BOX, ScissorBox);
+        glGetIntegerv(GL_BLEND_SRC_RGB, (GLint*)&BlendSrcRgb);
+        glGetIntegerv(GL_BLEND_DST_RGB, (GLint*)&BlendDstRgb);
+        glGetIntegerv(GL_BLEND_SRC_ALPHA, (GLint*)&BlendSrcAlpha);
+        glGetIntegerv(GL_BLEND_DST_ALPHA, (GLint*)&BlendDstAlpha);
+        glGetIntegerv(GL_BLEND_EQUATION_RGB, (GLint*)&BlendEquationRgb);
+        glGetIntegerv(GL_BLEND_EQUATION_ALPHA, (GLint*)&BlendEquationAlpha);
+        EnableBlend = glIsEnabled(GL_BLEND);
+        EnableCullFace = glIsEnabled(GL_CULL_FACE);
+        EnableDepthTest = glIsEnabled(GL_DEPTH_TEST);
+        EnableStencilTest = glIsEnabled(GL_STENCIL_TEST);
+        EnableScissorTest = glIsEnabled(GL_SCISSOR_TEST);
+        EnablePrimitiveRestart = GL_FALSE;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
+        if (bd->GlVersion >= 310)
+            EnablePrimitiveRestart = glIsEnabled(GL_PRIMITIVE_RESTART);
+#endif
+    }
+
+    void Restore(ImGui_ImplOpenGL3_Data* bd)
+    {
+        // This "glIsProgram()" check is required because if the program is "pending deletion" at the time of binding backup, it will have been deleted by now and will cause an OpenGL error. See #6220.
+        if (Program == 0 || glIsProgram(Program)) glUseProgram(Program);
+        glBindTexture(GL_TEXTURE_2D, Texture);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
+        if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
+            glBindSampler(0, Sampler);
+#endif
+        glActiveTexture(ActiveTexture);
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+        glBindVertexArray(VertexArrayObject);
+#endif
+        glBindBuffer(GL_ARRAY_BUFFER, ArrayBuffer);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_MULTI_DRAW_INDIRECT
+        if (HasDrawIndirectBuffer)
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, DrawIndirectBuffer);
+#endif
+#ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ElementArrayBuffer);
+        VtxAttribStatePos.SetState(bd->AttribLocationVtxPos);
+        VtxAttribStateUV.SetState(bd->AttribLocationVtxUV);
+        VtxAttribStateColor.SetState(bd->AttribLocationVtxColor);
+#endif
+        glBlendEquationSeparate(BlendEquationRgb, BlendEquationAlpha);
+        glBlendFuncSeparate(BlendSrcRgb, BlendDstRgb, BlendSrcAlpha, BlendDstAlpha);
+        if (EnableBlend) glEnable(GL_BLEND); else glDisable(GL_BLEND);
+        if (EnableCullFace) glEnable(GL_CULL_FACE); else glDisable(GL_CULL_FACE);
+        if (EnableDepthTest) glEnable(GL_DEPTH_TEST); else glDisable(GL_DEPTH_TEST);
+        if (EnableStencilTest) glEnable(GL_STENCIL_TEST); else glDisable(GL_STENCIL_TEST);
+        if (EnableScissorTest) glEnable(GL_SCISSOR_TEST); else glDisable(GL_SCISSOR_TEST);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
+        if (bd->GlVersion >= 310) { if (EnablePrimitiveRestart) glEnable(GL_PRIMITIVE_RESTART); else glDisable(GL_PRIMITIVE_RESTART); }
+#endif
+
+#ifdef IMGUI_IMPL_HAS_POLYGON_MODE
+        // Desktop OpenGL 3.0 and OpenGL 3.1 had separate polygon draw modes for front-facing and back-facing faces of polygons
+        if (bd->GlVersion <= 310 || bd->GlProfileIsCompat)
+        {
+            glPolygonMode(GL_FRONT, (GLenum)PolygonMode[0]);
+            glPolygonMode(GL_BACK, (GLenum)PolygonMode[1]);
+        }
+        else
+        {
+            glPolygonMode(GL_FRONT_AND_BACK, (GLenum)PolygonMode[0]);
+        }
+#endif // IMGUI_IMPL_HAS_POLYGON_MODE
+
+        glViewport(Viewport[0], Viewport[1], (GLsizei)Viewport[2], (GLsizei)Viewport[3]);
+        glScissor(ScissorBox[0], ScissorBox[1], (GLsizei)ScissorBox[2], (GLsizei)ScissorBox[3]);
+    }
+};
+
+// Exclusive context: forget everything we know about the current GL state, it will all be set again on next use.
+static void ImGui_ImplOpenGL3_ResetStateCache(ImGui_ImplOpenGL3_Data* bd)
+{
+    ImGui_ImplOpenGL3_StateCache* sc = &bd->StateCache;
+    sc->Valid = false;
+    sc->BoundVertexArray = sc->Program = sc->Texture = sc->ArrayBuffer = sc->AttribsVbo = (GLuint)-1;
+    sc->Viewport[2] = sc->Scissor[2] = -1;
+}
+
+// State setters used on the render path, which skip redundant calls when the context is exclusive.
+static void ImGui_ImplOpenGL3_BindTexture(ImGui_ImplOpenGL3_Data* bd, GLuint texture)
+{
+    if (bd->ExclusiveContext)
+    {
+        if (bd->StateCache.Texture == texture)
+            return;
+        bd->StateCache.Texture = texture;
+    }
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, texture));
+}
+
+static void ImGui_ImplOpenGL3_BindArrayBuffer(ImGui_ImplOpenGL3_Data* bd, GLuint buffer)
+{
+    if (bd->ExclusiveContext)
+    {
+        if (bd->StateCache.ArrayBuffer == buffer)
+            return;
+        bd->StateCache.ArrayBuffer = buffer;
+    }
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+}
+
+static void ImGui_ImplOpenGL3_SetScissor(ImGui_ImplOpenGL3_Data* bd, GLint x, GLint y, GLint w, GLint h)
+{
+    if (bd->ExclusiveContext)
+    {
+        GLint* cur = bd->StateCache.Scissor;
+        if (cur[0] == x && cur[1] == y && cur[2] == w && cur[3] == h)
+            return;
+        cur[0] = x; cur[1] = y; cur[2] = w; cur[3] = h;
+    }
+    GL_CALL(glScissor(x, y, (GLsizei)w, (GLsizei)h));
+}
+
 // Functions
 bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
 {
@@ -356,6 +603,7 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
 
     // Detect extensions we support
     bd->HasClipOrigin = (bd->GlVersion >= 450);
+    bool has_buffer_storage = (bd->GlVersion >= 440);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_EXTENSIONS
     GLint num_extensions = 0;
     glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
@@ -364,8 +612,17 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
         const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
         if (extension != nullptr && strcmp(extension, "GL_ARB_clip_control") == 0)
             bd->HasClipOrigin = true;
+        if (extension != nullptr && strcmp(extension, "GL_ARB_buffer_storage") == 0)
+            has_buffer_storage = true;
     }
 #endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    bd->UseBufferStorage = has_buffer_storage && bd->GlVersion >= 320; // Also needs glDrawElementsBaseVertex()
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_MULTI_DRAW_INDIRECT
+    bd->UseMultiDrawIndirect = bd->UseBufferStorage && bd->GlVersion >= 430;
+#endif
+    (void)has_buffer_storage;
 
     return true;
 }
@@ -383,6 +640,26 @@ void    ImGui_ImplOpenGL3_Shutdown()
     IM_DELETE(bd);
 }
 
+// Declare that the application owns the GL context and doesn't change GL state behind our back.
+// We then skip the backup/restore of GL state in ImGui_ImplOpenGL3_RenderDrawData(), keep our VAO alive,
+// and only issue state changes which differ from what we last set. Call ImGui_ImplOpenGL3_InvalidateStateCache()
+// after changing GL state yourself (e.g. rendering your scene with the same context).
+// Our state is left as is after rendering: e.g. GL_SCISSOR_TEST stays enabled, which also clips glClear().
+void    ImGui_ImplOpenGL3_SetExclusiveContext(bool exclusive)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Did you call ImGui_ImplOpenGL3_Init()?");
+    bd->ExclusiveContext = exclusive;
+    ImGui_ImplOpenGL3_ResetStateCache(bd);
+}
+
+void    ImGui_ImplOpenGL3_InvalidateStateCache()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Did you call ImGui_ImplOpenGL3_Init()?");
+    ImGui_ImplOpenGL3_ResetStateCache(bd);
+}
+
 void    ImGui_ImplOpenGL3_NewFrame()
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
@@ -395,44 +672,59 @@ void    ImGui_ImplOpenGL3_NewFrame()
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImGui_ImplOpenGL3_StateCache* sc = &bd->StateCache;
+    const bool exclusive = bd->ExclusiveContext;
 
     // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled, polygon fill
-    glEnable(GL_BLEND);
-    glBlendEquation(GL_FUNC_ADD);
-    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
-    glDisable(GL_CULL_FACE);
-    glDisable(GL_DEPTH_TEST);
-    glDisable(GL_STENCIL_TEST);
-    glEnable(GL_SCISSOR_TEST);
+    // (With an exclusive context this only needs to be done once, nobody else is changing it)
+    if (!exclusive || !sc->Valid)
+    {
+        if (exclusive)
+            glActiveTexture(GL_TEXTURE0); // Otherwise done while backing up state
+        glEnable(GL_BLEND);
+        glBlendEquation(GL_FUNC_ADD);
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        glDisable(GL_CULL_FACE);
+        glDisable(GL_DEPTH_TEST);
+        glDisable(GL_STENCIL_TEST);
+        glEnable(GL_SCISSOR_TEST);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
-    if (bd->GlVersion >= 310)
-        glDisable(GL_PRIMITIVE_RESTART);
+        if (bd->GlVersion >= 310)
+            glDisable(GL_PRIMITIVE_RESTART);
 #endif
 #ifdef IMGUI_IMPL_HAS_POLYGON_MODE
-    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
+        if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
+            glBindSampler(0, 0); // We use combined texture/sampler state. Applications using GL 3.3 and GL ES 3.0 may set that otherwise.
 #endif
 
-    // Support for GL 4.5 rarely used glClipControl(GL_UPPER_LEFT)
+        // Support for GL 4.5 rarely used glClipControl(GL_UPPER_LEFT)
+        sc->ClipOriginLowerLeft = true;
 #if defined(GL_CLIP_ORIGIN)
-    bool clip_origin_lower_left = true;
-    if (bd->HasClipOrigin)
-    {
-        GLenum current_clip_origin = 0; glGetIntegerv(GL_CLIP_ORIGIN, (GLint*)&current_clip_origin);
-        if (current_clip_origin == GL_UPPER_LEFT)
-            clip_origin_lower_left = false;
-    }
+        if (bd->HasClipOrigin)
+        {
+            GLenum current_clip_origin = 0; glGetIntegerv(GL_CLIP_ORIGIN, (GLint*)&current_clip_origin);
+            if (current_clip_origin == GL_UPPER_LEFT)
+                sc->ClipOriginLowerLeft = false;
+        }
 #endif
+        sc->Valid = exclusive;
+    }
 
     // Setup viewport, orthographic projection matrix
     // Our visible imgui space lies from draw_data->DisplayPos (top left) to draw_data->DisplayPos+data_data->DisplaySize (bottom right). DisplayPos is (0,0) for single viewport apps.
-    GL_CALL(glViewport(0, 0, (GLsizei)fb_width, (GLsizei)fb_height));
+    if (!exclusive || sc->Viewport[0] != 0 || sc->Viewport[1] != 0 || sc->Viewport[2] != fb_width || sc->Viewport[3] != fb_height)
+    {
+        GL_CALL(glViewport(0, 0, (GLsizei)fb_width, (GLsizei)fb_height));
+        sc->Viewport[0] = sc->Viewport[1] = 0; sc->Viewport[2] = fb_width; sc->Viewport[3] = fb_height;
+    }
     float L = draw_data->DisplayPos.x;
     float R = draw_data->DisplayPos.x + draw_data->DisplaySize.x;
     float T = draw_data->DisplayPos.y;
     float B = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
-#if defined(GL_CLIP_ORIGIN)
-    if (!clip_origin_lower_left) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
-#endif
+    if (!sc->ClipOriginLowerLeft) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
     const float ortho_projection[4][4] =
     {
         { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
@@ -440,31 +732,214 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
-    glUseProgram(bd->ShaderHandle);
-    glUniform1i(bd->AttribLocationTex, 0);
-    glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
-
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
-    if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
-        glBindSampler(0, 0); // We use combined texture/sampler state. Applications using GL 3.3 and GL ES 3.0 may set that otherwise.
+    GLuint program = bd->ShaderHandle;
+    GLint location_tex = bd->AttribLocationTex;
+    GLint location_proj_mtx = bd->AttribLocationProjMtx;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_MULTI_DRAW_INDIRECT
+    if (bd->UseMultiDrawIndirect)
+    {
+        program = bd->ShaderHandleMdi;
+        location_tex = bd->AttribLocationTexMdi;
+        location_proj_mtx = bd->AttribLocationProjMtxMdi;
+    }
 #endif
+    const bool program_changed = (!exclusive || sc->Program != program);
+    if (program_changed)
+    {
+        glUseProgram(program);
+        glUniform1i(location_tex, 0);
+        sc->Program = program;
+    }
+    if (program_changed || memcmp(sc->ProjMtx, ortho_projection, sizeof(ortho_projection)) != 0)
+    {
+        glUniformMatrix4fv(location_proj_mtx, 1, GL_FALSE, &ortho_projection[0][0]);
+        memcpy(sc->ProjMtx, ortho_projection, sizeof(ortho_projection));
+    }
 
     (void)vertex_array_object;
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glBindVertexArray(vertex_array_object);
+    if (!exclusive || sc->BoundVertexArray != vertex_array_object)
+    {
+        glBindVertexArray(vertex_array_object);
+        sc->BoundVertexArray = vertex_array_object;
+    }
 #endif
 
     // Bind vertex/index buffers and setup attributes for ImDrawVert
-    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
-    GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bd->ElementsHandle));
+    // (With an exclusive context our VAO is persistent, so this only needs to be done again when the buffers changed)
+    GLuint vbo_handle = bd->VboHandle;
+    GLuint elements_handle = bd->ElementsHandle;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (bd->UseBufferStorage)
+    {
+        vbo_handle = bd->Ring.VboHandle;
+        elements_handle = bd->Ring.ElementsHandle;
+    }
+#endif
+    if (exclusive && sc->AttribsVbo == vbo_handle && sc->AttribsMdi == bd->UseMultiDrawIndirect)
+    {
+        ImGui_ImplOpenGL3_BindArrayBuffer(bd, vbo_handle); // Used by glBufferData() uploads
+        if (bd->UseMultiDrawIndirect)
+            ImGui_ImplOpenGL3_SetScissor(bd, 0, 0, fb_width, fb_height);
+        return;
+    }
+    sc->AttribsVbo = vbo_handle;
+    sc->AttribsMdi = bd->UseMultiDrawIndirect;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_MULTI_DRAW_INDIRECT
+    if (bd->UseMultiDrawIndirect)
+    {
+        // Clip rectangles are an instanced attribute indexed by each indirect command's BaseInstance.
+        // Scissor covers the whole framebuffer, clipping happens in the fragment shader.
+        GL_CALL(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, bd->Ring.IndirectHandle));
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->Ring.ClipRectsHandle));
+        GL_CALL(glEnableVertexAttribArray(ImGui_ImplOpenGL3_MdiLocationClipRect));
+        GL_CALL(glVertexAttribPointer(ImGui_ImplOpenGL3_MdiLocationClipRect, 4, GL_FLOAT, GL_FALSE, sizeof(ImVec4), (GLvoid*)0));
+        GL_CALL(glVertexAttribDivisor(ImGui_ImplOpenGL3_MdiLocationClipRect, 1));
+        GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vbo_handle));
+        GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elements_handle));
+        GL_CALL(glEnableVertexAttribArray(ImGui_ImplOpenGL3_MdiLocationPos));
+        GL_CALL(glEnableVertexAttribArray(ImGui_ImplOpenGL3_MdiLocationUV));
+        GL_CALL(glEnableVertexAttribArray(ImGui_ImplOpenGL3_MdiLocationColor));
+        GL_CALL(glVertexAttribPointer(ImGui_ImplOpenGL3_MdiLocationPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos)));
+        GL_CALL(glVertexAttribPointer(ImGui_ImplOpenGL3_MdiLocationUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv)));
+        GL_CALL(glVertexAttribPointer(ImGui_ImplOpenGL3_MdiLocationColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col)));
+        sc->ArrayBuffer = vbo_handle;
+        sc->Scissor[2] = -1;
+        ImGui_ImplOpenGL3_SetScissor(bd, 0, 0, fb_width, fb_height);
+        return;
+    }
+#endif
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vbo_handle));
+    GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elements_handle));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col)));
+    sc->ArrayBuffer = vbo_handle;
+}
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+static void ImGui_ImplOpenGL3_DestroyRing(ImGui_ImplOpenGL3_Data* bd)
+{
+    ImGui_ImplOpenGL3_Ring* ring = &bd->Ring;
+    for (GLsync& fence : ring->Fences)
+        if (fence != nullptr)
+            glDeleteSync(fence);
+    // Deleting a mapped buffer implicitly unmaps it.
+    if (ring->VboHandle)        { glDeleteBuffers(1, &ring->VboHandle); }
+    if (ring->ElementsHandle)   { glDeleteBuffers(1, &ring->ElementsHandle); }
+    if (ring->IndirectHandle)   { glDeleteBuffers(1, &ring->IndirectHandle); }
+    if (ring->ClipRectsHandle)  { glDeleteBuffers(1, &ring->ClipRectsHandle); }
+    memset((void*)ring, 0, sizeof(*ring));
+    ImGui_ImplOpenGL3_ResetStateCache(bd); // Names may be reused by the next glGenBuffers()
+}
+
+static void* ImGui_ImplOpenGL3_CreateRingBuffer(GLuint* out_handle, GLsizeiptr size)
+{
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    GL_CALL(glGenBuffers(1, out_handle));
+    GL_CALL(glBindBuffer(GL_COPY_WRITE_BUFFER, *out_handle));
+    GL_CALL(glBufferStorage(GL_COPY_WRITE_BUFFER, size, nullptr, flags));
+    return glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, flags);
+}
+
+static bool ImGui_ImplOpenGL3_CreateRing(ImGui_ImplOpenGL3_Data* bd, int vtx_capacity, int idx_capacity, int cmd_capacity)
+{
+    ImGui_ImplOpenGL3_DestroyRing(bd);
+    ImGui_ImplOpenGL3_Ring* ring = &bd->Ring;
+
+    // Use the GL_COPY_WRITE_BUFFER target so we don't disturb the element array binding of whichever VAO is currently bound.
+    GLuint last_copy_write_buffer; glGetIntegerv(GL_COPY_WRITE_BUFFER, (GLint*)&last_copy_write_buffer);
+    ring->VtxMapped = (ImDrawVert*)ImGui_ImplOpenGL3_CreateRingBuffer(&ring->VboHandle, (GLsizeiptr)vtx_capacity * IMGUI_IMPL_OPENGL_RING_FRAMES * (int)sizeof(ImDrawVert));
+    ring->IdxMapped = (ImDrawIdx*)ImGui_ImplOpenGL3_CreateRingBuffer(&ring->ElementsHandle, (GLsizeiptr)idx_capacity * IMGUI_IMPL_OPENGL_RING_FRAMES * (int)sizeof(ImDrawIdx));
+    bool ok = (ring->VtxMapped != nullptr && ring->IdxMapped != nullptr);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_MULTI_DRAW_INDIRECT
+    if (bd->UseMultiDrawIndirect)
+    {
+        ring->IndirectMapped = (ImGui_ImplOpenGL3_DrawElementsIndirectCommand*)ImGui_ImplOpenGL3_CreateRingBuffer(&ring->IndirectHandle, (GLsizeiptr)cmd_capacity * IMGUI_IMPL_OPENGL_RING_FRAMES * (int)sizeof(ImGui_ImplOpenGL3_DrawElementsIndirectCommand));
+        ring->ClipRectsMapped = (ImVec4*)ImGui_ImplOpenGL3_CreateRingBuffer(&ring->ClipRectsHandle, (GLsizeiptr)cmd_capacity * IMGUI_IMPL_OPENGL_RING_FRAMES * (int)sizeof(ImVec4));
+        ok &= (ring->IndirectMapped != nullptr && ring->ClipRectsMapped != nullptr);
+    }
+#endif
+    glBindBuffer(GL_COPY_WRITE_BUFFER, last_copy_write_buffer);
+    if (!ok)
+    {
+        ImGui_ImplOpenGL3_DestroyRing(bd);
+        return false;
+    }
+    ring->VtxCapacity = vtx_capacity;
+    ring->IdxCapacity = idx_capacity;
+    ring->CmdCapacity = cmd_capacity;
+    return true;
 }
 
+// Copy all draw lists of the frame into the next ring region.
+// Returns false if the ring couldn't be created, in which case the caller falls back to glBufferData() uploads.
+static bool ImGui_ImplOpenGL3_RingUpload(ImGui_ImplOpenGL3_Data* bd, ImDrawData* draw_data, int* out_vtx_base, int* out_idx_base)
+{
+    ImGui_ImplOpenGL3_Ring* ring = &bd->Ring;
+    int total_cmd_count = 0;
+    if (bd->UseMultiDrawIndirect)
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+            total_cmd_count += draw_data->CmdLists[n]->CmdBuffer.Size;
+    if (ring->VtxMapped == nullptr || ring->VtxCapacity < draw_data->TotalVtxCount || ring->IdxCapacity < draw_data->TotalIdxCount || ring->CmdCapacity < total_cmd_count)
+    {
+        // Grow with some slack. Buffers still in use by the GPU are only released by the driver once it is done with them.
+        int vtx_capacity = draw_data->TotalVtxCount + draw_data->TotalVtxCount / 2;
+        int idx_capacity = draw_data->TotalIdxCount + draw_data->TotalIdxCount / 2;
+        int cmd_capacity = total_cmd_count + total_cmd_count / 2;
+        if (!ImGui_ImplOpenGL3_CreateRing(bd, vtx_capacity > 5000 ? vtx_capacity : 5000, idx_capacity > 10000 ? idx_capacity : 10000, cmd_capacity > 256 ? cmd_capacity : 256))
+            return false;
+    }
+
+    // Wait until the GPU is done with the frame which last used this region (normally already signaled, 3 frames later)
+    if (GLsync fence = ring->Fences[ring->FrameIndex])
+    {
+        GLenum wait_result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        while (wait_result == GL_TIMEOUT_EXPIRED)
+            wait_result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1 ms
+        glDeleteSync(fence);
+        ring->Fences[ring->FrameIndex] = nullptr;
+    }
+
+    *out_vtx_base = ring->FrameIndex * ring->VtxCapacity;
+    *out_idx_base = ring->FrameIndex * ring->IdxCapacity;
+    ImDrawVert* vtx_dst = ring->VtxMapped + *out_vtx_base;
+    ImDrawIdx* idx_dst = ring->IdxMapped + *out_idx_base;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        memcpy(vtx_dst, cmd_list->VtxBuffer.Data, (size_t)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        memcpy(idx_dst, cmd_list->IdxBuffer.Data, (size_t)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+        vtx_dst += cmd_list->VtxBuffer.Size;
+        idx_dst += cmd_list->IdxBuffer.Size;
+    }
+    return true;
+}
+#endif
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_MULTI_DRAW_INDIRECT
+// Run of consecutive indirect commands sharing a texture, submitted with a single glMultiDrawElementsIndirect() call.
+struct ImGui_ImplOpenGL3_MultiDrawBatch
+{
+    GLuint          Texture;
+    int             CmdFirst;                // Index into the ring indirect buffer
+    int             CmdCount;
+};
+
+static void ImGui_ImplOpenGL3_FlushMultiDraw(ImGui_ImplOpenGL3_Data* bd, ImGui_ImplOpenGL3_MultiDrawBatch* batch)
+{
+    if (batch->CmdCount == 0)
+        return;
+    ImGui_ImplOpenGL3_BindTexture(bd, batch->Texture);
+    GL_CALL(glMultiDrawElementsIndirect(GL_TRIANGLES, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(batch->CmdFirst * sizeof(ImGui_ImplOpenGL3_DrawElementsIndirectCommand)), batch->CmdCount, 0));
+    batch->CmdFirst += batch->CmdCount;
+    batch->CmdCount = 0;
+}
+#endif
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
@@ -479,50 +954,45 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
 
     // Backup GL state
-    GLenum last_active_texture; glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&last_active_texture);
-    glActiveTexture(GL_TEXTURE0);
-    GLuint last_program; glGetIntegerv(GL_CURRENT_PROGRAM, (GLint*)&last_program);
-    GLuint last_texture; glGetIntegerv(GL_TEXTURE_BINDING_2D, (GLint*)&last_texture);
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
-    GLuint last_sampler; if (bd->GlVersion >= 330 || bd->GlProfileIsES3) { glGetIntegerv(GL_SAMPLER_BINDING, (GLint*)&last_sampler); } else { last_sampler = 0; }
-#endif
-    GLuint last_array_buffer; glGetIntegerv(GL_ARRAY_BUFFER_BINDING, (GLint*)&last_array_buffer);
-#ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    // This is part of VAO on OpenGL 3.0+ and OpenGL ES 3.0+.
-    GLint last_element_array_buffer; glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &last_element_array_buffer);
-    ImGui_ImplOpenGL3_VtxAttribState last_vtx_attrib_state_pos; last_vtx_attrib_state_pos.GetState(bd->AttribLocationVtxPos);
-    ImGui_ImplOpenGL3_VtxAttribState last_vtx_attrib_state_uv; last_vtx_attrib_state_uv.GetState(bd->AttribLocationVtxUV);
-    ImGui_ImplOpenGL3_VtxAttribState last_vtx_attrib_state_color; last_vtx_attrib_state_color.GetState(bd->AttribLocationVtxColor);
-#endif
-#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    GLuint last_vertex_array_object; glGetIntegerv(GL_VERTEX_ARRAY_BINDING, (GLint*)&last_vertex_array_object);
-#endif
-#ifdef IMGUI_IMPL_HAS_POLYGON_MODE
-    GLint last_polygon_mode[2]; glGetIntegerv(GL_POLYGON_MODE, last_polygon_mode);
-#endif
-    GLint last_viewport[4]; glGetIntegerv(GL_VIEWPORT, last_viewport);
-    GLint last_scissor_box[4]; glGetIntegerv(GL_SCISSOR_BOX, last_scissor_box);
-    GLenum last_blend_src_rgb; glGetIntegerv(GL_BLEND_SRC_RGB, (GLint*)&last_blend_src_rgb);
-    GLenum last_blend_dst_rgb; glGetIntegerv(GL_BLEND_DST_RGB, (GLint*)&last_blend_dst_rgb);
-    GLenum last_blend_src_alpha; glGetIntegerv(GL_BLEND_SRC_ALPHA, (GLint*)&last_blend_src_alpha);
-    GLenum last_blend_dst_alpha; glGetIntegerv(GL_BLEND_DST_ALPHA, (GLint*)&last_blend_dst_alpha);
-    GLenum last_blend_equation_rgb; glGetIntegerv(GL_BLEND_EQUATION_RGB, (GLint*)&last_blend_equation_rgb);
-    GLenum last_blend_equation_alpha; glGetIntegerv(GL_BLEND_EQUATION_ALPHA, (GLint*)&last_blend_equation_alpha);
-    GLboolean last_enable_blend = glIsEnabled(GL_BLEND);
-    GLboolean last_enable_cull_face = glIsEnabled(GL_CULL_FACE);
-    GLboolean last_enable_depth_test = glIsEnabled(GL_DEPTH_TEST);
-    GLboolean last_enable_stencil_test = glIsEnabled(GL_STENCIL_TEST);
-    GLboolean last_enable_scissor_test = glIsEnabled(GL_SCISSOR_TEST);
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
-    GLboolean last_enable_primitive_restart = (bd->GlVersion >= 310) ? glIsEnabled(GL_PRIMITIVE_RESTART) : GL_FALSE;
-#endif
+    // (Skipped when the application told us it owns the context, in which case we only change what differs from our state cache)
+    const bool exclusive = bd->ExclusiveContext;
+    ImGui_ImplOpenGL3_RenderStateBackup backup;
+    if (!exclusive)
+        backup.Backup(bd);
 
     // Setup desired GL state
     // Recreate the VAO every time (this is to easily allow multiple GL contexts to be rendered to. VAO are not shared among GL contexts)
     // The renderer would actually work without any VAO bound, but then our VertexAttrib calls would overwrite the default one currently bound.
+    // With an exclusive context, we keep a single VAO around instead.
     GLuint vertex_array_object = 0;
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    GL_CALL(glGenVertexArrays(1, &vertex_array_object));
+    if (exclusive)
+    {
+        if (bd->StateCache.VertexArrayObject == 0)
+            GL_CALL(glGenVertexArrays(1, &bd->StateCache.VertexArrayObject));
+        vertex_array_object = bd->StateCache.VertexArrayObject;
+    }
+    else
+    {
+        GL_CALL(glGenVertexArrays(1, &vertex_array_object));
+    }
+#endif
+
+    // Upload the whole frame at once when we have a persistently mapped ring (before binding buffers, as it may recreate them)
+    bool use_ring = false;
+    int ring_vtx_base = 0;
+    int ring_idx_base = 0;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (bd->UseBufferStorage)
+    {
+        use_ring = ImGui_ImplOpenGL3_RingUpload(bd, draw_data, &ring_vtx_base, &ring_idx_base);
+        bd->UseBufferStorage = use_ring;
+        bd->UseMultiDrawIndirect &= use_ring;
+    }
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_MULTI_DRAW_INDIRECT
+    const bool use_mdi = bd->UseMultiDrawIndirect;
+    ImGui_ImplOpenGL3_MultiDrawBatch mdi_batch = { 0, use_mdi ? bd->Ring.FrameIndex * bd->Ring.CmdCapacity : 0, 0 };
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
 
@@ -531,6 +1001,9 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
     // Render command lists
+    // (Because we merged all buffers into a single one when using the ring, we maintain our own offset into them)
+    int global_vtx_offset = ring_vtx_base;
+    int global_idx_offset = ring_idx_base;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
@@ -543,9 +1016,14 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         // - We are now back to using exclusively glBufferData(). So bd->UseBufferSubData IS ALWAYS FALSE in this code.
         //   We are keeping the old code path for a while in case people finding new issues may want to test the bd->UseBufferSubData path.
         // - See https://github.com/ocornut/imgui/issues/4468 and please report any corruption issues.
+        // - On GL 4.4 / GL_ARB_buffer_storage we use a persistently mapped ring instead, see ImGui_ImplOpenGL3_RingUpload().
         const GLsizeiptr vtx_buffer_size = (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
         const GLsizeiptr idx_buffer_size = (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
-        if (bd->UseBufferSubData)
+        if (use_ring)
+        {
+            // Already copied for the whole frame
+        }
+        else if (bd->UseBufferSubData)
         {
             if (bd->VertexBufferSize < vtx_buffer_size)
             {
@@ -573,10 +1051,23 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
             {
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_MULTI_DRAW_INDIRECT
+                if (use_mdi)
+                    ImGui_ImplOpenGL3_FlushMultiDraw(bd, &mdi_batch); // Keep ordering with what the callback draws
+#endif
+                if (exclusive)
+                    ImGui_ImplOpenGL3_ResetStateCache(bd); // The callback may change any state
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
                 else
+                {
                     pcmd->UserCallback(cmd_list, pcmd);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_MULTI_DRAW_INDIRECT
+                    // Batched draws rely on state only set by ImGui_ImplOpenGL3_SetupRenderState() (program, VAO and attributes, indirect buffer, full scissor)
+                    if (use_mdi)
+                        ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+#endif
+                }
             }
             else
             {
@@ -586,71 +1077,71 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
                     continue;
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_MULTI_DRAW_INDIRECT
+                if (use_mdi)
+                {
+                    // Queue the draw, start a new batch when the texture changes.
+                    // The clip rectangle is the exact integer rectangle glScissor() would have used, tested against gl_FragCoord.
+                    GLuint texture = (GLuint)(intptr_t)pcmd->GetTexID();
+                    if (mdi_batch.CmdCount > 0 && mdi_batch.Texture != texture)
+                        ImGui_ImplOpenGL3_FlushMultiDraw(bd, &mdi_batch);
+                    mdi_batch.Texture = texture;
+                    const int cmd_idx = mdi_batch.CmdFirst + mdi_batch.CmdCount++;
+                    ImGui_ImplOpenGL3_DrawElementsIndirectCommand* indirect_cmd = &bd->Ring.IndirectMapped[cmd_idx];
+                    indirect_cmd->Count = pcmd->ElemCount;
+                    indirect_cmd->InstanceCount = 1;
+                    indirect_cmd->FirstIndex = pcmd->IdxOffset + global_idx_offset;
+                    indirect_cmd->BaseVertex = (GLint)(pcmd->VtxOffset + global_vtx_offset);
+                    indirect_cmd->BaseInstance = (GLuint)cmd_idx;
+                    const int scissor_x = (int)clip_min.x;
+                    const int scissor_y = (int)((float)fb_height - clip_max.y);
+                    bd->Ring.ClipRectsMapped[cmd_idx] = ImVec4((float)scissor_x, (float)scissor_y, (float)(scissor_x + (int)(clip_max.x - clip_min.x)), (float)(scissor_y + (int)(clip_max.y - clip_min.y)));
+                    continue;
+                }
+#endif
+
                 // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
-                GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
+                ImGui_ImplOpenGL3_SetScissor(bd, (int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y));
 
                 // Bind texture, Draw
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
+                ImGui_ImplOpenGL3_BindTexture(bd, (GLuint)(intptr_t)pcmd->GetTexID());
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
-                if (bd->GlVersion >= 320)
+                if (use_ring)
+                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)((pcmd->IdxOffset + global_idx_offset) * sizeof(ImDrawIdx)), (GLint)(pcmd->VtxOffset + global_vtx_offset)));
+                else if (bd->GlVersion >= 320)
                     GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
                 else
 #endif
                 GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
             }
         }
+        global_vtx_offset += cmd_list->VtxBuffer.Size;
+        global_idx_offset += cmd_list->IdxBuffer.Size;
     }
 
-    // Destroy the temporary VAO
-#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    GL_CALL(glDeleteVertexArrays(1, &vertex_array_object));
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_MULTI_DRAW_INDIRECT
+    if (use_mdi)
+        ImGui_ImplOpenGL3_FlushMultiDraw(bd, &mdi_batch);
 #endif
 
-    // Restore modified GL state
-    // This "glIsProgram()" check is required because if the program is "pending deletion" at the time of binding backup, it will have been deleted by now and will cause an OpenGL error. See #6220.
-    if (last_program == 0 || glIsProgram(last_program)) glUseProgram(last_program);
-    glBindTexture(GL_TEXTURE_2D, last_texture);
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
-    if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
-        glBindSampler(0, last_sampler);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    // Fence the region we just drew from, it will be rewritten IMGUI_IMPL_OPENGL_RING_FRAMES frames later
+    if (use_ring)
+    {
+        bd->Ring.Fences[bd->Ring.FrameIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        bd->Ring.FrameIndex = (bd->Ring.FrameIndex + 1) % IMGUI_IMPL_OPENGL_RING_FRAMES;
+    }
 #endif
-    glActiveTexture(last_active_texture);
+
+    // Destroy the temporary VAO
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glBindVertexArray(last_vertex_array_object);
+    if (!exclusive)
+        GL_CALL(glDeleteVertexArrays(1, &vertex_array_object));
 #endif
-    glBindBuffer(GL_ARRAY_BUFFER, last_array_buffer);
-#ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, last_element_array_buffer);
-    last_vtx_attrib_state_pos.SetState(bd->AttribLocationVtxPos);
-    last_vtx_attrib_state_uv.SetState(bd->AttribLocationVtxUV);
-    last_vtx_attrib_state_color.SetState(bd->AttribLocationVtxColor);
-#endif
-    glBlendEquationSeparate(last_blend_equation_rgb, last_blend_equation_alpha);
-    glBlendFuncSeparate(last_blend_src_rgb, last_blend_dst_rgb, last_blend_src_alpha, last_blend_dst_alpha);
-    if (last_enable_blend) glEnable(GL_BLEND); else glDisable(GL_BLEND);
-    if (last_enable_cull_face) glEnable(GL_CULL_FACE); else glDisable(GL_CULL_FACE);
-    if (last_enable_depth_test) glEnable(GL_DEPTH_TEST); else glDisable(GL_DEPTH_TEST);
-    if (last_enable_stencil_test) glEnable(GL_STENCIL_TEST); else glDisable(GL_STENCIL_TEST);
-    if (last_enable_scissor_test) glEnable(GL_SCISSOR_TEST); else glDisable(GL_SCISSOR_TEST);
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
-    if (bd->GlVersion >= 310) { if (last_enable_primitive_restart) glEnable(GL_PRIMITIVE_RESTART); else glDisable(GL_PRIMITIVE_RESTART); }
-#endif
-
-#ifdef IMGUI_IMPL_HAS_POLYGON_MODE
-    // Desktop OpenGL 3.0 and OpenGL 3.1 had separate polygon draw modes for front-facing and back-facing faces of polygons
-    if (bd->GlVersion <= 310 || bd->GlProfileIsCompat)
-    {
-        glPolygonMode(GL_FRONT, (GLenum)last_polygon_mode[0]);
-        glPolygonMode(GL_BACK, (GLenum)last_polygon_mode[1]);
-    }
-    else
-    {
-        glPolygonMode(GL_FRONT_AND_BACK, (GLenum)last_polygon_mode[0]);
-    }
-#endif // IMGUI_IMPL_HAS_POLYGON_MODE
 
-    glViewport(last_viewport[0], last_viewport[1], (GLsizei)last_viewport[2], (GLsizei)last_viewport[3]);
-    glScissor(last_scissor_box[0], last_scissor_box[1], (GLsizei)last_scissor_box[2], (GLsizei)last_scissor_box[3]);
+    // Restore modified GL state
+    if (!exclusive)
+        backup.Restore(bd);
     (void)bd; // Not all compilation paths use this
 }
 
@@ -695,6 +1186,7 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
         glDeleteTextures(1, &bd->FontTexture);
         io.Fonts->SetTexID(0);
         bd->FontTexture = 0;
+        ImGui_ImplOpenGL3_ResetStateCache(bd); // Deleting a bound texture unbinds it
     }
 }
 
@@ -908,6 +1400,80 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
     bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_MULTI_DRAW_INDIRECT
+    // Multi-draw-indirect program: same as above but clips in the fragment shader, with the clip rectangle fetched
+    // as an instanced attribute (the indirect command BaseInstance selects it). Needs GLSL 1.30+ for 'flat'.
+    if (bd->UseMultiDrawIndirect && glsl_version >= 130 && glsl_version != 300)
+    {
+        const GLchar* vertex_shader_mdi =
+            "uniform mat4 ProjMtx;\n"
+            "in vec2 Position;\n"
+            "in vec2 UV;\n"
+            "in vec4 Color;\n"
+            "in vec4 ClipRect;\n"
+            "out vec2 Frag_UV;\n"
+            "out vec4 Frag_Color;\n"
+            "flat out vec4 Frag_ClipRect;\n"
+            "void main()\n"
+            "{\n"
+            "    Frag_UV = UV;\n"
+            "    Frag_Color = Color;\n"
+            "    Frag_ClipRect = ClipRect;\n"
+            "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
+            "}\n";
+
+        const GLchar* fragment_shader_mdi =
+            "uniform sampler2D Texture;\n"
+            "in vec2 Frag_UV;\n"
+            "in vec4 Frag_Color;\n"
+            "flat in vec4 Frag_ClipRect;\n"
+            "out vec4 Out_Color;\n"
+            "void main()\n"
+            "{\n"
+            "    if (gl_FragCoord.x < Frag_ClipRect.x || gl_FragCoord.y < Frag_ClipRect.y || gl_FragCoord.x >= Frag_ClipRect.z || gl_FragCoord.y >= Frag_ClipRect.w)\n"
+            "        discard;\n"
+            "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+            "}\n";
+
+        const GLchar* vertex_shader_mdi_with_version[2] = { bd->GlslVersionString, vertex_shader_mdi };
+        GLuint vert_handle_mdi = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vert_handle_mdi, 2, vertex_shader_mdi_with_version, nullptr);
+        glCompileShader(vert_handle_mdi);
+        bool ok = CheckShader(vert_handle_mdi, "multi-draw-indirect vertex shader");
+
+        const GLchar* fragment_shader_mdi_with_version[2] = { bd->GlslVersionString, fragment_shader_mdi };
+        GLuint frag_handle_mdi = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(frag_handle_mdi, 2, fragment_shader_mdi_with_version, nullptr);
+        glCompileShader(frag_handle_mdi);
+        ok &= CheckShader(frag_handle_mdi, "multi-draw-indirect fragment shader");
+
+        bd->ShaderHandleMdi = glCreateProgram();
+        glAttachShader(bd->ShaderHandleMdi, vert_handle_mdi);
+        glAttachShader(bd->ShaderHandleMdi, frag_handle_mdi);
+        glBindAttribLocation(bd->ShaderHandleMdi, ImGui_ImplOpenGL3_MdiLocationPos, "Position");
+        glBindAttribLocation(bd->ShaderHandleMdi, ImGui_ImplOpenGL3_MdiLocationUV, "UV");
+        glBindAttribLocation(bd->ShaderHandleMdi, ImGui_ImplOpenGL3_MdiLocationColor, "Color");
+        glBindAttribLocation(bd->ShaderHandleMdi, ImGui_ImplOpenGL3_MdiLocationClipRect, "ClipRect");
+        glLinkProgram(bd->ShaderHandleMdi);
+        ok &= CheckProgram(bd->ShaderHandleMdi, "multi-draw-indirect shader program");
+
+        glDetachShader(bd->ShaderHandleMdi, vert_handle_mdi);
+        glDetachShader(bd->ShaderHandleMdi, frag_handle_mdi);
+        glDeleteShader(vert_handle_mdi);
+        glDeleteShader(frag_handle_mdi);
+
+        bd->AttribLocationTexMdi = glGetUniformLocation(bd->ShaderHandleMdi, "Texture");
+        bd->AttribLocationProjMtxMdi = glGetUniformLocation(bd->ShaderHandleMdi, "ProjMtx");
+        if (!ok)
+        {
+            glDeleteProgram(bd->ShaderHandleMdi);
+            bd->ShaderHandleMdi = 0;
+        }
+    }
+    if (bd->ShaderHandleMdi == 0)
+        bd->UseMultiDrawIndirect = false;   // Fall back to one draw call per command
+#endif
+
     // Create buffers
     glGenBuffers(1, &bd->VboHandle);
     glGenBuffers(1, &bd->ElementsHandle);
@@ -930,6 +1496,14 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
+    if (bd->ShaderHandleMdi){ glDeleteProgram(bd->ShaderHandleMdi); bd->ShaderHandleMdi = 0; }
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    ImGui_ImplOpenGL3_DestroyRing(bd);
+#endif
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+    if (bd->StateCache.VertexArrayObject) { glDeleteVertexArrays(1, &bd->StateCache.VertexArrayObject); bd->StateCache.VertexArrayObject = 0; }
+#endif
+    ImGui_ImplOpenGL3_ResetStateCache(bd);
     ImGui_ImplOpenGL3_DestroyFontsTexture();
 }
 
@@ -35,6 +35,11 @@ IMGUI_IMPL_API void     ImGui_ImplOpenGL3_Shutdown();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_NewFrame();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data);
 
+// (Optional) When the application owns the GL context: skip backup/restore of GL state and only issue state changes which differ from what we last set.
+// Call ImGui_ImplOpenGL3_InvalidateStateCache() after changing GL state yourself between two calls to ImGui_ImplOpenGL3_RenderDrawData().
+IMGUI_IMPL_API void     ImGui_ImplOpenGL3_SetExclusiveContext(bool exclusive);
+IMGUI_IMPL_API void     ImGui_ImplOpenGL3_InvalidateStateCache();
+
 // (Optional) Called by Init/NewFrame/Shutdown
 IMGUI_IMPL_API bool     ImGui_ImplOpenGL3_CreateFontsTexture();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyFontsTexture();
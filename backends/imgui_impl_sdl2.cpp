@@ -21,6 +21,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: Inputs: Gamepad is opened once on SDL_CONTROLLERDEVICEADDED/SDL_CONTROLLERDEVICEREMOVED events instead of calling SDL_GameControllerOpen() every frame, and nothing is polled while no gamepad is connected. Only gamepad buttons/axes which changed since the last frame are submitted, analog values go through a small deadband.
 //  2023-04-06: Inputs: Avoid calling SDL_StartTextInput()/SDL_StopTextInput() as they don't only pertain to IME. It's unclear exactly what their relation is to IME. (#6306)
 //  2023-04-04: Inputs: Added support for io.AddMouseSourceEvent() to discriminate ImGuiMouseSource_Mouse/ImGuiMouseSource_TouchScreen. (#2702)
 //  2023-02-23: Accept SDL_GetPerformanceCounter() not returning a monotonically increasing value. (#6189, #6114, #3644)
@@ -113,6 +114,13 @@ struct ImGui_ImplSDL2_Data
     char*           ClipboardTextData;
     bool            MouseCanUseGlobalState;
 
+    // Gamepad: opened on device added/removed events, key state is what we last submitted to Dear ImGui.
+    SDL_GameController* Gamepad;
+    bool            WantUpdateGamepad;
+    bool            WantResyncGamepadKeys;
+    bool            GamepadKeyDown[ImGuiKey_GamepadRStickDown - ImGuiKey_GamepadStart + 1];
+    float           GamepadKeyValue[ImGuiKey_GamepadRStickDown - ImGuiKey_GamepadStart + 1];
+
     ImGui_ImplSDL2_Data()   { memset((void*)this, 0, sizeof(*this)); }
 };
 
@@ -361,6 +369,14 @@ bool ImGui_ImplSDL2_ProcessEvent(const SDL_Event* event)
                 io.AddFocusEvent(true);
             else if (event->window.event == SDL_WINDOWEVENT_FOCUS_LOST)
                 io.AddFocusEvent(false);
+            if (window_event == SDL_WINDOWEVENT_FOCUS_GAINED || window_event == SDL_WINDOWEVENT_FOCUS_LOST)
+                bd->WantResyncGamepadKeys = true; // Losing focus clears all keys on Dear ImGui side
+            return true;
+        }
+        case SDL_CONTROLLERDEVICEADDED:
+        case SDL_CONTROLLERDEVICEREMOVED:
+        {
+            bd->WantUpdateGamepad = true;
             return true;
         }
     }
@@ -392,6 +408,7 @@ static bool ImGui_ImplSDL2_Init(SDL_Window* window, SDL_Renderer* renderer)
 
     bd->Window = window;
     bd->Renderer = renderer;
+    bd->WantUpdateGamepad = true;
     bd->MouseCanUseGlobalState = mouse_can_use_global_state;
 
     io.SetClipboardTextFn = ImGui_ImplSDL2_SetClipboardText;
@@ -497,6 +514,8 @@ void ImGui_ImplSDL2_Shutdown()
     for (ImGuiMouseCursor cursor_n = 0; cursor_n < ImGuiMouseCursor_COUNT; cursor_n++)
         SDL_FreeCursor(bd->MouseCursors[cursor_n]);
     bd->LastMouseCursor = nullptr;
+    if (bd->Gamepad)
+        SDL_GameControllerClose(bd->Gamepad);
 
     io.BackendPlatformName = nullptr;
     io.BackendPlatformUserData = nullptr;
@@ -561,23 +580,73 @@ static void ImGui_ImplSDL2_UpdateMouseCursor()
     }
 }
 
+// Submit a gamepad key only when it changed since the last submitted value.
+// Small analog variations (sensor noise on a held stick or trigger) are ignored, but reaching 0.0f or 1.0f is always submitted.
+static void ImGui_ImplSDL2_UpdateGamepadKey(ImGui_ImplSDL2_Data* bd, ImGuiKey key, bool down, float value)
+{
+    const float analog_deadband = 1.0f / 64.0f;
+    const int n = key - ImGuiKey_GamepadStart;
+    if (!bd->WantResyncGamepadKeys && bd->GamepadKeyDown[n] == down)
+    {
+        const float delta = value - bd->GamepadKeyValue[n];
+        if (delta == 0.0f || (value > 0.0f && value < 1.0f && delta < analog_deadband && delta > -analog_deadband))
+            return;
+    }
+    bd->GamepadKeyDown[n] = down;
+    bd->GamepadKeyValue[n] = value;
+    ImGui::GetIO().AddKeyAnalogEvent(key, down, value);
+}
+
+static void ImGui_ImplSDL2_ReleaseGamepadKeys(ImGui_ImplSDL2_Data* bd)
+{
+    for (int key = ImGuiKey_GamepadStart; key <= ImGuiKey_GamepadRStickDown; key++)
+        if (bd->WantResyncGamepadKeys || bd->GamepadKeyDown[key - ImGuiKey_GamepadStart] || bd->GamepadKeyValue[key - ImGuiKey_GamepadStart] != 0.0f)
+        {
+            bd->GamepadKeyDown[key - ImGuiKey_GamepadStart] = false;
+            bd->GamepadKeyValue[key - ImGuiKey_GamepadStart] = 0.0f;
+            ImGui::GetIO().AddKeyAnalogEvent((ImGuiKey)key, false, 0.0f);
+        }
+    bd->WantResyncGamepadKeys = false;
+}
+
 static void ImGui_ImplSDL2_UpdateGamepads()
 {
+    ImGui_ImplSDL2_Data* bd = ImGui_ImplSDL2_GetBackendData();
     ImGuiIO& io = ImGui::GetIO();
     if ((io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad) == 0) // FIXME: Technically feeding gamepad shouldn't depend on this now that they are regular inputs.
+    {
+        bd->WantResyncGamepadKeys = true;
         return;
+    }
+
+    // (Re)open gamepad only when SDL reported a device being added or removed.
+    if (bd->WantUpdateGamepad)
+    {
+        if (bd->Gamepad != nullptr && !SDL_GameControllerGetAttached(bd->Gamepad))
+        {
+            SDL_GameControllerClose(bd->Gamepad);
+            bd->Gamepad = nullptr;
+        }
+        for (int n = 0; n < SDL_NumJoysticks() && bd->Gamepad == nullptr; n++)
+            if (SDL_IsGameController(n))
+                bd->Gamepad = SDL_GameControllerOpen(n);
+        bd->WantUpdateGamepad = false;
+    }
 
-    // Get gamepad
+    // Nothing connected: don't poll, and release whatever was held when the gamepad got disconnected.
     io.BackendFlags &= ~ImGuiBackendFlags_HasGamepad;
-    SDL_GameController* game_controller = SDL_GameControllerOpen(0);
-    if (!game_controller)
+    if (bd->Gamepad == nullptr)
+    {
+        ImGui_ImplSDL2_ReleaseGamepadKeys(bd);
         return;
+    }
+    SDL_GameController* game_controller = bd->Gamepad;
     io.BackendFlags |= ImGuiBackendFlags_HasGamepad;
 
     // Update gamepad inputs
     #define IM_SATURATE(V)                      (V < 0.0f ? 0.0f : V > 1.0f ? 1.0f : V)
-    #define MAP_BUTTON(KEY_NO, BUTTON_NO)       { io.AddKeyEvent(KEY_NO, SDL_GameControllerGetButton(game_controller, BUTTON_NO) != 0); }
-    #define MAP_ANALOG(KEY_NO, AXIS_NO, V0, V1) { float vn = (float)(SDL_GameControllerGetAxis(game_controller, AXIS_NO) - V0) / (float)(V1 - V0); vn = IM_SATURATE(vn); io.AddKeyAnalogEvent(KEY_NO, vn > 0.1f, vn); }
+    #define MAP_BUTTON(KEY_NO, BUTTON_NO)       { bool down = SDL_GameControllerGetButton(game_controller, BUTTON_NO) != 0; ImGui_ImplSDL2_UpdateGamepadKey(bd, KEY_NO, down, down ? 1.0f : 0.0f); }
+    #define MAP_ANALOG(KEY_NO, AXIS_NO, V0, V1) { float vn = (float)(SDL_GameControllerGetAxis(game_controller, AXIS_NO) - V0) / (float)(V1 - V0); vn = IM_SATURATE(vn); ImGui_ImplSDL2_UpdateGamepadKey(bd, KEY_NO, vn > 0.1f, vn); }
     const int thumb_dead_zone = 8000;           // SDL_gamecontroller.h suggests using this value.
     MAP_BUTTON(ImGuiKey_GamepadStart,           SDL_CONTROLLER_BUTTON_START);
     MAP_BUTTON(ImGuiKey_GamepadBack,            SDL_CONTROLLER_BUTTON_BACK);
@@ -605,6 +674,7 @@ static void ImGui_ImplSDL2_UpdateGamepads()
     MAP_ANALOG(ImGuiKey_GamepadRStickDown,      SDL_CONTROLLER_AXIS_RIGHTY, +thumb_dead_zone, +32767);
     #undef MAP_BUTTON
     #undef MAP_ANALOG
+    bd->WantResyncGamepadKeys = false;
 }
 
 void ImGui_ImplSDL2_NewFrame()
@@ -22,6 +22,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: Inputs: Gamepad is opened once on SDL_EVENT_GAMEPAD_ADDED/SDL_EVENT_GAMEPAD_REMOVED events instead of calling SDL_OpenGamepad() every frame, and nothing is polled while no gamepad is connected. Only gamepad buttons/axes which changed since the last frame are submitted, analog values go through a small deadband.
 //  2023-05-04: Fixed build on Emscripten/iOS/Android. (#6391)
 //  2023-04-06: Inputs: Avoid calling SDL_StartTextInput()/SDL_StopTextInput() as they don't only pertain to IME. It's unclear exactly what their relation is to IME. (#6306)
 //  2023-04-04: Inputs: Added support for io.AddMouseSourceEvent() to discriminate ImGuiMouseSource_Mouse/ImGuiMouseSource_TouchScreen. (#2702)
@@ -65,6 +66,13 @@ struct ImGui_ImplSDL3_Data
     char*           ClipboardTextData;
     bool            MouseCanUseGlobalState;
 
+    // Gamepad: opened on device added/removed events, key state is what we last submitted to Dear ImGui.
+    SDL_Gamepad*    Gamepad;
+    bool            WantUpdateGamepad;
+    bool            WantResyncGamepadKeys;
+    bool            GamepadKeyDown[ImGuiKey_GamepadRStickDown - ImGuiKey_GamepadStart + 1];
+    float           GamepadKeyValue[ImGuiKey_GamepadRStickDown - ImGuiKey_GamepadStart + 1];
+
     ImGui_ImplSDL3_Data()   { memset((void*)this, 0, sizeof(*this)); }
 };
 
@@ -305,9 +313,15 @@ bool ImGui_ImplSDL3_ProcessEvent(const SDL_Event* event)
         }
         case SDL_EVENT_WINDOW_FOCUS_GAINED:
             io.AddFocusEvent(true);
+            bd->WantResyncGamepadKeys = true; // Losing focus clears all keys on Dear ImGui side
             return true;
         case SDL_EVENT_WINDOW_FOCUS_LOST:
             io.AddFocusEvent(false);
+            bd->WantResyncGamepadKeys = true;
+            return true;
+        case SDL_EVENT_GAMEPAD_ADDED:
+        case SDL_EVENT_GAMEPAD_REMOVED:
+            bd->WantUpdateGamepad = true;
             return true;
     }
     return false;
@@ -338,6 +352,7 @@ static bool ImGui_ImplSDL3_Init(SDL_Window* window, SDL_Renderer* renderer)
 
     bd->Window = window;
     bd->Renderer = renderer;
+    bd->WantUpdateGamepad = true;
     bd->MouseCanUseGlobalState = mouse_can_use_global_state;
 
     io.SetClipboardTextFn = ImGui_ImplSDL3_SetClipboardText;
@@ -432,6 +447,8 @@ void ImGui_ImplSDL3_Shutdown()
     for (ImGuiMouseCursor cursor_n = 0; cursor_n < ImGuiMouseCursor_COUNT; cursor_n++)
         SDL_DestroyCursor(bd->MouseCursors[cursor_n]);
     bd->LastMouseCursor = nullptr;
+    if (bd->Gamepad)
+        SDL_CloseGamepad(bd->Gamepad);
 
     io.BackendPlatformName = nullptr;
     io.BackendPlatformUserData = nullptr;
@@ -499,23 +516,75 @@ static void ImGui_ImplSDL3_UpdateMouseCursor()
     }
 }
 
+// Submit a gamepad key only when it changed since the last submitted value.
+// Small analog variations (sensor noise on a held stick or trigger) are ignored, but reaching 0.0f or 1.0f is always submitted.
+static void ImGui_ImplSDL3_UpdateGamepadKey(ImGui_ImplSDL3_Data* bd, ImGuiKey key, bool down, float value)
+{
+    const float analog_deadband = 1.0f / 64.0f;
+    const int n = key - ImGuiKey_GamepadStart;
+    if (!bd->WantResyncGamepadKeys && bd->GamepadKeyDown[n] == down)
+    {
+        const float delta = value - bd->GamepadKeyValue[n];
+        if (delta == 0.0f || (value > 0.0f && value < 1.0f && delta < analog_deadband && delta > -analog_deadband))
+            return;
+    }
+    bd->GamepadKeyDown[n] = down;
+    bd->GamepadKeyValue[n] = value;
+    ImGui::GetIO().AddKeyAnalogEvent(key, down, value);
+}
+
+static void ImGui_ImplSDL3_ReleaseGamepadKeys(ImGui_ImplSDL3_Data* bd)
+{
+    for (int key = ImGuiKey_GamepadStart; key <= ImGuiKey_GamepadRStickDown; key++)
+        if (bd->WantResyncGamepadKeys || bd->GamepadKeyDown[key - ImGuiKey_GamepadStart] || bd->GamepadKeyValue[key - ImGuiKey_GamepadStart] != 0.0f)
+        {
+            bd->GamepadKeyDown[key - ImGuiKey_GamepadStart] = false;
+            bd->GamepadKeyValue[key - ImGuiKey_GamepadStart] = 0.0f;
+            ImGui::GetIO().AddKeyAnalogEvent((ImGuiKey)key, false, 0.0f);
+        }
+    bd->WantResyncGamepadKeys = false;
+}
+
 static void ImGui_ImplSDL3_UpdateGamepads()
 {
+    ImGui_ImplSDL3_Data* bd = ImGui_ImplSDL3_GetBackendData();
     ImGuiIO& io = ImGui::GetIO();
     if ((io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad) == 0) // FIXME: Technically feeding gamepad shouldn't depend on this now that they are regular inputs.
+    {
+        bd->WantResyncGamepadKeys = true;
         return;
+    }
 
-    // Get gamepad
+    // (Re)open gamepad only when SDL reported a device being added or removed.
+    if (bd->WantUpdateGamepad)
+    {
+        if (bd->Gamepad != nullptr && !SDL_GamepadConnected(bd->Gamepad))
+        {
+            SDL_CloseGamepad(bd->Gamepad);
+            bd->Gamepad = nullptr;
+        }
+        int count = 0;
+        SDL_JoystickID* gamepads = SDL_GetGamepads(&count);
+        for (int n = 0; n < count && bd->Gamepad == nullptr; n++)
+            bd->Gamepad = SDL_OpenGamepad(gamepads[n]);
+        SDL_free(gamepads);
+        bd->WantUpdateGamepad = false;
+    }
+
+    // Nothing connected: don't poll, and release whatever was held when the gamepad got disconnected.
     io.BackendFlags &= ~ImGuiBackendFlags_HasGamepad;
-    SDL_Gamepad* gamepad = SDL_OpenGamepad(0);
-    if (!gamepad)
+    if (bd->Gamepad == nullptr)
+    {
+        ImGui_ImplSDL3_ReleaseGamepadKeys(bd);
         return;
+    }
+    SDL_Gamepad* gamepad = bd->Gamepad;
     io.BackendFlags |= ImGuiBackendFlags_HasGamepad;
 
     // Update gamepad inputs
     #define IM_SATURATE(V)                      (V < 0.0f ? 0.0f : V > 1.0f ? 1.0f : V)
-    #define MAP_BUTTON(KEY_NO, BUTTON_NO)       { io.AddKeyEvent(KEY_NO, SDL_GetGamepadButton(gamepad, BUTTON_NO) != 0); }
-    #define MAP_ANALOG(KEY_NO, AXIS_NO, V0, V1) { float vn = (float)(SDL_GetGamepadAxis(gamepad, AXIS_NO) - V0) / (float)(V1 - V0); vn = IM_SATURATE(vn); io.AddKeyAnalogEvent(KEY_NO, vn > 0.1f, vn); }
+    #define MAP_BUTTON(KEY_NO, BUTTON_NO)       { bool down = SDL_GetGamepadButton(gamepad, BUTTON_NO) != 0; ImGui_ImplSDL3_UpdateGamepadKey(bd, KEY_NO, down, down ? 1.0f : 0.0f); }
+    #define MAP_ANALOG(KEY_NO, AXIS_NO, V0, V1) { float vn = (float)(SDL_GetGamepadAxis(gamepad, AXIS_NO) - V0) / (float)(V1 - V0); vn = IM_SATURATE(vn); ImGui_ImplSDL3_UpdateGamepadKey(bd, KEY_NO, vn > 0.1f, vn); }
     const int thumb_dead_zone = 8000;           // SDL_gamecontroller.h suggests using this value.
     MAP_BUTTON(ImGuiKey_GamepadStart,           SDL_GAMEPAD_BUTTON_START);
     MAP_BUTTON(ImGuiKey_GamepadBack,            SDL_GAMEPAD_BUTTON_BACK);
@@ -543,6 +612,7 @@ static void ImGui_ImplSDL3_UpdateGamepads()
     MAP_ANALOG(ImGuiKey_GamepadRStickDown,      SDL_GAMEPAD_AXIS_RIGHTY, +thumb_dead_zone, +32767);
     #undef MAP_BUTTON
     #undef MAP_ANALOG
+    bd->WantResyncGamepadKeys = false;
 }
 
 void ImGui_ImplSDL3_NewFrame()
@@ -10,6 +10,7 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'SDL_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
 //  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Converted geometry is cached per draw list and submitted with one SDL_RenderGeometryRaw() call per texture run.
 
 // You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -20,6 +21,7 @@
 // - Introduction, links and more at the top of imgui.cpp
 
 // CHANGELOG
+//  2026-10-19: Cache converted geometry per draw list (reused while the list content fingerprint is unchanged). Clip rectangles are applied on the CPU so consecutive commands using the same texture are submitted with a single SDL_RenderGeometryRaw() call.
 //  2023-05-30: Initial version.
 
 #include "imgui.h"
@@ -39,14 +41,56 @@
 #error This backend requires SDL 3.0.0+
 #endif
 
+// Geometry cache
+// SDL_RenderGeometryRaw() has a high fixed cost per call, and the clip rectangle can only be changed between calls.
+// Each draw list is therefore converted once into a form where clipping has already been applied on the CPU
+// (fully clipped triangles are dropped, partially clipped triangles/quads are cut), indices are absolute 32-bit
+// values (VtxOffset is folded in), and consecutive commands sharing a texture are merged into a single run.
+// The conversion is reused for as long as the fingerprint of the draw list content doesn't change.
+// At submission time, runs from consecutive draw lists (e.g. child windows) using the same texture are batched as well.
+struct ImGui_ImplSDLRenderer3_CachedRun
+{
+    SDL_Texture*    Texture;
+    int             IdxOffset;
+    int             IdxCount;
+    int             VtxMin;                 // Range of vertices referenced by the run's indices
+    int             VtxCount;
+    int             CallbackCmd;            // >= 0: index of a user callback command in the draw list. Other fields are unused.
+};
+
+struct ImGui_ImplSDLRenderer3_CachedList
+{
+    const ImDrawList*                           DrawList;
+    ImU64                                       Fingerprint;
+    int                                         LastFrameUsed;
+    ImVector<ImDrawVert>                        VtxBuffer;
+    ImVector<int>                               IdxBuffer;
+    ImVector<ImGui_ImplSDLRenderer3_CachedRun>  Runs;
+};
+
+struct ImGui_ImplSDLRenderer3_BatchEntry
+{
+    const ImGui_ImplSDLRenderer3_CachedList*    List;
+    const ImGui_ImplSDLRenderer3_CachedRun*     Run;
+};
+
 // SDL_Renderer data
 struct ImGui_ImplSDLRenderer3_Data
 {
     SDL_Renderer*   SDLRenderer;
     SDL_Texture*    FontTexture;
+    ImVector<ImGui_ImplSDLRenderer3_CachedList*> GeometryCache;
+    ImVector<ImGui_ImplSDLRenderer3_BatchEntry>  Batch;           // Runs waiting to be submitted with the same texture
+    ImVector<ImDrawVert>                         BatchVtxBuffer;  // Staging when a batch spans several draw lists
+    ImVector<int>                                BatchIdxBuffer;
     ImGui_ImplSDLRenderer3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
 
+// Cached entries not used for that many frames are released.
+#ifndef IMGUI_IMPL_SDLRENDERER3_CACHE_KEEP_FRAMES
+#define IMGUI_IMPL_SDLRENDERER3_CACHE_KEEP_FRAMES   60
+#endif
+
 // Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
 // It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
 static ImGui_ImplSDLRenderer3_Data* ImGui_ImplSDLRenderer3_GetBackendData()
@@ -105,6 +149,358 @@ void ImGui_ImplSDLRenderer3_NewFrame()
         ImGui_ImplSDLRenderer3_CreateDeviceObjects();
 }
 
+struct ImGui_ImplSDLRenderer3_ClipState
+{
+    ImVec2  ClipOff;
+    ImVec2  ClipScale;
+    int     FbWidth;
+    int     FbHeight;
+};
+
+static void ImGui_ImplSDLRenderer3_ClearGeometryCache()
+{
+    ImGui_ImplSDLRenderer3_Data* bd = ImGui_ImplSDLRenderer3_GetBackendData();
+    for (ImGui_ImplSDLRenderer3_CachedList* cache : bd->GeometryCache)
+        IM_DELETE(cache);
+    bd->GeometryCache.clear();
+    bd->Batch.clear();
+    bd->BatchVtxBuffer.clear();
+    bd->BatchIdxBuffer.clear();
+}
+
+// Draw lists are mostly submitted in the same order every frame: try the slot matching 'hint' first, then keep the vector sorted that way.
+static ImGui_ImplSDLRenderer3_CachedList* ImGui_ImplSDLRenderer3_GetCachedList(ImGui_ImplSDLRenderer3_Data* bd, const ImDrawList* draw_list, int hint)
+{
+    ImVector<ImGui_ImplSDLRenderer3_CachedList*>& caches = bd->GeometryCache;
+    if (hint < caches.Size && caches[hint]->DrawList == draw_list)
+        return caches[hint];
+    int found = -1;
+    for (int n = 0; n < caches.Size && found == -1; n++)
+        if (caches[n]->DrawList == draw_list)
+            found = n;
+    if (found == -1)
+    {
+        ImGui_ImplSDLRenderer3_CachedList* cache = IM_NEW(ImGui_ImplSDLRenderer3_CachedList)();
+        cache->DrawList = draw_list;
+        cache->Fingerprint = 0;
+        cache->LastFrameUsed = 0;
+        caches.push_back(cache);
+        found = caches.Size - 1;
+    }
+    if (hint < caches.Size && found != hint)
+    {
+        ImGui_ImplSDLRenderer3_CachedList* tmp = caches[hint];
+        caches[hint] = caches[found];
+        caches[found] = tmp;
+        found = hint;
+    }
+    return caches[found];
+}
+
+// Word-at-a-time multiply/xorshift hash. Runs every frame over all vertices so it needs to be much cheaper than the conversion it saves.
+static ImU64 ImGui_ImplSDLRenderer3_HashData(const void* data, size_t size, ImU64 h)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    h ^= (ImU64)size * 0x9E3779B97F4A7C15ULL;
+    for (; size >= 8; size -= 8, p += 8)
+    {
+        ImU64 w;
+        memcpy(&w, p, 8);
+        h = (h ^ w) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 32;
+    }
+    if (size > 0)
+    {
+        ImU64 w = 0;
+        memcpy(&w, p, size);
+        h = (h ^ w) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 32;
+    }
+    return h;
+}
+
+static ImU64 ImGui_ImplSDLRenderer3_HashDrawList(const ImDrawList* draw_list, const ImGui_ImplSDLRenderer3_ClipState& clip_state)
+{
+    ImU64 h = ImGui_ImplSDLRenderer3_HashData(&clip_state, sizeof(clip_state), 0xCBF29CE484222325ULL);
+    h = ImGui_ImplSDLRenderer3_HashData(draw_list->CmdBuffer.Data, (size_t)draw_list->CmdBuffer.size_in_bytes(), h);
+    h = ImGui_ImplSDLRenderer3_HashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), h);
+    h = ImGui_ImplSDLRenderer3_HashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), h);
+    return h;
+}
+
+struct ImGui_ImplSDLRenderer3_ClipVert
+{
+    ImVec2  Pos;
+    ImVec2  Uv;
+    float   Col[4];
+};
+
+static void ImGui_ImplSDLRenderer3_LoadClipVert(ImGui_ImplSDLRenderer3_ClipVert* out, const ImDrawVert& v)
+{
+    out->Pos = v.pos;
+    out->Uv = v.uv;
+    for (int c = 0; c < 4; c++)
+        out->Col[c] = (float)((v.col >> (c * 8)) & 0xFF);
+}
+
+// Sutherland-Hodgman clipping of a convex polygon against 'clip' (x1,y1,x2,y2). 'buf_a' holds the input.
+// Each plane adds at most one vertex to a convex polygon, so a quad never exceeds 8 vertices.
+static int ImGui_ImplSDLRenderer3_ClipPolygon(ImGui_ImplSDLRenderer3_ClipVert* buf_a, ImGui_ImplSDLRenderer3_ClipVert* buf_b, int buf_capacity, int count, const ImVec4& clip, ImGui_ImplSDLRenderer3_ClipVert** out_poly)
+{
+    ImGui_ImplSDLRenderer3_ClipVert* src = buf_a;
+    ImGui_ImplSDLRenderer3_ClipVert* dst = buf_b;
+    for (int plane = 0; plane < 4 && count >= 3; plane++)
+    {
+        const int axis = plane & 1;
+        const float bound = (&clip.x)[plane];
+        const float sign = (plane < 2) ? 1.0f : -1.0f;
+        int out_count = 0;
+        for (int i = 0; i < count && out_count + 2 <= buf_capacity; i++)
+        {
+            const ImGui_ImplSDLRenderer3_ClipVert& a = src[i];
+            const ImGui_ImplSDLRenderer3_ClipVert& b = src[(i + 1 == count) ? 0 : i + 1];
+            const float da = ((&a.Pos.x)[axis] - bound) * sign;
+            const float db = ((&b.Pos.x)[axis] - bound) * sign;
+            if (da >= 0.0f)
+                dst[out_count++] = a;
+            if ((da >= 0.0f) != (db >= 0.0f))
+            {
+                const float t = da / (da - db);
+                ImGui_ImplSDLRenderer3_ClipVert& v = dst[out_count++];
+                v.Pos = ImVec2(a.Pos.x + (b.Pos.x - a.Pos.x) * t, a.Pos.y + (b.Pos.y - a.Pos.y) * t);
+                (&v.Pos.x)[axis] = bound;
+                v.Uv = ImVec2(a.Uv.x + (b.Uv.x - a.Uv.x) * t, a.Uv.y + (b.Uv.y - a.Uv.y) * t);
+                for (int c = 0; c < 4; c++)
+                    v.Col[c] = a.Col[c] + (b.Col[c] - a.Col[c]) * t;
+            }
+        }
+        ImGui_ImplSDLRenderer3_ClipVert* tmp = src; src = dst; dst = tmp;
+        count = out_count;
+    }
+    *out_poly = src;
+    return count >= 3 ? count : 0;
+}
+
+// Append a clipped polygon as a triangle fan. For a clipped rectangle this produces the same (0,1,2)(0,2,3) pattern as ImDrawList::PrimRect(), which SDL's software renderer can still turn into blits.
+static void ImGui_ImplSDLRenderer3_EmitPolygon(ImGui_ImplSDLRenderer3_CachedList* cache, const ImGui_ImplSDLRenderer3_ClipVert* poly, int count)
+{
+    const int base = cache->VtxBuffer.Size;
+    for (int i = 0; i < count; i++)
+    {
+        ImDrawVert v;
+        v.pos = poly[i].Pos;
+        v.uv = poly[i].Uv;
+        v.col = 0;
+        for (int c = 0; c < 4; c++)
+        {
+            const float f = poly[i].Col[c] < 0.0f ? 0.0f : poly[i].Col[c] > 255.0f ? 255.0f : poly[i].Col[c];
+            v.col |= (ImU32)(f + 0.5f) << (c * 8);
+        }
+        cache->VtxBuffer.push_back(v);
+    }
+    for (int i = 1; i + 1 < count; i++)
+    {
+        cache->IdxBuffer.push_back(base);
+        cache->IdxBuffer.push_back(base + i);
+        cache->IdxBuffer.push_back(base + i + 1);
+    }
+}
+
+// (a,b,c)+(a,c,d) can be clipped as a single quad when all attributes are affine across it, i.e. d == a + c - b.
+// This is the case for everything emitted by PrimRect()/PrimRectUV(), which is most of the geometry (text, frames).
+static bool ImGui_ImplSDLRenderer3_IsAffineQuad(const ImDrawVert& a, const ImDrawVert& b, const ImDrawVert& c, const ImDrawVert& d)
+{
+    const float pos_eps = 1.0f / 1024.0f;
+    const float uv_eps = 1.0f / (1024.0f * 1024.0f);
+    const float dx = a.pos.x + c.pos.x - b.pos.x - d.pos.x, dy = a.pos.y + c.pos.y - b.pos.y - d.pos.y;
+    const float du = a.uv.x + c.uv.x - b.uv.x - d.uv.x, dv = a.uv.y + c.uv.y - b.uv.y - d.uv.y;
+    if (dx > pos_eps || dx < -pos_eps || dy > pos_eps || dy < -pos_eps)
+        return false;
+    if (du > uv_eps || du < -uv_eps || dv > uv_eps || dv < -uv_eps)
+        return false;
+    for (int c_shift = 0; c_shift < 32; c_shift += 8)
+        if ((int)((a.col >> c_shift) & 0xFF) + (int)((c.col >> c_shift) & 0xFF) != (int)((b.col >> c_shift) & 0xFF) + (int)((d.col >> c_shift) & 0xFF))
+            return false;
+    return true;
+}
+
+static void ImGui_ImplSDLRenderer3_ConvertDrawList(ImGui_ImplSDLRenderer3_CachedList* cache, const ImDrawList* cmd_list, const ImGui_ImplSDLRenderer3_ClipState& clip_state)
+{
+    // Unclipped triangles keep referencing the original vertices, clipped pieces are appended after them.
+    cache->VtxBuffer.resize(cmd_list->VtxBuffer.Size);
+    if (cmd_list->VtxBuffer.Size > 0)
+        memcpy(cache->VtxBuffer.Data, cmd_list->VtxBuffer.Data, (size_t)cmd_list->VtxBuffer.size_in_bytes());
+    cache->IdxBuffer.resize(0);
+    cache->Runs.resize(0);
+
+    const ImVec2 clip_off = clip_state.ClipOff;
+    const ImVec2 clip_scale = clip_state.ClipScale;
+    for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+    {
+        const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+        if (pcmd->UserCallback)
+        {
+            ImGui_ImplSDLRenderer3_CachedRun run = { nullptr, cache->IdxBuffer.Size, 0, 0, 0, cmd_i };
+            cache->Runs.push_back(run);
+            continue;
+        }
+
+        // Project scissor/clipping rectangles into framebuffer space
+        ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+        ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+        if (clip_min.x < 0.0f) { clip_min.x = 0.0f; }
+        if (clip_min.y < 0.0f) { clip_min.y = 0.0f; }
+        if (clip_max.x > (float)clip_state.FbWidth) { clip_max.x = (float)clip_state.FbWidth; }
+        if (clip_max.y > (float)clip_state.FbHeight) { clip_max.y = (float)clip_state.FbHeight; }
+        if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+            continue;
+
+        // Same integer rectangle we used to pass to SDL_SetRenderClipRect(), which SDL compares against untransformed vertex positions.
+        const int clip_x = (int)clip_min.x;
+        const int clip_y = (int)clip_min.y;
+        const ImVec4 clip((float)clip_x, (float)clip_y, (float)(clip_x + (int)(clip_max.x - clip_min.x)), (float)(clip_y + (int)(clip_max.y - clip_min.y)));
+        if (clip.z <= clip.x || clip.w <= clip.y)
+            continue;
+
+        SDL_Texture* tex = (SDL_Texture*)pcmd->GetTexID();
+        if (cache->Runs.Size == 0 || cache->Runs.back().CallbackCmd >= 0 || cache->Runs.back().Texture != tex)
+        {
+            ImGui_ImplSDLRenderer3_CachedRun run = { tex, cache->IdxBuffer.Size, 0, 0, 0, -1 };
+            cache->Runs.push_back(run);
+        }
+
+        const ImDrawIdx* idx_buffer = cmd_list->IdxBuffer.Data + pcmd->IdxOffset;
+        const int vtx_offset = (int)pcmd->VtxOffset;
+        const int elem_count = (int)pcmd->ElemCount;
+        for (int i = 0; i + 2 < elem_count; i += 3)
+        {
+            const int i0 = vtx_offset + idx_buffer[i];
+            const int i1 = vtx_offset + idx_buffer[i + 1];
+            const int i2 = vtx_offset + idx_buffer[i + 2];
+            const ImDrawVert& v0 = cmd_list->VtxBuffer.Data[i0];
+            const ImDrawVert& v1 = cmd_list->VtxBuffer.Data[i1];
+            const ImDrawVert& v2 = cmd_list->VtxBuffer.Data[i2];
+            const float min_x = v0.pos.x < v1.pos.x ? (v0.pos.x < v2.pos.x ? v0.pos.x : v2.pos.x) : (v1.pos.x < v2.pos.x ? v1.pos.x : v2.pos.x);
+            const float max_x = v0.pos.x > v1.pos.x ? (v0.pos.x > v2.pos.x ? v0.pos.x : v2.pos.x) : (v1.pos.x > v2.pos.x ? v1.pos.x : v2.pos.x);
+            const float min_y = v0.pos.y < v1.pos.y ? (v0.pos.y < v2.pos.y ? v0.pos.y : v2.pos.y) : (v1.pos.y < v2.pos.y ? v1.pos.y : v2.pos.y);
+            const float max_y = v0.pos.y > v1.pos.y ? (v0.pos.y > v2.pos.y ? v0.pos.y : v2.pos.y) : (v1.pos.y > v2.pos.y ? v1.pos.y : v2.pos.y);
+            if (max_x <= clip.x || max_y <= clip.y || min_x >= clip.z || min_y >= clip.w)
+                continue;
+            if (min_x >= clip.x && min_y >= clip.y && max_x <= clip.z && max_y <= clip.w)
+            {
+                cache->IdxBuffer.push_back(i0);
+                cache->IdxBuffer.push_back(i1);
+                cache->IdxBuffer.push_back(i2);
+                continue;
+            }
+
+            // Partially clipped
+            ImGui_ImplSDLRenderer3_ClipVert buf_a[16], buf_b[16];
+            ImGui_ImplSDLRenderer3_LoadClipVert(&buf_a[0], v0);
+            ImGui_ImplSDLRenderer3_LoadClipVert(&buf_a[1], v1);
+            ImGui_ImplSDLRenderer3_LoadClipVert(&buf_a[2], v2);
+            int count = 3;
+            if (i + 5 < elem_count && vtx_offset + idx_buffer[i + 3] == i0 && vtx_offset + idx_buffer[i + 4] == i2)
+            {
+                const ImDrawVert& v3 = cmd_list->VtxBuffer.Data[vtx_offset + idx_buffer[i + 5]];
+                if (ImGui_ImplSDLRenderer3_IsAffineQuad(v0, v1, v2, v3))
+                {
+                    ImGui_ImplSDLRenderer3_LoadClipVert(&buf_a[3], v3);
+                    count = 4;
+                    i += 3;
+                }
+            }
+            ImGui_ImplSDLRenderer3_ClipVert* poly;
+            count = ImGui_ImplSDLRenderer3_ClipPolygon(buf_a, buf_b, IM_ARRAYSIZE(buf_a), count, clip, &poly);
+            if (count > 0)
+                ImGui_ImplSDLRenderer3_EmitPolygon(cache, poly, count);
+        }
+    }
+
+    // Drop runs which ended up fully clipped, record the vertex range used by the others
+    int dst = 0;
+    for (int n = 0; n < cache->Runs.Size; n++)
+    {
+        ImGui_ImplSDLRenderer3_CachedRun& run = cache->Runs[n];
+        run.IdxCount = ((n + 1 < cache->Runs.Size) ? cache->Runs[n + 1].IdxOffset : cache->IdxBuffer.Size) - run.IdxOffset;
+        if (run.CallbackCmd < 0 && run.IdxCount == 0)
+            continue;
+        if (run.IdxCount > 0)
+        {
+            const int* idx_read = cache->IdxBuffer.Data + run.IdxOffset;
+            int vtx_min = idx_read[0], vtx_max = idx_read[0];
+            for (int i = 1; i < run.IdxCount; i++)
+            {
+                if (idx_read[i] < vtx_min) { vtx_min = idx_read[i]; }
+                if (idx_read[i] > vtx_max) { vtx_max = idx_read[i]; }
+            }
+            run.VtxMin = vtx_min;
+            run.VtxCount = vtx_max + 1 - vtx_min;
+        }
+        cache->Runs[dst++] = run;
+    }
+    cache->Runs.resize(dst);
+}
+
+static void ImGui_ImplSDLRenderer3_RenderGeometry(ImGui_ImplSDLRenderer3_Data* bd, SDL_Texture* tex, const ImDrawVert* vtx_buffer, int vtx_count, const int* idx_buffer, int idx_count)
+{
+    const float* xy = (const float*)(const void*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, pos));
+    const float* uv = (const float*)(const void*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, uv));
+#if SDL_VERSION_ATLEAST(2,0,19)
+    const SDL_Color* color = (const SDL_Color*)(const void*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, col)); // SDL 2.0.19+
+#else
+    const int* color = (const int*)(const void*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, col)); // SDL 2.0.17 and 2.0.18
+#endif
+
+    // Bind texture, Draw
+    SDL_RenderGeometryRaw(bd->SDLRenderer, tex,
+        xy, (int)sizeof(ImDrawVert),
+        color, (int)sizeof(ImDrawVert),
+        uv, (int)sizeof(ImDrawVert),
+        vtx_count,
+        idx_buffer, idx_count, (int)sizeof(int));
+}
+
+// Submit pending runs. A single run is drawn straight from its cache, runs from several draw lists are concatenated first.
+// (each draw list contributes at most one run to a batch, as consecutive runs of a list never share a texture)
+static void ImGui_ImplSDLRenderer3_FlushBatch(ImGui_ImplSDLRenderer3_Data* bd)
+{
+    if (bd->Batch.Size == 0)
+        return;
+    if (bd->Batch.Size == 1)
+    {
+        const ImGui_ImplSDLRenderer3_BatchEntry& entry = bd->Batch[0];
+        ImGui_ImplSDLRenderer3_RenderGeometry(bd, entry.Run->Texture, entry.List->VtxBuffer.Data, entry.List->VtxBuffer.Size, entry.List->IdxBuffer.Data + entry.Run->IdxOffset, entry.Run->IdxCount);
+        bd->Batch.resize(0);
+        return;
+    }
+
+    int vtx_count = 0, idx_count = 0;
+    for (const ImGui_ImplSDLRenderer3_BatchEntry& entry : bd->Batch)
+    {
+        vtx_count += entry.Run->VtxCount;
+        idx_count += entry.Run->IdxCount;
+    }
+    bd->BatchVtxBuffer.resize(vtx_count);
+    bd->BatchIdxBuffer.resize(idx_count);
+    ImDrawVert* vtx_write = bd->BatchVtxBuffer.Data;
+    int* idx_write = bd->BatchIdxBuffer.Data;
+    int vtx_base = 0;
+    for (const ImGui_ImplSDLRenderer3_BatchEntry& entry : bd->Batch)
+    {
+        // Only copy the vertices this run references, not the whole list
+        memcpy(vtx_write, entry.List->VtxBuffer.Data + entry.Run->VtxMin, (size_t)entry.Run->VtxCount * sizeof(ImDrawVert));
+        vtx_write += entry.Run->VtxCount;
+        const int* idx_read = entry.List->IdxBuffer.Data + entry.Run->IdxOffset;
+        const int idx_rebase = vtx_base - entry.Run->VtxMin;
+        for (int i = 0; i < entry.Run->IdxCount; i++)
+            *idx_write++ = idx_read[i] + idx_rebase;
+        vtx_base += entry.Run->VtxCount;
+    }
+    ImGui_ImplSDLRenderer3_RenderGeometry(bd, bd->Batch[0].Run->Texture, bd->BatchVtxBuffer.Data, vtx_count, bd->BatchIdxBuffer.Data, idx_count);
+    bd->Batch.resize(0);
+}
+
 void ImGui_ImplSDLRenderer3_RenderDrawData(ImDrawData* draw_data)
 {
 	ImGui_ImplSDLRenderer3_Data* bd = ImGui_ImplSDLRenderer3_GetBackendData();
@@ -143,58 +539,57 @@ void ImGui_ImplSDLRenderer3_RenderDrawData(ImDrawData* draw_data)
 
     // Render command lists
     ImGui_ImplSDLRenderer3_SetupRenderState();
+    ImGui_ImplSDLRenderer3_ClipState clip_state = { clip_off, clip_scale, fb_width, fb_height };
+    const int frame_count = ImGui::GetFrameCount();
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
-        const ImDrawVert* vtx_buffer = cmd_list->VtxBuffer.Data;
-        const ImDrawIdx* idx_buffer = cmd_list->IdxBuffer.Data;
+        ImGui_ImplSDLRenderer3_CachedList* cache = ImGui_ImplSDLRenderer3_GetCachedList(bd, cmd_list, n);
+        const ImU64 fingerprint = ImGui_ImplSDLRenderer3_HashDrawList(cmd_list, clip_state);
+        if (cache->Fingerprint != fingerprint)
+        {
+            ImGui_ImplSDLRenderer3_ConvertDrawList(cache, cmd_list, clip_state);
+            cache->Fingerprint = fingerprint;
+        }
+        cache->LastFrameUsed = frame_count;
 
-        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        for (const ImGui_ImplSDLRenderer3_CachedRun& run : cache->Runs)
         {
-            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
-            if (pcmd->UserCallback)
+            if (run.CallbackCmd >= 0)
             {
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                ImGui_ImplSDLRenderer3_FlushBatch(bd);
+                const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[run.CallbackCmd];
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplSDLRenderer3_SetupRenderState();
+                }
                 else
+                {
                     pcmd->UserCallback(cmd_list, pcmd);
+                    SDL_SetRenderClipRect(bd->SDLRenderer, nullptr); // Our geometry is already clipped
+                }
+                continue;
             }
-            else
-            {
-                // Project scissor/clipping rectangles into framebuffer space
-                ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
-                ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
-                if (clip_min.x < 0.0f) { clip_min.x = 0.0f; }
-                if (clip_min.y < 0.0f) { clip_min.y = 0.0f; }
-                if (clip_max.x > (float)fb_width) { clip_max.x = (float)fb_width; }
-                if (clip_max.y > (float)fb_height) { clip_max.y = (float)fb_height; }
-                if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
-                    continue;
-
-                SDL_Rect r = { (int)(clip_min.x), (int)(clip_min.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y) };
-                SDL_SetRenderClipRect(bd->SDLRenderer, &r);
-
-                const float* xy = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + IM_OFFSETOF(ImDrawVert, pos));
-                const float* uv = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + IM_OFFSETOF(ImDrawVert, uv));
-#if SDL_VERSION_ATLEAST(2,0,19)
-                const SDL_Color* color = (const SDL_Color*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + IM_OFFSETOF(ImDrawVert, col)); // SDL 2.0.19+
-#else
-                const int* color = (const int*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + IM_OFFSETOF(ImDrawVert, col)); // SDL 2.0.17 and 2.0.18
-#endif
 
-                // Bind texture, Draw
-				SDL_Texture* tex = (SDL_Texture*)pcmd->GetTexID();
-                SDL_RenderGeometryRaw(bd->SDLRenderer, tex,
-                    xy, (int)sizeof(ImDrawVert),
-                    color, (int)sizeof(ImDrawVert),
-                    uv, (int)sizeof(ImDrawVert),
-                    cmd_list->VtxBuffer.Size - pcmd->VtxOffset,
-                    idx_buffer + pcmd->IdxOffset, pcmd->ElemCount, sizeof(ImDrawIdx));
-            }
+            // Runs using the same texture are batched, including across draw lists (e.g. child windows)
+            if (bd->Batch.Size > 0 && bd->Batch.back().Run->Texture != run.Texture)
+                ImGui_ImplSDLRenderer3_FlushBatch(bd);
+            ImGui_ImplSDLRenderer3_BatchEntry entry = { cache, &run };
+            bd->Batch.push_back(entry);
         }
     }
+    ImGui_ImplSDLRenderer3_FlushBatch(bd);
+
+    // Release cache entries for draw lists which haven't been rendered for a while
+    for (int n = 0; n < bd->GeometryCache.Size; n++)
+        if (frame_count - bd->GeometryCache[n]->LastFrameUsed > IMGUI_IMPL_SDLRENDERER3_CACHE_KEEP_FRAMES)
+        {
+            IM_DELETE(bd->GeometryCache[n]);
+            bd->GeometryCache.erase(bd->GeometryCache.Data + n);
+            n--;
+        }
 
     // Restore modified SDL_Renderer state
     SDL_SetRenderViewport(bd->SDLRenderer, &old.Viewport);
@@ -250,6 +645,7 @@ bool ImGui_ImplSDLRenderer3_CreateDeviceObjects()
 void ImGui_ImplSDLRenderer3_DestroyDeviceObjects()
 {
     ImGui_ImplSDLRenderer3_DestroyFontsTexture();
+    ImGui_ImplSDLRenderer3_ClearGeometryCache();
 }
 
 //-----------------------------------------------------------------------------
@@ -33,6 +33,12 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: Vulkan: Added optional batching of consecutive draw commands sharing a texture into vkCmdDrawIndexedIndirect() calls (init_info->UseMultiDrawIndirect), clipping in the fragment shader instead of with vkCmdSetScissor().
+//  2026-10-19: Vulkan: Added ImGui_ImplVulkan_GetCallbackCommandBuffer() for user callbacks, which run inside a secondary command buffer with UseSecondaryCommandBuffers.
+//  2026-10-19: Vulkan: Added optional recording of draw lists into secondary command buffers (init_info->UseSecondaryCommandBuffers), split into contiguous ranges over worker threads (init_info->SecondaryCommandBufferThreads).
+//  2026-10-19: Vulkan: Added optional bindless texture mode (init_info->UseBindlessTextures): all textures share one descriptor array bound once per frame, the texture index is passed as a push constant. Redundant descriptor set binds are skipped in both modes.
+//  2026-10-19: Vulkan: Added optional on-disk pipeline cache (init_info->PipelineCacheFilename), validated against vendor/device/cache UUID, and optional pipeline creation on a worker thread (init_info->UseAsyncPipelineCreation).
+//  2026-10-19: Vulkan: Vertex/index data are sub-allocated from one persistently mapped arena per in-flight frame, grown geometrically and shrunk when oversized, instead of recreating and mapping two buffers.
 //  2023-07-04: Vulkan: Added optional support for VK_KHR_dynamic_rendering. User needs to set init_info->UseDynamicRendering = true and init_info->ColorAttachmentFormat.
 //  2023-01-02: Vulkan: Fixed sampler passed to ImGui_ImplVulkan_AddTexture() not being honored + removed a bunch of duplicate code.
 //  2022-10-11: Using 'nullptr' instead of 'NULL' as per our switch to C++11.
@@ -69,10 +75,18 @@
 //  2016-10-18: Vulkan: Add location decorators & change to use structs as in/out in glsl, update embedded spv (produced with glslangValidator -x). Null the released resources.
 //  2016-08-27: Vulkan: Fix Vulkan example for use when a depth buffer is active.
 
+#if defined(_MSC_VER) && !defined(_CRT_SECURE_NO_WARNINGS)
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
 #include "imgui.h"
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_vulkan.h"
 #include <stdio.h>
+#include <string.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -80,15 +94,74 @@
 #endif
 
 // Reusable buffers used for rendering 1 current in-flight frame, for ImGui_ImplVulkan_RenderDrawData()
+// Vertices and indices are sub-allocated from a single host-visible arena which stays mapped for its whole lifetime:
+// vertices start at offset 0, indices follow at IndexOffset, then with UseMultiDrawIndirect one indirect entry per draw command
+// at IndirectOffset. The arena grows geometrically, and is shrunk back
+// when its high-water mark stayed well under capacity for IMGUI_IMPL_VULKAN_ARENA_SHRINK_FRAMES uses.
 // [Please zero-clear before use!]
 struct ImGui_ImplVulkanH_FrameRenderBuffers
 {
-    VkDeviceMemory      VertexBufferMemory;
-    VkDeviceMemory      IndexBufferMemory;
-    VkDeviceSize        VertexBufferSize;
-    VkDeviceSize        IndexBufferSize;
-    VkBuffer            VertexBuffer;
-    VkBuffer            IndexBuffer;
+    VkDeviceMemory      BufferMemory;
+    VkDeviceSize        BufferMemorySize;   // Size of the allocation (>= BufferSize)
+    VkDeviceSize        BufferSize;         // Usable capacity of the arena
+    VkBuffer            Buffer;             // VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT (| VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT)
+    void*               BufferMapped;
+    bool                BufferCoherent;     // Memory is HOST_COHERENT: no need to call vkFlushMappedMemoryRanges()
+    VkDeviceSize        IndexOffset;        // Start of the index region for the frame being recorded
+    VkDeviceSize        IndirectOffset;     // Start of the indirect entries for the frame being recorded (UseMultiDrawIndirect)
+    VkDeviceSize        HighWaterSize;      // Largest size used since the last shrink check
+    uint32_t            HighWaterFrames;    // Number of uses since the last shrink check
+    VkCommandPool*      SecondaryCommandPools;      // UseSecondaryCommandBuffers: one pool per recording thread, reset when this frame comes around again
+    VkCommandBuffer*    SecondaryCommandBuffers;    // One secondary command buffer allocated from each pool
+    uint32_t            SecondaryCommandBufferCount;
+};
+
+// Frame arena sizing
+#define IMGUI_IMPL_VULKAN_ARENA_MIN_SIZE        (64 * 1024)
+#define IMGUI_IMPL_VULKAN_ARENA_SHRINK_FRAMES   256     // Uses of an arena between two shrink checks
+
+// Draw data with fewer draw commands per recording thread than this is split over fewer threads
+#define IMGUI_IMPL_VULKAN_SECONDARY_MIN_CMDS    64
+
+// With UseMultiDrawIndirect, one entry per draw command of the frame (user callbacks included, left empty).
+// vkCmdDrawIndexedIndirect() reads Command, the vertex shader reads ClipRect as a per-instance attribute: firstInstance is the entry index.
+struct ImGui_ImplVulkan_DrawIndirectEntry
+{
+    VkDrawIndexedIndirectCommand    Command;
+    float                           ClipRect[4];    // Framebuffer space (x0, y0, x1, y1), as vkCmdSetScissor() would have used it
+};
+
+// A contiguous range of draw lists recorded into one command buffer, with the offsets of its first list in the merged vertex/index data
+struct ImGui_ImplVulkan_RecordJob
+{
+    ImDrawData*         DrawData;
+    VkCommandBuffer     CommandBuffer;
+    VkPipeline          Pipeline;
+    ImGui_ImplVulkanH_FrameRenderBuffers* RenderBuffers;
+    int                 FbWidth;
+    int                 FbHeight;
+    int                 CmdListBegin;
+    int                 CmdListEnd;
+    int                 GlobalVtxOffset;
+    int                 GlobalIdxOffset;
+    int                 GlobalCmdOffset;    // Index of the first indirect entry of the range
+    bool                MultiDrawIndirect;
+};
+
+// Worker threads for UseSecondaryCommandBuffers. RenderDrawData() publishes Jobs and bumps Generation,
+// worker N records Jobs[N + 1] while the calling thread records Jobs[0], then waits for Pending to reach 0.
+struct ImGui_ImplVulkan_RecordWorkers
+{
+    ImVector<std::thread*>              Threads;
+    std::mutex                          Mutex;
+    std::condition_variable             WorkCond;
+    std::condition_variable             DoneCond;
+    unsigned int                        Generation;
+    int                                 Pending;
+    bool                                Quit;
+    ImVector<ImGui_ImplVulkan_RecordJob> Jobs;
+
+    ImGui_ImplVulkan_RecordWorkers()    { Generation = 0; Pending = 0; Quit = false; }
 };
 
 // Each viewport will hold 1 ImGui_ImplVulkanH_WindowRenderBuffers
@@ -106,6 +179,7 @@ struct ImGui_ImplVulkan_Data
     ImGui_ImplVulkan_InitInfo   VulkanInitInfo;
     VkRenderPass                RenderPass;
     VkDeviceSize                BufferMemoryAlignment;
+    VkDeviceSize                NonCoherentAtomSize;
     VkPipelineCreateFlags       PipelineCreateFlags;
     VkDescriptorSetLayout       DescriptorSetLayout;
     VkPipelineLayout            PipelineLayout;
@@ -113,6 +187,20 @@ struct ImGui_ImplVulkan_Data
     uint32_t                    Subpass;
     VkShaderModule              ShaderModuleVert;
     VkShaderModule              ShaderModuleFrag;
+    VkPipelineCache             PipelineCacheOwned;     // Created from VulkanInitInfo.PipelineCacheFilename, saved and destroyed on shutdown
+    std::thread*                PipelineThread;         // Set while bd->Pipeline is being created asynchronously
+    VkResult                    PipelineThreadResult;
+    ImGui_ImplVulkan_RecordWorkers* RecordWorkers;      // Set when VulkanInitInfo.SecondaryCommandBufferThreads > 0
+    VkCommandBuffer             CallbackCommandBuffer;  // Command buffer being recorded while a user callback runs (see ImGui_ImplVulkan_GetCallbackCommandBuffer())
+    bool                        UseMultiDrawIndirect;   // VulkanInitInfo.UseMultiDrawIndirect and supported by the device
+    uint32_t                    MaxDrawIndirectCount;   // VkPhysicalDeviceLimits::maxDrawIndirectCount
+
+    // Bindless textures (when UseBindless is set, DescriptorSetLayout describes the texture array)
+    bool                        UseBindless;            // VulkanInitInfo.UseBindlessTextures and supported by the device
+    VkDescriptorPool            BindlessDescriptorPool;
+    VkDescriptorSet             BindlessDescriptorSet;
+    uint32_t                    BindlessSlotCount;      // Slots [0..BindlessSlotCount) have been handed out at least once
+    ImVector<uint32_t>          BindlessFreeSlots;      // Slots released by ImGui_ImplVulkan_RemoveTexture(), reused first
 
     // Font data
     VkSampler                   FontSampler;
@@ -130,6 +218,7 @@ struct ImGui_ImplVulkan_Data
     {
         memset((void*)this, 0, sizeof(*this));
         BufferMemoryAlignment = 256;
+        NonCoherentAtomSize = 256;
     }
 };
 
@@ -140,6 +229,7 @@ void ImGui_ImplVulkanH_DestroyFrame(VkDevice device, ImGui_ImplVulkanH_Frame* fd
 void ImGui_ImplVulkanH_DestroyFrameSemaphores(VkDevice device, ImGui_ImplVulkanH_FrameSemaphores* fsd, const VkAllocationCallbacks* allocator);
 void ImGui_ImplVulkanH_DestroyFrameRenderBuffers(VkDevice device, ImGui_ImplVulkanH_FrameRenderBuffers* buffers, const VkAllocationCallbacks* allocator);
 void ImGui_ImplVulkanH_DestroyWindowRenderBuffers(VkDevice device, ImGui_ImplVulkanH_WindowRenderBuffers* buffers, const VkAllocationCallbacks* allocator);
+static void ImGui_ImplVulkanH_DestroyFrameArena(VkDevice device, ImGui_ImplVulkanH_FrameRenderBuffers* buffers, const VkAllocationCallbacks* allocator);
 void ImGui_ImplVulkanH_CreateWindowSwapChain(VkPhysicalDevice physical_device, VkDevice device, ImGui_ImplVulkanH_Window* wd, const VkAllocationCallbacks* allocator, int w, int h, uint32_t min_image_count);
 void ImGui_ImplVulkanH_CreateWindowCommandBuffers(VkPhysicalDevice physical_device, VkDevice device, ImGui_ImplVulkanH_Window* wd, uint32_t queue_family, const VkAllocationCallbacks* allocator);
 
@@ -155,6 +245,7 @@ static bool g_FunctionsLoaded = true;
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkAllocateCommandBuffers) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkAllocateDescriptorSets) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkAllocateMemory) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkBeginCommandBuffer) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkBindBufferMemory) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkBindImageMemory) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdBindDescriptorSets) \
@@ -163,18 +254,22 @@ static bool g_FunctionsLoaded = true;
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdBindVertexBuffers) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdCopyBufferToImage) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdDrawIndexed) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdDrawIndexedIndirect) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdExecuteCommands) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdPipelineBarrier) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdPushConstants) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdSetScissor) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdSetViewport) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateBuffer) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateCommandPool) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateDescriptorPool) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateDescriptorSetLayout) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateFence) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateFramebuffer) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateGraphicsPipelines) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateImage) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateImageView) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreatePipelineCache) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreatePipelineLayout) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateRenderPass) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateSampler) \
@@ -183,12 +278,14 @@ static bool g_FunctionsLoaded = true;
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateSwapchainKHR) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyBuffer) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyCommandPool) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyDescriptorPool) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyDescriptorSetLayout) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyFence) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyFramebuffer) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyImage) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyImageView) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyPipeline) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyPipelineCache) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyPipelineLayout) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyRenderPass) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroySampler) \
@@ -197,18 +294,23 @@ static bool g_FunctionsLoaded = true;
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroySurfaceKHR) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroySwapchainKHR) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDeviceWaitIdle) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkEndCommandBuffer) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkFlushMappedMemoryRanges) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkFreeCommandBuffers) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkFreeDescriptorSets) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkFreeMemory) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetBufferMemoryRequirements) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetImageMemoryRequirements) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetPhysicalDeviceFeatures) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetPhysicalDeviceMemoryProperties) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetPhysicalDeviceProperties) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetPhysicalDeviceSurfaceCapabilitiesKHR) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetPhysicalDeviceSurfaceFormatsKHR) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetPhysicalDeviceSurfacePresentModesKHR) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetPipelineCacheData) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetSwapchainImagesKHR) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkMapMemory) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkResetCommandPool) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkUnmapMemory) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkUpdateDescriptorSets)
 
@@ -224,6 +326,17 @@ static PFN_vkCmdBeginRenderingKHR   ImGuiImplVulkanFuncs_vkCmdBeginRenderingKHR;
 static PFN_vkCmdEndRenderingKHR     ImGuiImplVulkanFuncs_vkCmdEndRenderingKHR;
 #endif
 
+// Bindless textures need descriptor indexing, and vkGetPhysicalDeviceFeatures2() to check for it
+#if (defined(VK_VERSION_1_2) || defined(VK_EXT_descriptor_indexing)) && (defined(VK_VERSION_1_1) || defined(VK_KHR_get_physical_device_properties2))
+#define IMGUI_IMPL_VULKAN_HAS_BINDLESS
+static PFN_vkGetPhysicalDeviceFeatures2KHR ImGuiImplVulkanFuncs_vkGetPhysicalDeviceFeatures2;
+#endif
+
+// Size of the texture array used by UseBindlessTextures (the array is partially bound: unused slots cost nothing at draw time)
+#ifndef IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES
+#define IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES 1024
+#endif
+
 //-----------------------------------------------------------------------------
 // SHADERS
 //-----------------------------------------------------------------------------
@@ -333,6 +446,246 @@ static uint32_t __glsl_shader_frag_spv[] =
     0x00010038
 };
 
+// glsl_shader_bindless.frag, compiled with Qt 6.12's shader baker (qsb, which embeds glslang), then extracting the SPIR-V words:
+// # qsb -o glsl_shader_bindless.frag.qsb glsl_shader_bindless.frag && qsb -x spirv,100 -o glsl_shader_bindless.frag.spv glsl_shader_bindless.frag.qsb
+// The glslangValidator line in generate_spv.sh gives the same instructions, plus debug names and possibly in another decoration order.
+// Used with UseBindlessTextures: shares the vertex shader, the texture index follows the vertex push constants.
+/*
+#version 450 core
+#extension GL_EXT_nonuniform_qualifier : require
+layout(location = 0) out vec4 fColor;
+layout(set=0, binding=0) uniform sampler2D sTextures[];
+layout(push_constant) uniform uPushConstant { layout(offset = 16) uint uTextureIndex; } pc;
+layout(location = 0) in struct { vec4 Color; vec2 UV; } In;
+void main()
+{
+    fColor = In.Color * texture(sTextures[pc.uTextureIndex], In.UV.st);
+}
+*/
+static uint32_t __glsl_shader_frag_bindless_spv[] =
+{
+    0x07230203,0x00010000,0x0008000b,0x00000028,0x00000000,0x00020011,0x00000001,0x00020011,
+    0x000014b6,0x0008000a,0x5f565053,0x5f545845,0x63736564,0x74706972,0x695f726f,0x7865646e,
+    0x00676e69,0x0006000b,0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,
+    0x00000000,0x00000001,0x0007000f,0x00000004,0x00000004,0x6e69616d,0x00000000,0x00000009,
+    0x0000000d,0x00030010,0x00000004,0x00000007,0x00040047,0x00000009,0x0000001e,0x00000000,
+    0x00040047,0x0000000d,0x0000001e,0x00000000,0x00040047,0x00000017,0x00000021,0x00000000,
+    0x00040047,0x00000017,0x00000022,0x00000000,0x00030047,0x00000019,0x00000002,0x00050048,
+    0x00000019,0x00000000,0x00000023,0x00000010,0x00020013,0x00000002,0x00030021,0x00000003,
+    0x00000002,0x00030016,0x00000006,0x00000020,0x00040017,0x00000007,0x00000006,0x00000004,
+    0x00040020,0x00000008,0x00000003,0x00000007,0x0004003b,0x00000008,0x00000009,0x00000003,
+    0x00040017,0x0000000a,0x00000006,0x00000002,0x0004001e,0x0000000b,0x00000007,0x0000000a,
+    0x00040020,0x0000000c,0x00000001,0x0000000b,0x0004003b,0x0000000c,0x0000000d,0x00000001,
+    0x00040015,0x0000000e,0x00000020,0x00000001,0x0004002b,0x0000000e,0x0000000f,0x00000000,
+    0x00040020,0x00000010,0x00000001,0x00000007,0x00090019,0x00000013,0x00000006,0x00000001,
+    0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x0003001b,0x00000014,0x00000013,
+    0x0003001d,0x00000015,0x00000014,0x00040020,0x00000016,0x00000000,0x00000015,0x0004003b,
+    0x00000016,0x00000017,0x00000000,0x00040015,0x00000018,0x00000020,0x00000000,0x0003001e,
+    0x00000019,0x00000018,0x00040020,0x0000001a,0x00000009,0x00000019,0x0004003b,0x0000001a,
+    0x0000001b,0x00000009,0x00040020,0x0000001c,0x00000009,0x00000018,0x00040020,0x0000001f,
+    0x00000000,0x00000014,0x0004002b,0x0000000e,0x00000022,0x00000001,0x00040020,0x00000023,
+    0x00000001,0x0000000a,0x00050036,0x00000002,0x00000004,0x00000000,0x00000003,0x000200f8,
+    0x00000005,0x00050041,0x00000010,0x00000011,0x0000000d,0x0000000f,0x0004003d,0x00000007,
+    0x00000012,0x00000011,0x00050041,0x0000001c,0x0000001d,0x0000001b,0x0000000f,0x0004003d,
+    0x00000018,0x0000001e,0x0000001d,0x00050041,0x0000001f,0x00000020,0x00000017,0x0000001e,
+    0x0004003d,0x00000014,0x00000021,0x00000020,0x00050041,0x00000023,0x00000024,0x0000000d,
+    0x00000022,0x0004003d,0x0000000a,0x00000025,0x00000024,0x00050057,0x00000007,0x00000026,
+    0x00000021,0x00000025,0x00050085,0x00000007,0x00000027,0x00000012,0x00000026,0x0003003e,
+    0x00000009,0x00000027,0x000100fd,0x00010038
+};
+
+// glsl_shader_clip.vert, compiled like glsl_shader_bindless.frag above:
+// # qsb -o glsl_shader_clip.vert.qsb glsl_shader_clip.vert && qsb -x spirv,100 -o glsl_shader_clip.vert.spv glsl_shader_clip.vert.qsb
+// Used with UseMultiDrawIndirect: the clip rectangle is an instanced attribute, read from the indirect entry selected by firstInstance.
+/*
+#version 450 core
+layout(location = 0) in vec2 aPos;
+layout(location = 1) in vec2 aUV;
+layout(location = 2) in vec4 aColor;
+layout(location = 3) in vec4 aClipRect;
+layout(push_constant) uniform uPushConstant { vec2 uScale; vec2 uTranslate; } pc;
+
+out gl_PerVertex { vec4 gl_Position; };
+layout(location = 0) out struct { vec4 Color; vec2 UV; } Out;
+layout(location = 2) flat out vec4 ClipRect;
+
+void main()
+{
+    Out.Color = aColor;
+    Out.UV = aUV;
+    ClipRect = aClipRect;
+    gl_Position = vec4(aPos * pc.uScale + pc.uTranslate, 0, 1);
+}
+*/
+static uint32_t __glsl_shader_vert_clip_spv[] =
+{
+    0x07230203,0x00010000,0x0008000b,0x00000031,0x00000000,0x00020011,0x00000001,0x0006000b,
+    0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
+    0x000c000f,0x00000000,0x00000004,0x6e69616d,0x00000000,0x0000000b,0x0000000f,0x00000015,
+    0x00000019,0x0000001a,0x0000001e,0x0000001f,0x00040047,0x0000000b,0x0000001e,0x00000000,
+    0x00040047,0x0000000f,0x0000001e,0x00000002,0x00040047,0x00000015,0x0000001e,0x00000001,
+    0x00030047,0x00000019,0x0000000e,0x00040047,0x00000019,0x0000001e,0x00000002,0x00040047,
+    0x0000001a,0x0000001e,0x00000003,0x00030047,0x0000001c,0x00000002,0x00050048,0x0000001c,
+    0x00000000,0x0000000b,0x00000000,0x00040047,0x0000001f,0x0000001e,0x00000000,0x00030047,
+    0x00000021,0x00000002,0x00050048,0x00000021,0x00000000,0x00000023,0x00000000,0x00050048,
+    0x00000021,0x00000001,0x00000023,0x00000008,0x00020013,0x00000002,0x00030021,0x00000003,
+    0x00000002,0x00030016,0x00000006,0x00000020,0x00040017,0x00000007,0x00000006,0x00000004,
+    0x00040017,0x00000008,0x00000006,0x00000002,0x0004001e,0x00000009,0x00000007,0x00000008,
+    0x00040020,0x0000000a,0x00000003,0x00000009,0x0004003b,0x0000000a,0x0000000b,0x00000003,
+    0x00040015,0x0000000c,0x00000020,0x00000001,0x0004002b,0x0000000c,0x0000000d,0x00000000,
+    0x00040020,0x0000000e,0x00000001,0x00000007,0x0004003b,0x0000000e,0x0000000f,0x00000001,
+    0x00040020,0x00000011,0x00000003,0x00000007,0x0004002b,0x0000000c,0x00000013,0x00000001,
+    0x00040020,0x00000014,0x00000001,0x00000008,0x0004003b,0x00000014,0x00000015,0x00000001,
+    0x00040020,0x00000017,0x00000003,0x00000008,0x0004003b,0x00000011,0x00000019,0x00000003,
+    0x0004003b,0x0000000e,0x0000001a,0x00000001,0x0003001e,0x0000001c,0x00000007,0x00040020,
+    0x0000001d,0x00000003,0x0000001c,0x0004003b,0x0000001d,0x0000001e,0x00000003,0x0004003b,
+    0x00000014,0x0000001f,0x00000001,0x0004001e,0x00000021,0x00000008,0x00000008,0x00040020,
+    0x00000022,0x00000009,0x00000021,0x0004003b,0x00000022,0x00000023,0x00000009,0x00040020,
+    0x00000024,0x00000009,0x00000008,0x0004002b,0x00000006,0x0000002b,0x00000000,0x0004002b,
+    0x00000006,0x0000002c,0x3f800000,0x00050036,0x00000002,0x00000004,0x00000000,0x00000003,
+    0x000200f8,0x00000005,0x0004003d,0x00000007,0x00000010,0x0000000f,0x00050041,0x00000011,
+    0x00000012,0x0000000b,0x0000000d,0x0003003e,0x00000012,0x00000010,0x0004003d,0x00000008,
+    0x00000016,0x00000015,0x00050041,0x00000017,0x00000018,0x0000000b,0x00000013,0x0003003e,
+    0x00000018,0x00000016,0x0004003d,0x00000007,0x0000001b,0x0000001a,0x0003003e,0x00000019,
+    0x0000001b,0x0004003d,0x00000008,0x00000020,0x0000001f,0x00050041,0x00000024,0x00000025,
+    0x00000023,0x0000000d,0x0004003d,0x00000008,0x00000026,0x00000025,0x00050085,0x00000008,
+    0x00000027,0x00000020,0x00000026,0x00050041,0x00000024,0x00000028,0x00000023,0x00000013,
+    0x0004003d,0x00000008,0x00000029,0x00000028,0x00050081,0x00000008,0x0000002a,0x00000027,
+    0x00000029,0x00050051,0x00000006,0x0000002d,0x0000002a,0x00000000,0x00050051,0x00000006,
+    0x0000002e,0x0000002a,0x00000001,0x00070050,0x00000007,0x0000002f,0x0000002d,0x0000002e,
+    0x0000002b,0x0000002c,0x00050041,0x00000011,0x00000030,0x0000001e,0x0000000d,0x0003003e,
+    0x00000030,0x0000002f,0x000100fd,0x00010038
+};
+
+// glsl_shader_clip.frag, compiled like glsl_shader_bindless.frag above:
+// # qsb -o glsl_shader_clip.frag.qsb glsl_shader_clip.frag && qsb -x spirv,100 -o glsl_shader_clip.frag.spv glsl_shader_clip.frag.qsb
+// Used with UseMultiDrawIndirect: discards outside the rectangle vkCmdSetScissor() would have been given. Samples first to keep derivatives in uniform control flow.
+/*
+#version 450 core
+layout(location = 0) out vec4 fColor;
+layout(set=0, binding=0) uniform sampler2D sTexture;
+layout(location = 0) in struct { vec4 Color; vec2 UV; } In;
+layout(location = 2) flat in vec4 ClipRect;
+void main()
+{
+    vec4 color = In.Color * texture(sTexture, In.UV.st);
+    if (any(bvec4(lessThan(gl_FragCoord.xy, ClipRect.xy), greaterThanEqual(gl_FragCoord.xy, ClipRect.zw))))
+        discard;
+    fColor = color;
+}
+*/
+static uint32_t __glsl_shader_frag_clip_spv[] =
+{
+    0x07230203,0x00010000,0x0008000b,0x00000039,0x00000000,0x00020011,0x00000001,0x0006000b,
+    0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
+    0x0009000f,0x00000004,0x00000004,0x6e69616d,0x00000000,0x0000000d,0x0000001e,0x00000021,
+    0x00000037,0x00030010,0x00000004,0x00000007,0x00040047,0x0000000d,0x0000001e,0x00000000,
+    0x00040047,0x00000016,0x00000021,0x00000000,0x00040047,0x00000016,0x00000022,0x00000000,
+    0x00040047,0x0000001e,0x0000000b,0x0000000f,0x00030047,0x00000021,0x0000000e,0x00040047,
+    0x00000021,0x0000001e,0x00000002,0x00040047,0x00000037,0x0000001e,0x00000000,0x00020013,
+    0x00000002,0x00030021,0x00000003,0x00000002,0x00030016,0x00000006,0x00000020,0x00040017,
+    0x00000007,0x00000006,0x00000004,0x00040020,0x00000008,0x00000007,0x00000007,0x00040017,
+    0x0000000a,0x00000006,0x00000002,0x0004001e,0x0000000b,0x00000007,0x0000000a,0x00040020,
+    0x0000000c,0x00000001,0x0000000b,0x0004003b,0x0000000c,0x0000000d,0x00000001,0x00040015,
+    0x0000000e,0x00000020,0x00000001,0x0004002b,0x0000000e,0x0000000f,0x00000000,0x00040020,
+    0x00000010,0x00000001,0x00000007,0x00090019,0x00000013,0x00000006,0x00000001,0x00000000,
+    0x00000000,0x00000000,0x00000001,0x00000000,0x0003001b,0x00000014,0x00000013,0x00040020,
+    0x00000015,0x00000000,0x00000014,0x0004003b,0x00000015,0x00000016,0x00000000,0x0004002b,
+    0x0000000e,0x00000018,0x00000001,0x00040020,0x00000019,0x00000001,0x0000000a,0x0004003b,
+    0x00000010,0x0000001e,0x00000001,0x0004003b,0x00000010,0x00000021,0x00000001,0x00020014,
+    0x00000024,0x00040017,0x00000025,0x00000024,0x00000002,0x00040017,0x0000002c,0x00000024,
+    0x00000004,0x00040020,0x00000036,0x00000003,0x00000007,0x0004003b,0x00000036,0x00000037,
+    0x00000003,0x00050036,0x00000002,0x00000004,0x00000000,0x00000003,0x000200f8,0x00000005,
+    0x0004003b,0x00000008,0x00000009,0x00000007,0x00050041,0x00000010,0x00000011,0x0000000d,
+    0x0000000f,0x0004003d,0x00000007,0x00000012,0x00000011,0x0004003d,0x00000014,0x00000017,
+    0x00000016,0x00050041,0x00000019,0x0000001a,0x0000000d,0x00000018,0x0004003d,0x0000000a,
+    0x0000001b,0x0000001a,0x00050057,0x00000007,0x0000001c,0x00000017,0x0000001b,0x00050085,
+    0x00000007,0x0000001d,0x00000012,0x0000001c,0x0003003e,0x00000009,0x0000001d,0x0004003d,
+    0x00000007,0x0000001f,0x0000001e,0x0007004f,0x0000000a,0x00000020,0x0000001f,0x0000001f,
+    0x00000000,0x00000001,0x0004003d,0x00000007,0x00000022,0x00000021,0x0007004f,0x0000000a,
+    0x00000023,0x00000022,0x00000022,0x00000000,0x00000001,0x000500b8,0x00000025,0x00000026,
+    0x00000020,0x00000023,0x0004003d,0x00000007,0x00000027,0x0000001e,0x0007004f,0x0000000a,
+    0x00000028,0x00000027,0x00000027,0x00000000,0x00000001,0x0004003d,0x00000007,0x00000029,
+    0x00000021,0x0007004f,0x0000000a,0x0000002a,0x00000029,0x00000029,0x00000002,0x00000003,
+    0x000500be,0x00000025,0x0000002b,0x00000028,0x0000002a,0x00050051,0x00000024,0x0000002d,
+    0x00000026,0x00000000,0x00050051,0x00000024,0x0000002e,0x00000026,0x00000001,0x00050051,
+    0x00000024,0x0000002f,0x0000002b,0x00000000,0x00050051,0x00000024,0x00000030,0x0000002b,
+    0x00000001,0x00070050,0x0000002c,0x00000031,0x0000002d,0x0000002e,0x0000002f,0x00000030,
+    0x0004009a,0x00000024,0x00000032,0x00000031,0x000300f7,0x00000034,0x00000000,0x000400fa,
+    0x00000032,0x00000033,0x00000034,0x000200f8,0x00000033,0x000100fc,0x000200f8,0x00000034,
+    0x0004003d,0x00000007,0x00000038,0x00000009,0x0003003e,0x00000037,0x00000038,0x000100fd,
+    0x00010038
+};
+
+// glsl_shader_bindless_clip.frag, compiled like glsl_shader_bindless.frag above:
+// # qsb -o glsl_shader_bindless_clip.frag.qsb glsl_shader_bindless_clip.frag && qsb -x spirv,100 -o glsl_shader_bindless_clip.frag.spv glsl_shader_bindless_clip.frag.qsb
+// Used with UseMultiDrawIndirect and UseBindlessTextures.
+/*
+#version 450 core
+#extension GL_EXT_nonuniform_qualifier : require
+layout(location = 0) out vec4 fColor;
+layout(set=0, binding=0) uniform sampler2D sTextures[];
+layout(push_constant) uniform uPushConstant { layout(offset = 16) uint uTextureIndex; } pc;
+layout(location = 0) in struct { vec4 Color; vec2 UV; } In;
+layout(location = 2) flat in vec4 ClipRect;
+void main()
+{
+    vec4 color = In.Color * texture(sTextures[pc.uTextureIndex], In.UV.st);
+    if (any(bvec4(lessThan(gl_FragCoord.xy, ClipRect.xy), greaterThanEqual(gl_FragCoord.xy, ClipRect.zw))))
+        discard;
+    fColor = color;
+}
+*/
+static uint32_t __glsl_shader_frag_bindless_clip_spv[] =
+{
+    0x07230203,0x00010000,0x0008000b,0x00000043,0x00000000,0x00020011,0x00000001,0x00020011,
+    0x000014b6,0x0008000a,0x5f565053,0x5f545845,0x63736564,0x74706972,0x695f726f,0x7865646e,
+    0x00676e69,0x0006000b,0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,
+    0x00000000,0x00000001,0x0009000f,0x00000004,0x00000004,0x6e69616d,0x00000000,0x0000000d,
+    0x00000028,0x0000002b,0x00000041,0x00030010,0x00000004,0x00000007,0x00040047,0x0000000d,
+    0x0000001e,0x00000000,0x00040047,0x00000017,0x00000021,0x00000000,0x00040047,0x00000017,
+    0x00000022,0x00000000,0x00030047,0x00000019,0x00000002,0x00050048,0x00000019,0x00000000,
+    0x00000023,0x00000010,0x00040047,0x00000028,0x0000000b,0x0000000f,0x00030047,0x0000002b,
+    0x0000000e,0x00040047,0x0000002b,0x0000001e,0x00000002,0x00040047,0x00000041,0x0000001e,
+    0x00000000,0x00020013,0x00000002,0x00030021,0x00000003,0x00000002,0x00030016,0x00000006,
+    0x00000020,0x00040017,0x00000007,0x00000006,0x00000004,0x00040020,0x00000008,0x00000007,
+    0x00000007,0x00040017,0x0000000a,0x00000006,0x00000002,0x0004001e,0x0000000b,0x00000007,
+    0x0000000a,0x00040020,0x0000000c,0x00000001,0x0000000b,0x0004003b,0x0000000c,0x0000000d,
+    0x00000001,0x00040015,0x0000000e,0x00000020,0x00000001,0x0004002b,0x0000000e,0x0000000f,
+    0x00000000,0x00040020,0x00000010,0x00000001,0x00000007,0x00090019,0x00000013,0x00000006,
+    0x00000001,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x0003001b,0x00000014,
+    0x00000013,0x0003001d,0x00000015,0x00000014,0x00040020,0x00000016,0x00000000,0x00000015,
+    0x0004003b,0x00000016,0x00000017,0x00000000,0x00040015,0x00000018,0x00000020,0x00000000,
+    0x0003001e,0x00000019,0x00000018,0x00040020,0x0000001a,0x00000009,0x00000019,0x0004003b,
+    0x0000001a,0x0000001b,0x00000009,0x00040020,0x0000001c,0x00000009,0x00000018,0x00040020,
+    0x0000001f,0x00000000,0x00000014,0x0004002b,0x0000000e,0x00000022,0x00000001,0x00040020,
+    0x00000023,0x00000001,0x0000000a,0x0004003b,0x00000010,0x00000028,0x00000001,0x0004003b,
+    0x00000010,0x0000002b,0x00000001,0x00020014,0x0000002e,0x00040017,0x0000002f,0x0000002e,
+    0x00000002,0x00040017,0x00000036,0x0000002e,0x00000004,0x00040020,0x00000040,0x00000003,
+    0x00000007,0x0004003b,0x00000040,0x00000041,0x00000003,0x00050036,0x00000002,0x00000004,
+    0x00000000,0x00000003,0x000200f8,0x00000005,0x0004003b,0x00000008,0x00000009,0x00000007,
+    0x00050041,0x00000010,0x00000011,0x0000000d,0x0000000f,0x0004003d,0x00000007,0x00000012,
+    0x00000011,0x00050041,0x0000001c,0x0000001d,0x0000001b,0x0000000f,0x0004003d,0x00000018,
+    0x0000001e,0x0000001d,0x00050041,0x0000001f,0x00000020,0x00000017,0x0000001e,0x0004003d,
+    0x00000014,0x00000021,0x00000020,0x00050041,0x00000023,0x00000024,0x0000000d,0x00000022,
+    0x0004003d,0x0000000a,0x00000025,0x00000024,0x00050057,0x00000007,0x00000026,0x00000021,
+    0x00000025,0x00050085,0x00000007,0x00000027,0x00000012,0x00000026,0x0003003e,0x00000009,
+    0x00000027,0x0004003d,0x00000007,0x00000029,0x00000028,0x0007004f,0x0000000a,0x0000002a,
+    0x00000029,0x00000029,0x00000000,0x00000001,0x0004003d,0x00000007,0x0000002c,0x0000002b,
+    0x0007004f,0x0000000a,0x0000002d,0x0000002c,0x0000002c,0x00000000,0x00000001,0x000500b8,
+    0x0000002f,0x00000030,0x0000002a,0x0000002d,0x0004003d,0x00000007,0x00000031,0x00000028,
+    0x0007004f,0x0000000a,0x00000032,0x00000031,0x00000031,0x00000000,0x00000001,0x0004003d,
+    0x00000007,0x00000033,0x0000002b,0x0007004f,0x0000000a,0x00000034,0x00000033,0x00000033,
+    0x00000002,0x00000003,0x000500be,0x0000002f,0x00000035,0x00000032,0x00000034,0x00050051,
+    0x0000002e,0x00000037,0x00000030,0x00000000,0x00050051,0x0000002e,0x00000038,0x00000030,
+    0x00000001,0x00050051,0x0000002e,0x00000039,0x00000035,0x00000000,0x00050051,0x0000002e,
+    0x0000003a,0x00000035,0x00000001,0x00070050,0x00000036,0x0000003b,0x00000037,0x00000038,
+    0x00000039,0x0000003a,0x0004009a,0x0000002e,0x0000003c,0x0000003b,0x000300f7,0x0000003e,
+    0x00000000,0x000400fa,0x0000003c,0x0000003d,0x0000003e,0x000200f8,0x0000003d,0x000100fc,
+    0x000200f8,0x0000003e,0x0004003d,0x00000007,0x00000042,0x00000009,0x0003003e,0x00000041,
+    0x00000042,0x000100fd,0x00010038
+};
+
 //-----------------------------------------------------------------------------
 // FUNCTIONS
 //-----------------------------------------------------------------------------
@@ -367,56 +720,105 @@ static void check_vk_result(VkResult err)
         v->CheckVkResultFn(err);
 }
 
-static void CreateOrResizeBuffer(VkBuffer& buffer, VkDeviceMemory& buffer_memory, VkDeviceSize& p_buffer_size, size_t new_size, VkBufferUsageFlagBits usage)
+// Wait for a pipeline created by ImGui_ImplVulkan_CreateDeviceObjects() with UseAsyncPipelineCreation.
+static void ImGui_ImplVulkan_WaitPipeline()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    if (bd->PipelineThread == nullptr)
+        return;
+    bd->PipelineThread->join();
+    IM_DELETE(bd->PipelineThread);
+    bd->PipelineThread = nullptr;
+    check_vk_result(bd->PipelineThreadResult);
+}
+
+// With UseBindless, texture handles are (slot + 1) so that a null ImTextureID stays invalid.
+static VkDescriptorSet ImGui_ImplVulkan_BindlessSlotToHandle(uint32_t slot)
+{
+    return (VkDescriptorSet)(uintptr_t)(slot + 1);
+}
+
+static uint32_t ImGui_ImplVulkan_BindlessHandleToSlot(VkDescriptorSet descriptor_set)
+{
+    uint32_t slot = (uint32_t)(uintptr_t)descriptor_set - 1;
+    IM_ASSERT(slot < IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES && "Not a texture returned by ImGui_ImplVulkan_AddTexture()!");
+    return slot;
+}
+
+static VkDeviceSize ImGui_ImplVulkan_AlignUp(VkDeviceSize size, VkDeviceSize alignment)
+{
+    return ((size + alignment - 1) / alignment) * alignment;
+}
+
+// (Re)create the arena of one in-flight frame. Caller guarantees the GPU is done with that frame (as for the swapchain image it renders to).
+static void CreateOrResizeFrameArena(ImGui_ImplVulkanH_FrameRenderBuffers* rb, VkDeviceSize new_size)
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
     VkResult err;
-    if (buffer != VK_NULL_HANDLE)
-        vkDestroyBuffer(v->Device, buffer, v->Allocator);
-    if (buffer_memory != VK_NULL_HANDLE)
-        vkFreeMemory(v->Device, buffer_memory, v->Allocator);
+    ImGui_ImplVulkanH_DestroyFrameArena(v->Device, rb, v->Allocator);
 
-    VkDeviceSize vertex_buffer_size_aligned = ((new_size - 1) / bd->BufferMemoryAlignment + 1) * bd->BufferMemoryAlignment;
     VkBufferCreateInfo buffer_info = {};
     buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    buffer_info.size = vertex_buffer_size_aligned;
-    buffer_info.usage = usage;
+    buffer_info.size = ImGui_ImplVulkan_AlignUp(new_size, bd->BufferMemoryAlignment);
+    buffer_info.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+    if (bd->UseMultiDrawIndirect)
+        buffer_info.usage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
     buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-    err = vkCreateBuffer(v->Device, &buffer_info, v->Allocator, &buffer);
+    err = vkCreateBuffer(v->Device, &buffer_info, v->Allocator, &rb->Buffer);
     check_vk_result(err);
 
+    // Prefer coherent memory so uploads don't need flushing, any host-visible type will do otherwise.
     VkMemoryRequirements req;
-    vkGetBufferMemoryRequirements(v->Device, buffer, &req);
+    vkGetBufferMemoryRequirements(v->Device, rb->Buffer, &req);
     bd->BufferMemoryAlignment = (bd->BufferMemoryAlignment > req.alignment) ? bd->BufferMemoryAlignment : req.alignment;
     VkMemoryAllocateInfo alloc_info = {};
     alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     alloc_info.allocationSize = req.size;
-    alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, req.memoryTypeBits);
-    err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &buffer_memory);
+    alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, req.memoryTypeBits);
+    rb->BufferCoherent = (alloc_info.memoryTypeIndex != 0xFFFFFFFF);
+    if (!rb->BufferCoherent)
+        alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, req.memoryTypeBits);
+    err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &rb->BufferMemory);
     check_vk_result(err);
 
-    err = vkBindBufferMemory(v->Device, buffer, buffer_memory, 0);
+    err = vkBindBufferMemory(v->Device, rb->Buffer, rb->BufferMemory, 0);
     check_vk_result(err);
-    p_buffer_size = req.size;
+    err = vkMapMemory(v->Device, rb->BufferMemory, 0, VK_WHOLE_SIZE, 0, &rb->BufferMapped);
+    check_vk_result(err);
+    rb->BufferMemorySize = req.size;
+    rb->BufferSize = buffer_info.size;
+    rb->HighWaterSize = 0;
+    rb->HighWaterFrames = 0;
 }
 
-static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline pipeline, VkCommandBuffer command_buffer, ImGui_ImplVulkanH_FrameRenderBuffers* rb, int fb_width, int fb_height)
+// Takes the backend data explicitly as it may run on a worker thread (UseSecondaryCommandBuffers)
+static void ImGui_ImplVulkan_SetupRenderState(ImGui_ImplVulkan_Data* bd, ImDrawData* draw_data, VkPipeline pipeline, VkCommandBuffer command_buffer, ImGui_ImplVulkanH_FrameRenderBuffers* rb, int fb_width, int fb_height, bool multi_draw_indirect)
 {
-    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
-
     // Bind pipeline:
     {
         vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
     }
 
+    // Bind texture array: with bindless textures this is the only descriptor set bind, draws only push a texture index
+    if (bd->UseBindless)
+    {
+        vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->PipelineLayout, 0, 1, &bd->BindlessDescriptorSet, 0, nullptr);
+    }
+
     // Bind Vertex And Index Buffer:
     if (draw_data->TotalVtxCount > 0)
     {
-        VkBuffer vertex_buffers[1] = { rb->VertexBuffer };
+        VkBuffer vertex_buffers[1] = { rb->Buffer };
         VkDeviceSize vertex_offset[1] = { 0 };
         vkCmdBindVertexBuffers(command_buffer, 0, 1, vertex_buffers, vertex_offset);
-        vkCmdBindIndexBuffer(command_buffer, rb->IndexBuffer, 0, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+        vkCmdBindIndexBuffer(command_buffer, rb->Buffer, rb->IndexOffset, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+        if (multi_draw_indirect)
+        {
+            // Per-instance clip rectangles are read from the indirect entries
+            VkDeviceSize indirect_offset[1] = { rb->IndirectOffset };
+            vkCmdBindVertexBuffers(command_buffer, 1, 1, vertex_buffers, indirect_offset);
+        }
     }
 
     // Setup viewport:
@@ -443,6 +845,348 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
         vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 0, sizeof(float) * 2, scale);
         vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 2, sizeof(float) * 2, translate);
     }
+
+    // Clipping happens in the fragment shader with indirect draws: scissor covers the whole framebuffer
+    if (multi_draw_indirect)
+    {
+        VkRect2D scissor = { { 0, 0 }, { (uint32_t)fb_width, (uint32_t)fb_height } };
+        vkCmdSetScissor(command_buffer, 0, 1, &scissor);
+    }
+}
+
+// Project a draw command's clipping rectangle into framebuffer space. Returns false when nothing is visible.
+static bool ImGui_ImplVulkan_GetScissor(const ImDrawCmd* pcmd, ImVec2 clip_off, ImVec2 clip_scale, int fb_width, int fb_height, VkRect2D* out_scissor)
+{
+    ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+    ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+
+    // Clamp to viewport as vkCmdSetScissor() won't accept values that are off bounds
+    if (clip_min.x < 0.0f) { clip_min.x = 0.0f; }
+    if (clip_min.y < 0.0f) { clip_min.y = 0.0f; }
+    if (clip_max.x > fb_width) { clip_max.x = (float)fb_width; }
+    if (clip_max.y > fb_height) { clip_max.y = (float)fb_height; }
+    if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+        return false;
+
+    out_scissor->offset.x = (int32_t)(clip_min.x);
+    out_scissor->offset.y = (int32_t)(clip_min.y);
+    out_scissor->extent.width = (uint32_t)(clip_max.x - clip_min.x);
+    out_scissor->extent.height = (uint32_t)(clip_max.y - clip_min.y);
+    return true;
+}
+
+// Issue the pending run of indirect entries [first, first + *count) with a single draw call
+static void ImGui_ImplVulkan_FlushMultiDraw(VkCommandBuffer command_buffer, ImGui_ImplVulkanH_FrameRenderBuffers* rb, uint32_t first, uint32_t* count)
+{
+    if (*count == 0)
+        return;
+    vkCmdDrawIndexedIndirect(command_buffer, rb->Buffer, rb->IndirectOffset + (VkDeviceSize)first * sizeof(ImGui_ImplVulkan_DrawIndirectEntry), *count, sizeof(ImGui_ImplVulkan_DrawIndirectEntry));
+    *count = 0;
+}
+
+// Record a range of draw lists, from ImGui_ImplVulkan_RenderDrawData() or a recording thread
+static void ImGui_ImplVulkan_RecordDrawLists(ImGui_ImplVulkan_Data* bd, const ImGui_ImplVulkan_RecordJob* job)
+{
+    ImDrawData* draw_data = job->DrawData;
+    VkCommandBuffer command_buffer = job->CommandBuffer;
+    VkPipeline pipeline = job->Pipeline;
+    ImGui_ImplVulkanH_FrameRenderBuffers* rb = job->RenderBuffers;
+    int fb_width = job->FbWidth;
+    int fb_height = job->FbHeight;
+    bool multi_draw_indirect = job->MultiDrawIndirect;
+
+    // Setup desired Vulkan state
+    ImGui_ImplVulkan_SetupRenderState(bd, draw_data, pipeline, command_buffer, rb, fb_width, fb_height, multi_draw_indirect);
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    // Render command lists
+    // (Because we merged all buffers into a single one, we maintain our own offset into them)
+    int global_vtx_offset = job->GlobalVtxOffset;
+    int global_idx_offset = job->GlobalIdxOffset;
+    uint32_t cmd_index = (uint32_t)job->GlobalCmdOffset;    // Index of the indirect entry of the current command
+    uint32_t multi_draw_first = 0, multi_draw_count = 0;    // Pending run of indirect entries
+    ImTextureID last_texture_id = ImTextureID();
+    for (int n = job->CmdListBegin; n < job->CmdListEnd; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++, cmd_index++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != nullptr)
+            {
+                ImGui_ImplVulkan_FlushMultiDraw(command_buffer, rb, multi_draw_first, &multi_draw_count);
+
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                    ImGui_ImplVulkan_SetupRenderState(bd, draw_data, pipeline, command_buffer, rb, fb_width, fb_height, multi_draw_indirect);
+                else
+                {
+                    // Draw data with user callbacks is always recorded on the calling thread (see ImGui_ImplVulkan_RenderDrawDataSecondary())
+                    bd->CallbackCommandBuffer = command_buffer;
+                    pcmd->UserCallback(cmd_list, pcmd);
+                    bd->CallbackCommandBuffer = VK_NULL_HANDLE;
+                    if (multi_draw_indirect)
+                    {
+                        // Without indirect draws every draw sets its own scissor, so callbacks are free to change it
+                        VkRect2D scissor = { { 0, 0 }, { (uint32_t)fb_width, (uint32_t)fb_height } };
+                        vkCmdSetScissor(command_buffer, 0, 1, &scissor);
+                    }
+                }
+                last_texture_id = ImTextureID(); // Callbacks may have bound anything
+            }
+            else
+            {
+                // Project scissor/clipping rectangles into framebuffer space and apply them
+                // (with indirect draws ImGui_ImplVulkan_RenderDrawData() stored them in the entries, commands clipped away have no indices)
+                VkRect2D scissor;
+                if (!multi_draw_indirect)
+                {
+                    if (!ImGui_ImplVulkan_GetScissor(pcmd, clip_off, clip_scale, fb_width, fb_height, &scissor))
+                        continue;
+                    vkCmdSetScissor(command_buffer, 0, 1, &scissor);
+                }
+
+                // Bind font or user texture, only when it differs from the previous draw
+                if (pcmd->TextureId != last_texture_id)
+                {
+                    ImGui_ImplVulkan_FlushMultiDraw(command_buffer, rb, multi_draw_first, &multi_draw_count);
+                    last_texture_id = pcmd->TextureId;
+                    if (bd->UseBindless)
+                    {
+                        uint32_t texture_slot = ImGui_ImplVulkan_BindlessHandleToSlot((VkDescriptorSet)pcmd->TextureId);
+                        vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, sizeof(float) * 4, sizeof(uint32_t), &texture_slot);
+                    }
+                    else
+                    {
+                        VkDescriptorSet desc_set[1] = { (VkDescriptorSet)pcmd->TextureId };
+                        if (sizeof(ImTextureID) < sizeof(ImU64))
+                        {
+                            // We don't support texture switches if ImTextureID hasn't been redefined to be 64-bit. Do a flaky check that other textures haven't been used.
+                            IM_ASSERT(pcmd->TextureId == (ImTextureID)bd->FontDescriptorSet);
+                            desc_set[0] = bd->FontDescriptorSet;
+                        }
+                        vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->PipelineLayout, 0, 1, desc_set, 0, nullptr);
+                    }
+                }
+
+                // Draw, or extend the pending run of indirect entries
+                if (multi_draw_indirect)
+                {
+                    if (multi_draw_count == 0)
+                        multi_draw_first = cmd_index;
+                    if (++multi_draw_count == bd->MaxDrawIndirectCount)
+                        ImGui_ImplVulkan_FlushMultiDraw(command_buffer, rb, multi_draw_first, &multi_draw_count);
+                }
+                else
+                {
+                    vkCmdDrawIndexed(command_buffer, pcmd->ElemCount, 1, pcmd->IdxOffset + global_idx_offset, pcmd->VtxOffset + global_vtx_offset, 0);
+                }
+            }
+        }
+        global_idx_offset += cmd_list->IdxBuffer.Size;
+        global_vtx_offset += cmd_list->VtxBuffer.Size;
+    }
+    ImGui_ImplVulkan_FlushMultiDraw(command_buffer, rb, multi_draw_first, &multi_draw_count);
+}
+
+// Record a job into its secondary command buffer. Secondaries don't inherit any state, so each one sets up the full render state.
+static void ImGui_ImplVulkan_RecordSecondary(ImGui_ImplVulkan_Data* bd, const ImGui_ImplVulkan_RecordJob* job)
+{
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    VkCommandBufferInheritanceInfo inheritance_info = {};
+    inheritance_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritance_info.renderPass = bd->RenderPass;
+    inheritance_info.subpass = bd->Subpass;
+#ifdef IMGUI_IMPL_VULKAN_HAS_DYNAMIC_RENDERING
+    VkCommandBufferInheritanceRenderingInfoKHR inheritance_rendering_info = {};
+    inheritance_rendering_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO_KHR;
+    inheritance_rendering_info.colorAttachmentCount = 1;
+    inheritance_rendering_info.pColorAttachmentFormats = &v->ColorAttachmentFormat;
+    inheritance_rendering_info.rasterizationSamples = (v->MSAASamples != 0) ? v->MSAASamples : VK_SAMPLE_COUNT_1_BIT;
+    if (v->UseDynamicRendering)
+    {
+        inheritance_info.pNext = &inheritance_rendering_info;
+        inheritance_info.renderPass = VK_NULL_HANDLE;
+    }
+#endif
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    begin_info.pInheritanceInfo = &inheritance_info;
+    VkResult err = vkBeginCommandBuffer(job->CommandBuffer, &begin_info);
+    if (err == VK_SUCCESS)
+    {
+        ImGui_ImplVulkan_RecordDrawLists(bd, job);
+        err = vkEndCommandBuffer(job->CommandBuffer);
+    }
+    if (err != VK_SUCCESS && v->CheckVkResultFn)
+        v->CheckVkResultFn(err);
+}
+
+static void ImGui_ImplVulkan_RecordWorkerMain(ImGui_ImplVulkan_Data* bd, ImGui_ImplVulkan_RecordWorkers* workers, int worker_index)
+{
+    unsigned int generation = 0;
+    for (;;)
+    {
+        std::unique_lock<std::mutex> lock(workers->Mutex);
+        workers->WorkCond.wait(lock, [&]() { return workers->Quit || workers->Generation != generation; });
+        if (workers->Quit)
+            return;
+        generation = workers->Generation;
+        const int job_index = worker_index + 1;
+        lock.unlock();
+        if (job_index < workers->Jobs.Size)
+            ImGui_ImplVulkan_RecordSecondary(bd, &workers->Jobs[job_index]);
+        lock.lock();
+        if (--workers->Pending == 0)
+            workers->DoneCond.notify_one();
+    }
+}
+
+static void ImGui_ImplVulkan_CreateRecordWorkers()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_RecordWorkers* workers = IM_NEW(ImGui_ImplVulkan_RecordWorkers)();
+    for (uint32_t n = 0; n < bd->VulkanInitInfo.SecondaryCommandBufferThreads; n++)
+        workers->Threads.push_back(IM_NEW(std::thread)(ImGui_ImplVulkan_RecordWorkerMain, bd, workers, (int)n));
+    bd->RecordWorkers = workers;
+}
+
+static void ImGui_ImplVulkan_DestroyRecordWorkers()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_RecordWorkers* workers = bd->RecordWorkers;
+    if (workers == nullptr)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(workers->Mutex);
+        workers->Quit = true;
+    }
+    workers->WorkCond.notify_all();
+    for (std::thread* thread : workers->Threads)
+    {
+        thread->join();
+        IM_DELETE(thread);
+    }
+    IM_DELETE(workers);
+    bd->RecordWorkers = nullptr;
+}
+
+// Create the per-thread command pools of one in-flight frame on first use, or reset them: the GPU is done with that frame (as for its vertex/index arena).
+static void ImGui_ImplVulkan_PrepareSecondaryCommandBuffers(ImGui_ImplVulkan_Data* bd, ImGui_ImplVulkanH_FrameRenderBuffers* rb, uint32_t count)
+{
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    VkResult err;
+    if (rb->SecondaryCommandBufferCount == 0)
+    {
+        rb->SecondaryCommandPools = (VkCommandPool*)IM_ALLOC(sizeof(VkCommandPool) * count);
+        rb->SecondaryCommandBuffers = (VkCommandBuffer*)IM_ALLOC(sizeof(VkCommandBuffer) * count);
+        rb->SecondaryCommandBufferCount = count;
+        for (uint32_t n = 0; n < count; n++)
+        {
+            VkCommandPoolCreateInfo pool_info = {};
+            pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            pool_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+            pool_info.queueFamilyIndex = v->QueueFamily;
+            err = vkCreateCommandPool(v->Device, &pool_info, v->Allocator, &rb->SecondaryCommandPools[n]);
+            check_vk_result(err);
+            VkCommandBufferAllocateInfo alloc_info = {};
+            alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            alloc_info.commandPool = rb->SecondaryCommandPools[n];
+            alloc_info.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            alloc_info.commandBufferCount = 1;
+            err = vkAllocateCommandBuffers(v->Device, &alloc_info, &rb->SecondaryCommandBuffers[n]);
+            check_vk_result(err);
+        }
+        return;
+    }
+    IM_ASSERT(count <= rb->SecondaryCommandBufferCount);
+    for (uint32_t n = 0; n < count; n++)
+    {
+        err = vkResetCommandPool(v->Device, rb->SecondaryCommandPools[n], 0);
+        check_vk_result(err);
+    }
+}
+
+// Split the draw lists into contiguous ranges of similar command counts, record them into secondary command buffers
+// (on worker threads if any) and execute them in submission order.
+static void ImGui_ImplVulkan_RenderDrawDataSecondary(ImGui_ImplVulkan_Data* bd, const ImGui_ImplVulkan_RecordJob& full_job)
+{
+    ImDrawData* draw_data = full_job.DrawData;
+    ImGui_ImplVulkan_RecordWorkers* workers = bd->RecordWorkers;
+
+    // User callbacks expect to run on the thread owning the Dear ImGui context: keep everything on this thread if there are any
+    int total_cmds = 0;
+    bool has_user_callbacks = false;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        total_cmds += cmd_list->CmdBuffer.Size;
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size && !has_user_callbacks; cmd_i++)
+            if (cmd_list->CmdBuffer.Data[cmd_i].UserCallback != nullptr && cmd_list->CmdBuffer.Data[cmd_i].UserCallback != ImDrawCallback_ResetRenderState)
+                has_user_callbacks = true;
+    }
+    int job_count = 1;
+    if (workers != nullptr && !has_user_callbacks)
+    {
+        job_count = workers->Threads.Size + 1;
+        if (job_count > draw_data->CmdListsCount)
+            job_count = draw_data->CmdListsCount;
+        if (job_count > total_cmds / IMGUI_IMPL_VULKAN_SECONDARY_MIN_CMDS)
+            job_count = total_cmds / IMGUI_IMPL_VULKAN_SECONDARY_MIN_CMDS;
+        if (job_count < 1)
+            job_count = 1;
+    }
+    ImGui_ImplVulkanH_FrameRenderBuffers* rb = full_job.RenderBuffers;
+    ImGui_ImplVulkan_PrepareSecondaryCommandBuffers(bd, rb, workers ? (uint32_t)workers->Threads.Size + 1 : 1);
+
+    // Build jobs. Workers are idle here (the previous RenderDrawData() waited for them) so we can write to their job list.
+    ImVector<ImGui_ImplVulkan_RecordJob> local_jobs;
+    ImVector<ImGui_ImplVulkan_RecordJob>& jobs = workers ? workers->Jobs : local_jobs;
+    jobs.resize(job_count);
+    int list_n = 0, cmds_done = 0, vtx_offset = 0, idx_offset = 0;
+    for (int job_n = 0; job_n < job_count; job_n++)
+    {
+        ImGui_ImplVulkan_RecordJob& job = jobs[job_n];
+        job = full_job; // Overwrite every field: the workers' list keeps the jobs of the previous frame, which point to another frame's buffers
+        job.CommandBuffer = rb->SecondaryCommandBuffers[job_n];
+        job.CmdListBegin = list_n;
+        job.GlobalVtxOffset = vtx_offset;
+        job.GlobalIdxOffset = idx_offset;
+        job.GlobalCmdOffset = cmds_done;
+        const int cmds_target = (int)((ImS64)total_cmds * (job_n + 1) / job_count);
+        const int list_end_max = draw_data->CmdListsCount - (job_count - job_n - 1); // Leave at least one list to each following job
+        while (list_n < list_end_max && (list_n == job.CmdListBegin || cmds_done < cmds_target || job_n == job_count - 1))
+        {
+            const ImDrawList* cmd_list = draw_data->CmdLists[list_n++];
+            cmds_done += cmd_list->CmdBuffer.Size;
+            vtx_offset += cmd_list->VtxBuffer.Size;
+            idx_offset += cmd_list->IdxBuffer.Size;
+        }
+        job.CmdListEnd = list_n;
+    }
+
+    // Kick workers, record the first range ourselves, then wait
+    if (job_count > 1)
+    {
+        {
+            std::lock_guard<std::mutex> lock(workers->Mutex);
+            workers->Generation++;
+            workers->Pending = workers->Threads.Size;
+        }
+        workers->WorkCond.notify_all();
+    }
+    ImGui_ImplVulkan_RecordSecondary(bd, &jobs[0]);
+    if (job_count > 1)
+    {
+        std::unique_lock<std::mutex> lock(workers->Mutex);
+        workers->DoneCond.wait(lock, [&]() { return workers->Pending == 0; });
+    }
+    vkCmdExecuteCommands(full_job.CommandBuffer, (uint32_t)job_count, rb->SecondaryCommandBuffers);
 }
 
 // Render function
@@ -456,6 +1200,7 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
 
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    ImGui_ImplVulkan_WaitPipeline();
     if (pipeline == VK_NULL_HANDLE)
         pipeline = bd->Pipeline;
 
@@ -472,23 +1217,47 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
     wrb->Index = (wrb->Index + 1) % wrb->Count;
     ImGui_ImplVulkanH_FrameRenderBuffers* rb = &wrb->FrameRenderBuffers[wrb->Index];
 
+    // Indirect draws need our pipeline, whose vertex input reads the clip rectangles
+    const bool multi_draw_indirect = bd->UseMultiDrawIndirect && pipeline == bd->Pipeline && draw_data->TotalVtxCount > 0;
+    int total_cmd_count = 0;
+    if (multi_draw_indirect)
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+            total_cmd_count += draw_data->CmdLists[n]->CmdBuffer.Size;
+
     if (draw_data->TotalVtxCount > 0)
     {
-        // Create or resize the vertex/index buffers
-        size_t vertex_size = draw_data->TotalVtxCount * sizeof(ImDrawVert);
-        size_t index_size = draw_data->TotalIdxCount * sizeof(ImDrawIdx);
-        if (rb->VertexBuffer == VK_NULL_HANDLE || rb->VertexBufferSize < vertex_size)
-            CreateOrResizeBuffer(rb->VertexBuffer, rb->VertexBufferMemory, rb->VertexBufferSize, vertex_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
-        if (rb->IndexBuffer == VK_NULL_HANDLE || rb->IndexBufferSize < index_size)
-            CreateOrResizeBuffer(rb->IndexBuffer, rb->IndexBufferMemory, rb->IndexBufferSize, index_size, VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
-
-        // Upload vertex/index data into a single contiguous GPU buffer
-        ImDrawVert* vtx_dst = nullptr;
-        ImDrawIdx* idx_dst = nullptr;
-        VkResult err = vkMapMemory(v->Device, rb->VertexBufferMemory, 0, rb->VertexBufferSize, 0, (void**)(&vtx_dst));
-        check_vk_result(err);
-        err = vkMapMemory(v->Device, rb->IndexBufferMemory, 0, rb->IndexBufferSize, 0, (void**)(&idx_dst));
-        check_vk_result(err);
+        // Sub-allocate the vertex/index/indirect regions from this frame's arena
+        // (vkCmdBindIndexBuffer() requires the index offset to be a multiple of the index size, vkCmdDrawIndexedIndirect() a multiple of 4)
+        VkDeviceSize vertex_size = (VkDeviceSize)draw_data->TotalVtxCount * sizeof(ImDrawVert);
+        VkDeviceSize index_offset = ImGui_ImplVulkan_AlignUp(vertex_size, 4);
+        VkDeviceSize indirect_offset = ImGui_ImplVulkan_AlignUp(index_offset + (VkDeviceSize)draw_data->TotalIdxCount * sizeof(ImDrawIdx), 4);
+        VkDeviceSize arena_size = indirect_offset + (VkDeviceSize)total_cmd_count * sizeof(ImGui_ImplVulkan_DrawIndirectEntry);
+        if (rb->Buffer == VK_NULL_HANDLE || rb->BufferSize < arena_size)
+        {
+            // Grow geometrically so a UI slowly getting busier doesn't reallocate every few frames
+            VkDeviceSize new_size = rb->BufferSize ? rb->BufferSize : IMGUI_IMPL_VULKAN_ARENA_MIN_SIZE;
+            while (new_size < arena_size)
+                new_size *= 2;
+            CreateOrResizeFrameArena(rb, new_size);
+        }
+        else if (rb->HighWaterFrames >= IMGUI_IMPL_VULKAN_ARENA_SHRINK_FRAMES)
+        {
+            // Give memory back after a spike, once usage stayed under a quarter of the capacity for a whole period
+            // (this frame counts as part of the period: the new size must still fit it)
+            VkDeviceSize used_size = (rb->HighWaterSize > arena_size) ? rb->HighWaterSize : arena_size;
+            if (rb->BufferSize > IMGUI_IMPL_VULKAN_ARENA_MIN_SIZE && used_size * 4 <= rb->BufferSize)
+                CreateOrResizeFrameArena(rb, (used_size * 2 > IMGUI_IMPL_VULKAN_ARENA_MIN_SIZE) ? used_size * 2 : IMGUI_IMPL_VULKAN_ARENA_MIN_SIZE);
+            rb->HighWaterSize = 0;
+            rb->HighWaterFrames = 0;
+        }
+        rb->HighWaterSize = (rb->HighWaterSize > arena_size) ? rb->HighWaterSize : arena_size;
+        rb->HighWaterFrames++;
+        rb->IndexOffset = index_offset;
+        rb->IndirectOffset = indirect_offset;
+
+        // Upload vertex/index data into the persistently mapped arena
+        ImDrawVert* vtx_dst = (ImDrawVert*)rb->BufferMapped;
+        ImDrawIdx* idx_dst = (ImDrawIdx*)((char*)rb->BufferMapped + index_offset);
         for (int n = 0; n < draw_data->CmdListsCount; n++)
         {
             const ImDrawList* cmd_list = draw_data->CmdLists[n];
@@ -497,85 +1266,71 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
             vtx_dst += cmd_list->VtxBuffer.Size;
             idx_dst += cmd_list->IdxBuffer.Size;
         }
-        VkMappedMemoryRange range[2] = {};
-        range[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        range[0].memory = rb->VertexBufferMemory;
-        range[0].size = VK_WHOLE_SIZE;
-        range[1].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        range[1].memory = rb->IndexBufferMemory;
-        range[1].size = VK_WHOLE_SIZE;
-        err = vkFlushMappedMemoryRanges(v->Device, 2, range);
-        check_vk_result(err);
-        vkUnmapMemory(v->Device, rb->VertexBufferMemory);
-        vkUnmapMemory(v->Device, rb->IndexBufferMemory);
-    }
-
-    // Setup desired Vulkan state
-    ImGui_ImplVulkan_SetupRenderState(draw_data, pipeline, command_buffer, rb, fb_width, fb_height);
-
-    // Will project scissor/clipping rectangles into framebuffer space
-    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
-    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
-    // Render command lists
-    // (Because we merged all buffers into a single one, we maintain our own offset into them)
-    int global_vtx_offset = 0;
-    int global_idx_offset = 0;
-    for (int n = 0; n < draw_data->CmdListsCount; n++)
-    {
-        const ImDrawList* cmd_list = draw_data->CmdLists[n];
-        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        // Write one indirect entry per draw command, from the same data the per-command path passes to vkCmdSetScissor()/vkCmdDrawIndexed()
+        if (multi_draw_indirect)
         {
-            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
-            if (pcmd->UserCallback != nullptr)
-            {
-                // User callback, registered via ImDrawList::AddCallback()
-                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
-                if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
-                    ImGui_ImplVulkan_SetupRenderState(draw_data, pipeline, command_buffer, rb, fb_width, fb_height);
-                else
-                    pcmd->UserCallback(cmd_list, pcmd);
-            }
-            else
+            ImGui_ImplVulkan_DrawIndirectEntry* entries = (ImGui_ImplVulkan_DrawIndirectEntry*)((char*)rb->BufferMapped + indirect_offset);
+            uint32_t entry_n = 0, global_vtx_offset = 0, global_idx_offset = 0;
+            for (int n = 0; n < draw_data->CmdListsCount; n++)
             {
-                // Project scissor/clipping rectangles into framebuffer space
-                ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
-                ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
-
-                // Clamp to viewport as vkCmdSetScissor() won't accept values that are off bounds
-                if (clip_min.x < 0.0f) { clip_min.x = 0.0f; }
-                if (clip_min.y < 0.0f) { clip_min.y = 0.0f; }
-                if (clip_max.x > fb_width) { clip_max.x = (float)fb_width; }
-                if (clip_max.y > fb_height) { clip_max.y = (float)fb_height; }
-                if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
-                    continue;
-
-                // Apply scissor/clipping rectangle
-                VkRect2D scissor;
-                scissor.offset.x = (int32_t)(clip_min.x);
-                scissor.offset.y = (int32_t)(clip_min.y);
-                scissor.extent.width = (uint32_t)(clip_max.x - clip_min.x);
-                scissor.extent.height = (uint32_t)(clip_max.y - clip_min.y);
-                vkCmdSetScissor(command_buffer, 0, 1, &scissor);
-
-                // Bind DescriptorSet with font or user texture
-                VkDescriptorSet desc_set[1] = { (VkDescriptorSet)pcmd->TextureId };
-                if (sizeof(ImTextureID) < sizeof(ImU64))
+                const ImDrawList* cmd_list = draw_data->CmdLists[n];
+                for (const ImDrawCmd& cmd : cmd_list->CmdBuffer)
                 {
-                    // We don't support texture switches if ImTextureID hasn't been redefined to be 64-bit. Do a flaky check that other textures haven't been used.
-                    IM_ASSERT(pcmd->TextureId == (ImTextureID)bd->FontDescriptorSet);
-                    desc_set[0] = bd->FontDescriptorSet;
+                    VkRect2D scissor;
+                    const bool visible = cmd.UserCallback == nullptr && ImGui_ImplVulkan_GetScissor(&cmd, draw_data->DisplayPos, draw_data->FramebufferScale, fb_width, fb_height, &scissor);
+                    ImGui_ImplVulkan_DrawIndirectEntry* entry = &entries[entry_n];
+                    entry->Command.indexCount = visible ? cmd.ElemCount : 0;
+                    entry->Command.instanceCount = 1;
+                    entry->Command.firstIndex = cmd.IdxOffset + global_idx_offset;
+                    entry->Command.vertexOffset = (int32_t)(cmd.VtxOffset + global_vtx_offset);
+                    entry->Command.firstInstance = entry_n++;
+                    entry->ClipRect[0] = visible ? (float)scissor.offset.x : 0.0f;
+                    entry->ClipRect[1] = visible ? (float)scissor.offset.y : 0.0f;
+                    entry->ClipRect[2] = visible ? (float)(scissor.offset.x + (int32_t)scissor.extent.width) : 0.0f;
+                    entry->ClipRect[3] = visible ? (float)(scissor.offset.y + (int32_t)scissor.extent.height) : 0.0f;
                 }
-                vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->PipelineLayout, 0, 1, desc_set, 0, nullptr);
-
-                // Draw
-                vkCmdDrawIndexed(command_buffer, pcmd->ElemCount, 1, pcmd->IdxOffset + global_idx_offset, pcmd->VtxOffset + global_vtx_offset, 0);
+                global_vtx_offset += cmd_list->VtxBuffer.Size;
+                global_idx_offset += cmd_list->IdxBuffer.Size;
             }
         }
-        global_idx_offset += cmd_list->IdxBuffer.Size;
-        global_vtx_offset += cmd_list->VtxBuffer.Size;
+        if (!rb->BufferCoherent)
+        {
+            // Only flush what we wrote. Size must be a multiple of nonCoherentAtomSize or reach the end of the allocation.
+            VkMappedMemoryRange range = {};
+            range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+            range.memory = rb->BufferMemory;
+            range.offset = 0;
+            range.size = ImGui_ImplVulkan_AlignUp(arena_size, bd->NonCoherentAtomSize);
+            if (range.size >= rb->BufferMemorySize)
+                range.size = VK_WHOLE_SIZE;
+            VkResult err = vkFlushMappedMemoryRanges(v->Device, 1, &range);
+            check_vk_result(err);
+        }
     }
 
+    // Render command lists, inline or through secondary command buffers
+    ImGui_ImplVulkan_RecordJob job;
+    job.DrawData = draw_data;
+    job.CommandBuffer = command_buffer;
+    job.Pipeline = pipeline;
+    job.RenderBuffers = rb;
+    job.FbWidth = fb_width;
+    job.FbHeight = fb_height;
+    job.CmdListBegin = 0;
+    job.CmdListEnd = draw_data->CmdListsCount;
+    job.GlobalVtxOffset = 0;
+    job.GlobalIdxOffset = 0;
+    job.GlobalCmdOffset = 0;
+    job.MultiDrawIndirect = multi_draw_indirect;
+    if (v->UseSecondaryCommandBuffers)
+    {
+        // State set by secondary command buffers doesn't carry over to the primary one, no need to restore the scissor below.
+        ImGui_ImplVulkan_RenderDrawDataSecondary(bd, job);
+        return;
+    }
+    ImGui_ImplVulkan_RecordDrawLists(bd, &job);
+
     // Note: at this point both vkCmdSetViewport() and vkCmdSetScissor() have been called.
     // Our last values will leak into user/application rendering IF:
     // - Your app uses a pipeline with VK_DYNAMIC_STATE_VIEWPORT or VK_DYNAMIC_STATE_SCISSOR dynamic state
@@ -736,8 +1491,8 @@ static void ImGui_ImplVulkan_CreateShaderModules(VkDevice device, const VkAlloca
     {
         VkShaderModuleCreateInfo vert_info = {};
         vert_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        vert_info.codeSize = sizeof(__glsl_shader_vert_spv);
-        vert_info.pCode = (uint32_t*)__glsl_shader_vert_spv;
+        vert_info.codeSize = bd->UseMultiDrawIndirect ? sizeof(__glsl_shader_vert_clip_spv) : sizeof(__glsl_shader_vert_spv);
+        vert_info.pCode = bd->UseMultiDrawIndirect ? (uint32_t*)__glsl_shader_vert_clip_spv : (uint32_t*)__glsl_shader_vert_spv;
         VkResult err = vkCreateShaderModule(device, &vert_info, allocator, &bd->ShaderModuleVert);
         check_vk_result(err);
     }
@@ -745,18 +1500,24 @@ static void ImGui_ImplVulkan_CreateShaderModules(VkDevice device, const VkAlloca
     {
         VkShaderModuleCreateInfo frag_info = {};
         frag_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        frag_info.codeSize = sizeof(__glsl_shader_frag_spv);
-        frag_info.pCode = (uint32_t*)__glsl_shader_frag_spv;
+        if (bd->UseMultiDrawIndirect)
+        {
+            frag_info.codeSize = bd->UseBindless ? sizeof(__glsl_shader_frag_bindless_clip_spv) : sizeof(__glsl_shader_frag_clip_spv);
+            frag_info.pCode = bd->UseBindless ? (uint32_t*)__glsl_shader_frag_bindless_clip_spv : (uint32_t*)__glsl_shader_frag_clip_spv;
+        }
+        else
+        {
+            frag_info.codeSize = bd->UseBindless ? sizeof(__glsl_shader_frag_bindless_spv) : sizeof(__glsl_shader_frag_spv);
+            frag_info.pCode = bd->UseBindless ? (uint32_t*)__glsl_shader_frag_bindless_spv : (uint32_t*)__glsl_shader_frag_spv;
+        }
         VkResult err = vkCreateShaderModule(device, &frag_info, allocator, &bd->ShaderModuleFrag);
         check_vk_result(err);
     }
 }
 
-static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationCallbacks* allocator, VkPipelineCache pipelineCache, VkRenderPass renderPass, VkSampleCountFlagBits MSAASamples, VkPipeline* pipeline, uint32_t subpass)
+// Doesn't access the current Dear ImGui context, so it may run on a worker thread (shader modules and pipeline layout must already exist).
+static VkResult ImGui_ImplVulkan_CreatePipelineEx(ImGui_ImplVulkan_Data* bd, VkDevice device, const VkAllocationCallbacks* allocator, VkPipelineCache pipelineCache, VkRenderPass renderPass, VkSampleCountFlagBits MSAASamples, VkPipeline* pipeline, uint32_t subpass)
 {
-    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
-    ImGui_ImplVulkan_CreateShaderModules(device, allocator);
-
     VkPipelineShaderStageCreateInfo stage[2] = {};
     stage[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     stage[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
@@ -767,11 +1528,14 @@ static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationC
     stage[1].module = bd->ShaderModuleFrag;
     stage[1].pName = "main";
 
-    VkVertexInputBindingDescription binding_desc[1] = {};
+    VkVertexInputBindingDescription binding_desc[2] = {};
     binding_desc[0].stride = sizeof(ImDrawVert);
     binding_desc[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+    binding_desc[1].binding = 1;
+    binding_desc[1].stride = sizeof(ImGui_ImplVulkan_DrawIndirectEntry);
+    binding_desc[1].inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
 
-    VkVertexInputAttributeDescription attribute_desc[3] = {};
+    VkVertexInputAttributeDescription attribute_desc[4] = {};
     attribute_desc[0].location = 0;
     attribute_desc[0].binding = binding_desc[0].binding;
     attribute_desc[0].format = VK_FORMAT_R32G32_SFLOAT;
@@ -784,12 +1548,17 @@ static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationC
     attribute_desc[2].binding = binding_desc[0].binding;
     attribute_desc[2].format = VK_FORMAT_R8G8B8A8_UNORM;
     attribute_desc[2].offset = IM_OFFSETOF(ImDrawVert, col);
+    attribute_desc[3].location = 3;
+    attribute_desc[3].binding = binding_desc[1].binding;
+    attribute_desc[3].format = VK_FORMAT_R32G32B32A32_SFLOAT;
+    attribute_desc[3].offset = IM_OFFSETOF(ImGui_ImplVulkan_DrawIndirectEntry, ClipRect);
 
+    // With UseMultiDrawIndirect the clip rectangle of each draw comes from its indirect entry
     VkPipelineVertexInputStateCreateInfo vertex_info = {};
     vertex_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    vertex_info.vertexBindingDescriptionCount = 1;
+    vertex_info.vertexBindingDescriptionCount = bd->UseMultiDrawIndirect ? 2 : 1;
     vertex_info.pVertexBindingDescriptions = binding_desc;
-    vertex_info.vertexAttributeDescriptionCount = 3;
+    vertex_info.vertexAttributeDescriptionCount = bd->UseMultiDrawIndirect ? 4 : 3;
     vertex_info.pVertexAttributeDescriptions = attribute_desc;
 
     VkPipelineInputAssemblyStateCreateInfo ia_info = {};
@@ -865,10 +1634,105 @@ static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationC
     }
 #endif
 
-    VkResult err = vkCreateGraphicsPipelines(device, pipelineCache, 1, &info, allocator, pipeline);
+    return vkCreateGraphicsPipelines(device, pipelineCache, 1, &info, allocator, pipeline);
+}
+
+static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationCallbacks* allocator, VkPipelineCache pipelineCache, VkRenderPass renderPass, VkSampleCountFlagBits MSAASamples, VkPipeline* pipeline, uint32_t subpass)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_CreateShaderModules(device, allocator);
+    VkResult err = ImGui_ImplVulkan_CreatePipelineEx(bd, device, allocator, pipelineCache, renderPass, MSAASamples, pipeline, subpass);
     check_vk_result(err);
 }
 
+//-------------------------------------------------------------------------
+// Pipeline cache persistence
+//-------------------------------------------------------------------------
+// The file holds the raw vkGetPipelineCacheData() blob. Its header is checked against the current physical device
+// before being handed to the driver: a cache written by another GPU or driver version is simply ignored.
+
+static bool ImGui_ImplVulkan_PipelineCacheDataIsValid(const void* data, size_t data_size, const VkPhysicalDeviceProperties& properties)
+{
+    // Layout of VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+    struct Header { uint32_t HeaderSize; uint32_t HeaderVersion; uint32_t VendorID; uint32_t DeviceID; uint8_t PipelineCacheUUID[VK_UUID_SIZE]; };
+    Header header;
+    if (data_size < sizeof(header))
+        return false;
+    memcpy(&header, data, sizeof(header));
+    if (header.HeaderSize < sizeof(header) || header.HeaderSize > data_size || header.HeaderVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE)
+        return false;
+    if (header.VendorID != properties.vendorID || header.DeviceID != properties.deviceID)
+        return false;
+    return memcmp(header.PipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+static void ImGui_ImplVulkan_CreatePipelineCache(const VkPhysicalDeviceProperties& properties)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+
+    void* file_data = nullptr;
+    size_t file_size = 0;
+    if (FILE* f = fopen(v->PipelineCacheFilename, "rb"))
+    {
+        if (fseek(f, 0, SEEK_END) == 0)
+        {
+            long size = ftell(f);
+            if (size > 0 && fseek(f, 0, SEEK_SET) == 0)
+            {
+                file_data = IM_ALLOC((size_t)size);
+                file_size = fread(file_data, 1, (size_t)size, f);
+            }
+        }
+        fclose(f);
+    }
+
+    VkPipelineCacheCreateInfo info = {};
+    info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    if (file_data != nullptr && ImGui_ImplVulkan_PipelineCacheDataIsValid(file_data, file_size, properties))
+    {
+        info.initialDataSize = file_size;
+        info.pInitialData = file_data;
+    }
+    VkResult err = vkCreatePipelineCache(v->Device, &info, v->Allocator, &bd->PipelineCacheOwned);
+    if (err != VK_SUCCESS && info.pInitialData != nullptr)
+    {
+        // Driver rejected the blob anyway: start from an empty cache
+        info.initialDataSize = 0;
+        info.pInitialData = nullptr;
+        err = vkCreatePipelineCache(v->Device, &info, v->Allocator, &bd->PipelineCacheOwned);
+    }
+    check_vk_result(err);
+    if (file_data != nullptr)
+        IM_FREE(file_data);
+    if (err == VK_SUCCESS)
+        v->PipelineCache = bd->PipelineCacheOwned;
+}
+
+static void ImGui_ImplVulkan_DestroyPipelineCache()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    if (bd->PipelineCacheOwned == VK_NULL_HANDLE)
+        return;
+
+    size_t data_size = 0;
+    if (vkGetPipelineCacheData(v->Device, bd->PipelineCacheOwned, &data_size, nullptr) == VK_SUCCESS && data_size > 0)
+    {
+        void* data = IM_ALLOC(data_size);
+        if (vkGetPipelineCacheData(v->Device, bd->PipelineCacheOwned, &data_size, data) == VK_SUCCESS)
+            if (FILE* f = fopen(v->PipelineCacheFilename, "wb"))
+            {
+                fwrite(data, 1, data_size, f);
+                fclose(f);
+            }
+        IM_FREE(data);
+    }
+    vkDestroyPipelineCache(v->Device, bd->PipelineCacheOwned, v->Allocator);
+    bd->PipelineCacheOwned = VK_NULL_HANDLE;
+    v->PipelineCache = VK_NULL_HANDLE;
+}
+
 bool ImGui_ImplVulkan_CreateDeviceObjects()
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
@@ -903,29 +1767,87 @@ bool ImGui_ImplVulkan_CreateDeviceObjects()
         info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
         info.bindingCount = 1;
         info.pBindings = binding;
+#ifdef IMGUI_IMPL_VULKAN_HAS_BINDLESS
+        // Bindless: one array holding every texture. Slots may be left empty, and written after the set was bound, including while
+        // in-flight frames are still pending, as long as those frames don't use the slot being written (see ImGui_ImplVulkan_RemoveTexture()).
+        VkDescriptorBindingFlagsEXT binding_flags[1] = { VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT };
+        VkDescriptorSetLayoutBindingFlagsCreateInfoEXT binding_flags_info = {};
+        binding_flags_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+        binding_flags_info.bindingCount = 1;
+        binding_flags_info.pBindingFlags = binding_flags;
+        if (bd->UseBindless)
+        {
+            binding[0].descriptorCount = IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES;
+            info.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT;
+            info.pNext = &binding_flags_info;
+        }
+#endif
         err = vkCreateDescriptorSetLayout(v->Device, &info, v->Allocator, &bd->DescriptorSetLayout);
         check_vk_result(err);
     }
 
+#ifdef IMGUI_IMPL_VULKAN_HAS_BINDLESS
+    if (bd->UseBindless && !bd->BindlessDescriptorSet)
+    {
+        // The texture array needs an update-after-bind pool, so we don't allocate it from VulkanInitInfo.DescriptorPool
+        VkDescriptorPoolSize pool_size[1] = {};
+        pool_size[0].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        pool_size[0].descriptorCount = IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES;
+        VkDescriptorPoolCreateInfo pool_info = {};
+        pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT;
+        pool_info.maxSets = 1;
+        pool_info.poolSizeCount = 1;
+        pool_info.pPoolSizes = pool_size;
+        err = vkCreateDescriptorPool(v->Device, &pool_info, v->Allocator, &bd->BindlessDescriptorPool);
+        check_vk_result(err);
+
+        VkDescriptorSetAllocateInfo alloc_info = {};
+        alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        alloc_info.descriptorPool = bd->BindlessDescriptorPool;
+        alloc_info.descriptorSetCount = 1;
+        alloc_info.pSetLayouts = &bd->DescriptorSetLayout;
+        err = vkAllocateDescriptorSets(v->Device, &alloc_info, &bd->BindlessDescriptorSet);
+        check_vk_result(err);
+    }
+#endif
+
     if (!bd->PipelineLayout)
     {
         // Constants: we are using 'vec2 offset' and 'vec2 scale' instead of a full 3d projection matrix
-        VkPushConstantRange push_constants[1] = {};
+        // Bindless: the fragment shader additionally reads 'uint texture_index' right after them
+        VkPushConstantRange push_constants[2] = {};
         push_constants[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
         push_constants[0].offset = sizeof(float) * 0;
         push_constants[0].size = sizeof(float) * 4;
+        push_constants[1].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+        push_constants[1].offset = sizeof(float) * 4;
+        push_constants[1].size = sizeof(uint32_t);
         VkDescriptorSetLayout set_layout[1] = { bd->DescriptorSetLayout };
         VkPipelineLayoutCreateInfo layout_info = {};
         layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
         layout_info.setLayoutCount = 1;
         layout_info.pSetLayouts = set_layout;
-        layout_info.pushConstantRangeCount = 1;
+        layout_info.pushConstantRangeCount = bd->UseBindless ? 2 : 1;
         layout_info.pPushConstantRanges = push_constants;
         err = vkCreatePipelineLayout(v->Device, &layout_info, v->Allocator, &bd->PipelineLayout);
         check_vk_result(err);
     }
 
-    ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, v->PipelineCache, bd->RenderPass, v->MSAASamples, &bd->Pipeline, bd->Subpass);
+    if (v->UseAsyncPipelineCreation && bd->PipelineThread == nullptr)
+    {
+        // Compile on a worker thread while the app carries on with e.g. uploading fonts. Joined by the first ImGui_ImplVulkan_RenderDrawData().
+        ImGui_ImplVulkan_CreateShaderModules(v->Device, v->Allocator);
+        bd->PipelineThreadResult = VK_SUCCESS;
+        bd->PipelineThread = IM_NEW(std::thread)([bd, v]()
+        {
+            bd->PipelineThreadResult = ImGui_ImplVulkan_CreatePipelineEx(bd, v->Device, v->Allocator, v->PipelineCache, bd->RenderPass, v->MSAASamples, &bd->Pipeline, bd->Subpass);
+        });
+    }
+    else
+    {
+        ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, v->PipelineCache, bd->RenderPass, v->MSAASamples, &bd->Pipeline, bd->Subpass);
+    }
 
     return true;
 }
@@ -950,6 +1872,7 @@ void    ImGui_ImplVulkan_DestroyDeviceObjects()
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    ImGui_ImplVulkan_WaitPipeline();
     ImGui_ImplVulkanH_DestroyWindowRenderBuffers(v->Device, &bd->MainWindowRenderBuffers, v->Allocator);
     ImGui_ImplVulkan_DestroyFontUploadObjects();
 
@@ -960,8 +1883,11 @@ void    ImGui_ImplVulkan_DestroyDeviceObjects()
     if (bd->FontMemory)           { vkFreeMemory(v->Device, bd->FontMemory, v->Allocator); bd->FontMemory = VK_NULL_HANDLE; }
     if (bd->FontSampler)          { vkDestroySampler(v->Device, bd->FontSampler, v->Allocator); bd->FontSampler = VK_NULL_HANDLE; }
     if (bd->DescriptorSetLayout)  { vkDestroyDescriptorSetLayout(v->Device, bd->DescriptorSetLayout, v->Allocator); bd->DescriptorSetLayout = VK_NULL_HANDLE; }
+    if (bd->BindlessDescriptorPool) { vkDestroyDescriptorPool(v->Device, bd->BindlessDescriptorPool, v->Allocator); bd->BindlessDescriptorPool = VK_NULL_HANDLE; bd->BindlessDescriptorSet = VK_NULL_HANDLE; }
     if (bd->PipelineLayout)       { vkDestroyPipelineLayout(v->Device, bd->PipelineLayout, v->Allocator); bd->PipelineLayout = VK_NULL_HANDLE; }
     if (bd->Pipeline)             { vkDestroyPipeline(v->Device, bd->Pipeline, v->Allocator); bd->Pipeline = VK_NULL_HANDLE; }
+    bd->BindlessSlotCount = 0;
+    bd->BindlessFreeSlots.clear();
 }
 
 bool    ImGui_ImplVulkan_LoadFunctions(PFN_vkVoidFunction(*loader_func)(const char* function_name, void* user_data), void* user_data)
@@ -983,6 +1909,12 @@ bool    ImGui_ImplVulkan_LoadFunctions(PFN_vkVoidFunction(*loader_func)(const ch
     ImGuiImplVulkanFuncs_vkCmdBeginRenderingKHR = reinterpret_cast<PFN_vkCmdBeginRenderingKHR>(loader_func("vkCmdBeginRenderingKHR", user_data));
     ImGuiImplVulkanFuncs_vkCmdEndRenderingKHR = reinterpret_cast<PFN_vkCmdEndRenderingKHR>(loader_func("vkCmdEndRenderingKHR", user_data));
 #endif
+#ifdef IMGUI_IMPL_VULKAN_HAS_BINDLESS
+    // Optional: only used to check for bindless support, may be missing on a Vulkan 1.0 instance
+    ImGuiImplVulkanFuncs_vkGetPhysicalDeviceFeatures2 = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures2KHR>(loader_func("vkGetPhysicalDeviceFeatures2", user_data));
+    if (ImGuiImplVulkanFuncs_vkGetPhysicalDeviceFeatures2 == nullptr)
+        ImGuiImplVulkanFuncs_vkGetPhysicalDeviceFeatures2 = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures2KHR>(loader_func("vkGetPhysicalDeviceFeatures2KHR", user_data));
+#endif
 #else
     IM_UNUSED(loader_func);
     IM_UNUSED(user_data);
@@ -992,6 +1924,25 @@ bool    ImGui_ImplVulkan_LoadFunctions(PFN_vkVoidFunction(*loader_func)(const ch
     return true;
 }
 
+// Features required by UseBindlessTextures. We can only check that the device supports them, enabling them is up to the app.
+static bool ImGui_ImplVulkan_IsBindlessSupported(VkPhysicalDevice physical_device)
+{
+#ifdef IMGUI_IMPL_VULKAN_HAS_BINDLESS
+    if (ImGuiImplVulkanFuncs_vkGetPhysicalDeviceFeatures2 == nullptr)
+        return false;
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT indexing_features = {};
+    indexing_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+    VkPhysicalDeviceFeatures2KHR features = {};
+    features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+    features.pNext = &indexing_features;
+    ImGuiImplVulkanFuncs_vkGetPhysicalDeviceFeatures2(physical_device, &features);
+    return features.features.shaderSampledImageArrayDynamicIndexing && indexing_features.runtimeDescriptorArray && indexing_features.descriptorBindingPartiallyBound && indexing_features.descriptorBindingSampledImageUpdateAfterBind && indexing_features.descriptorBindingUpdateUnusedWhilePending;
+#else
+    IM_UNUSED(physical_device);
+    return false;
+#endif
+}
+
 bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info, VkRenderPass render_pass)
 {
     IM_ASSERT(g_FunctionsLoaded && "Need to call ImGui_ImplVulkan_LoadFunctions() if IMGUI_IMPL_VULKAN_NO_PROTOTYPES or VK_NO_PROTOTYPES are set!");
@@ -1009,6 +1960,14 @@ bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info, VkRenderPass rend
         IM_ASSERT(0 && "Can't use dynamic rendering when neither VK_VERSION_1_3 or VK_KHR_dynamic_rendering is defined.");
 #endif
     }
+#if defined(IMGUI_IMPL_VULKAN_HAS_BINDLESS) && !defined(VK_NO_PROTOTYPES)
+    if (info->UseBindlessTextures)
+    {
+        ImGuiImplVulkanFuncs_vkGetPhysicalDeviceFeatures2 = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures2KHR>(vkGetInstanceProcAddr(info->Instance, "vkGetPhysicalDeviceFeatures2"));
+        if (ImGuiImplVulkanFuncs_vkGetPhysicalDeviceFeatures2 == nullptr)
+            ImGuiImplVulkanFuncs_vkGetPhysicalDeviceFeatures2 = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures2KHR>(vkGetInstanceProcAddr(info->Instance, "vkGetPhysicalDeviceFeatures2KHR"));
+    }
+#endif
 
     ImGuiIO& io = ImGui::GetIO();
     IM_ASSERT(io.BackendRendererUserData == nullptr && "Already initialized a renderer backend!");
@@ -1032,8 +1991,26 @@ bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info, VkRenderPass rend
     bd->VulkanInitInfo = *info;
     bd->RenderPass = render_pass;
     bd->Subpass = info->Subpass;
+    bd->UseBindless = info->UseBindlessTextures && ImGui_ImplVulkan_IsBindlessSupported(info->PhysicalDevice);
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(info->PhysicalDevice, &properties);
+    if (properties.limits.nonCoherentAtomSize > 0)
+        bd->NonCoherentAtomSize = properties.limits.nonCoherentAtomSize;
+    if (info->UseMultiDrawIndirect)
+    {
+        // We can only check that the device supports them, enabling them is up to the app
+        VkPhysicalDeviceFeatures features;
+        vkGetPhysicalDeviceFeatures(info->PhysicalDevice, &features);
+        bd->UseMultiDrawIndirect = features.multiDrawIndirect && features.drawIndirectFirstInstance && properties.limits.maxDrawIndirectCount > 1;
+        bd->MaxDrawIndirectCount = properties.limits.maxDrawIndirectCount;
+    }
+    if (info->PipelineCacheFilename != nullptr && info->PipelineCache == VK_NULL_HANDLE)
+        ImGui_ImplVulkan_CreatePipelineCache(properties);
 
     ImGui_ImplVulkan_CreateDeviceObjects();
+    if (info->UseSecondaryCommandBuffers && info->SecondaryCommandBufferThreads > 0)
+        ImGui_ImplVulkan_CreateRecordWorkers();
 
     return true;
 }
@@ -1044,7 +2021,9 @@ void ImGui_ImplVulkan_Shutdown()
     IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
     ImGuiIO& io = ImGui::GetIO();
 
+    ImGui_ImplVulkan_DestroyRecordWorkers();
     ImGui_ImplVulkan_DestroyDeviceObjects();
+    ImGui_ImplVulkan_DestroyPipelineCache();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
     io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
@@ -1072,6 +2051,13 @@ void ImGui_ImplVulkan_SetMinImageCount(uint32_t min_image_count)
     bd->VulkanInitInfo.MinImageCount = min_image_count;
 }
 
+VkCommandBuffer ImGui_ImplVulkan_GetCallbackCommandBuffer()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    IM_ASSERT(bd != nullptr && bd->CallbackCommandBuffer != VK_NULL_HANDLE && "Only call from an ImDrawCallback, while ImGui_ImplVulkan_RenderDrawData() runs!");
+    return bd->CallbackCommandBuffer;
+}
+
 // Register a texture
 // FIXME: This is experimental in the sense that we are unsure how to best design/tackle this problem, please post to https://github.com/ocornut/imgui/pull/914 if you have suggestions.
 VkDescriptorSet ImGui_ImplVulkan_AddTexture(VkSampler sampler, VkImageView image_view, VkImageLayout image_layout)
@@ -1079,6 +2065,35 @@ VkDescriptorSet ImGui_ImplVulkan_AddTexture(VkSampler sampler, VkImageView image
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
 
+    // Bindless: write the texture into a free slot of the shared array
+    if (bd->UseBindless)
+    {
+        uint32_t slot;
+        if (!bd->BindlessFreeSlots.empty())
+        {
+            slot = bd->BindlessFreeSlots.back();
+            bd->BindlessFreeSlots.pop_back();
+        }
+        else
+        {
+            IM_ASSERT(bd->BindlessSlotCount < IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES && "Too many textures, increase IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES.");
+            slot = bd->BindlessSlotCount++;
+        }
+        VkDescriptorImageInfo desc_image[1] = {};
+        desc_image[0].sampler = sampler;
+        desc_image[0].imageView = image_view;
+        desc_image[0].imageLayout = image_layout;
+        VkWriteDescriptorSet write_desc[1] = {};
+        write_desc[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write_desc[0].dstSet = bd->BindlessDescriptorSet;
+        write_desc[0].dstArrayElement = slot;
+        write_desc[0].descriptorCount = 1;
+        write_desc[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        write_desc[0].pImageInfo = desc_image;
+        vkUpdateDescriptorSets(v->Device, 1, write_desc, 0, nullptr);
+        return ImGui_ImplVulkan_BindlessSlotToHandle(slot);
+    }
+
     // Create Descriptor Set:
     VkDescriptorSet descriptor_set;
     {
@@ -1112,6 +2127,16 @@ void ImGui_ImplVulkan_RemoveTexture(VkDescriptorSet descriptor_set)
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+
+    // Bindless: the slot is simply reused by a later ImGui_ImplVulkan_AddTexture() (same rule as freeing a set: the GPU must be done with it)
+    if (bd->UseBindless)
+    {
+        uint32_t slot = ImGui_ImplVulkan_BindlessHandleToSlot(descriptor_set);
+        IM_ASSERT(slot < bd->BindlessSlotCount && "Not a texture returned by ImGui_ImplVulkan_AddTexture()!");
+        IM_ASSERT(!bd->BindlessFreeSlots.contains(slot) && "Texture already removed!");
+        bd->BindlessFreeSlots.push_back(slot);
+        return;
+    }
     vkFreeDescriptorSets(v->Device, v->DescriptorPool, 1, &descriptor_set);
 }
 
@@ -1479,14 +2504,26 @@ void ImGui_ImplVulkanH_DestroyFrameSemaphores(VkDevice device, ImGui_ImplVulkanH
     fsd->ImageAcquiredSemaphore = fsd->RenderCompleteSemaphore = VK_NULL_HANDLE;
 }
 
+static void ImGui_ImplVulkanH_DestroyFrameArena(VkDevice device, ImGui_ImplVulkanH_FrameRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
+{
+    if (buffers->BufferMapped) { vkUnmapMemory(device, buffers->BufferMemory); buffers->BufferMapped = nullptr; }
+    if (buffers->Buffer) { vkDestroyBuffer(device, buffers->Buffer, allocator); buffers->Buffer = VK_NULL_HANDLE; }
+    if (buffers->BufferMemory) { vkFreeMemory(device, buffers->BufferMemory, allocator); buffers->BufferMemory = VK_NULL_HANDLE; }
+    buffers->BufferMemorySize = 0;
+    buffers->BufferSize = 0;
+    buffers->IndexOffset = 0;
+}
+
 void ImGui_ImplVulkanH_DestroyFrameRenderBuffers(VkDevice device, ImGui_ImplVulkanH_FrameRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
 {
-    if (buffers->VertexBuffer) { vkDestroyBuffer(device, buffers->VertexBuffer, allocator); buffers->VertexBuffer = VK_NULL_HANDLE; }
-    if (buffers->VertexBufferMemory) { vkFreeMemory(device, buffers->VertexBufferMemory, allocator); buffers->VertexBufferMemory = VK_NULL_HANDLE; }
-    if (buffers->IndexBuffer) { vkDestroyBuffer(device, buffers->IndexBuffer, allocator); buffers->IndexBuffer = VK_NULL_HANDLE; }
-    if (buffers->IndexBufferMemory) { vkFreeMemory(device, buffers->IndexBufferMemory, allocator); buffers->IndexBufferMemory = VK_NULL_HANDLE; }
-    buffers->VertexBufferSize = 0;
-    buffers->IndexBufferSize = 0;
+    ImGui_ImplVulkanH_DestroyFrameArena(device, buffers, allocator);
+    for (uint32_t n = 0; n < buffers->SecondaryCommandBufferCount; n++)
+        vkDestroyCommandPool(device, buffers->SecondaryCommandPools[n], allocator); // Also frees the command buffer allocated from it
+    IM_FREE(buffers->SecondaryCommandPools);
+    IM_FREE(buffers->SecondaryCommandBuffers);
+    buffers->SecondaryCommandPools = nullptr;
+    buffers->SecondaryCommandBuffers = nullptr;
+    buffers->SecondaryCommandBufferCount = 0;
 }
 
 void ImGui_ImplVulkanH_DestroyWindowRenderBuffers(VkDevice device, ImGui_ImplVulkanH_WindowRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
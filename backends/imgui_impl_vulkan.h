@@ -68,6 +68,22 @@ struct ImGui_ImplVulkan_InitInfo
     bool                            UseDynamicRendering;    // Need to explicitly enable VK_KHR_dynamic_rendering extension to use this, even for Vulkan 1.3.
     VkFormat                        ColorAttachmentFormat;  // Required for dynamic rendering
 
+    // Startup (Optional)
+    const char*                     PipelineCacheFilename;  // When PipelineCache is VK_NULL_HANDLE: backend owns a cache loaded from/saved to this file (must stay valid until Shutdown). Files from another device/driver are ignored.
+    bool                            UseAsyncPipelineCreation; // Create the pipeline on a worker thread during Init(), joined by the first RenderDrawData().
+
+    // Bindless Textures (Optional)
+    bool                            UseBindlessTextures;    // All textures live in one descriptor array bound once per frame, ImTextureID carries an index. Need to enable runtimeDescriptorArray, descriptorBindingPartiallyBound, descriptorBindingSampledImageUpdateAfterBind, descriptorBindingUpdateUnusedWhilePending (VK_EXT_descriptor_indexing or Vulkan 1.2) and shaderSampledImageArrayDynamicIndexing. Silently falls back to one descriptor set per texture when the device doesn't support them.
+
+    // Parallel Recording (Optional)
+    bool                            UseSecondaryCommandBuffers;     // RenderDrawData() records draw lists into secondary command buffers executed in order from the one you pass. Begin the render pass/subpass with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS (VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT with dynamic rendering).
+    uint32_t                        SecondaryCommandBufferThreads;  // Worker threads recording contiguous ranges of draw lists alongside the calling thread (0: calling thread only). Draw data containing user callbacks is always recorded on the calling thread.
+    // With UseSecondaryCommandBuffers, ImDrawCallback user callbacks run while the backend is recording a secondary command buffer inside your render pass:
+    // record into ImGui_ImplVulkan_GetCallbackCommandBuffer(), never into the command buffer passed to RenderDrawData(), and don't begin/end render passes.
+
+    // Batched Draws (Optional)
+    bool                            UseMultiDrawIndirect;   // Consecutive draw commands sharing a texture are issued as one vkCmdDrawIndexedIndirect(), clipping in the fragment shader instead of with vkCmdSetScissor(). Need to enable multiDrawIndirect and drawIndirectFirstInstance. Silently falls back to one draw per command when the device doesn't support them, or when passing your own pipeline to RenderDrawData().
+
     // Allocation, Debugging
     const VkAllocationCallbacks*    Allocator;
     void                            (*CheckVkResultFn)(VkResult err);
@@ -81,10 +97,12 @@ IMGUI_IMPL_API void         ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_dat
 IMGUI_IMPL_API bool         ImGui_ImplVulkan_CreateFontsTexture(VkCommandBuffer command_buffer);
 IMGUI_IMPL_API void         ImGui_ImplVulkan_DestroyFontUploadObjects();
 IMGUI_IMPL_API void         ImGui_ImplVulkan_SetMinImageCount(uint32_t min_image_count); // To override MinImageCount after initialization (e.g. if swap chain is recreated)
+IMGUI_IMPL_API VkCommandBuffer ImGui_ImplVulkan_GetCallbackCommandBuffer();             // From an ImDrawCallback: command buffer being recorded (a secondary one with UseSecondaryCommandBuffers)
 
 // Register a texture (VkDescriptorSet == ImTextureID)
 // FIXME: This is experimental in the sense that we are unsure how to best design/tackle this problem
 // Please post to https://github.com/ocornut/imgui/pull/914 if you have suggestions.
+// With UseBindlessTextures the returned handle is not a real VkDescriptorSet but a slot index in the backend's texture array: only pass it back as ImTextureID or to ImGui_ImplVulkan_RemoveTexture().
 IMGUI_IMPL_API VkDescriptorSet ImGui_ImplVulkan_AddTexture(VkSampler sampler, VkImageView image_view, VkImageLayout image_layout);
 IMGUI_IMPL_API void            ImGui_ImplVulkan_RemoveTexture(VkDescriptorSet descriptor_set);
 
@@ -4,3 +4,7 @@
 ## -o: output file
 glslangValidator -V -x -o glsl_shader.frag.u32 glsl_shader.frag
 glslangValidator -V -x -o glsl_shader.vert.u32 glsl_shader.vert
+glslangValidator -V -x -o glsl_shader_bindless.frag.u32 glsl_shader_bindless.frag
+glslangValidator -V -x -o glsl_shader_clip.vert.u32 glsl_shader_clip.vert
+glslangValidator -V -x -o glsl_shader_clip.frag.u32 glsl_shader_clip.frag
+glslangValidator -V -x -o glsl_shader_bindless_clip.frag.u32 glsl_shader_bindless_clip.frag
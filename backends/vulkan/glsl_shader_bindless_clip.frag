@@ -0,0 +1,24 @@
+#version 450 core
+#extension GL_EXT_nonuniform_qualifier : require
+layout(location = 0) out vec4 fColor;
+
+layout(set=0, binding=0) uniform sampler2D sTextures[];
+
+layout(push_constant) uniform uPushConstant {
+    layout(offset = 16) uint uTextureIndex;
+} pc;
+
+layout(location = 0) in struct {
+    vec4 Color;
+    vec2 UV;
+} In;
+
+layout(location = 2) flat in vec4 ClipRect;
+
+void main()
+{
+    vec4 color = In.Color * texture(sTextures[pc.uTextureIndex], In.UV.st);
+    if (any(bvec4(lessThan(gl_FragCoord.xy, ClipRect.xy), greaterThanEqual(gl_FragCoord.xy, ClipRect.zw))))
+        discard;
+    fColor = color;
+}
@@ -0,0 +1,648 @@
+#include "config.hpp"
+
+#include <string.h>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace config {
+
+    // On-disk layout (little endian, 4-byte aligned):
+    //   file_header
+    //   entry_header + payload (padded to 4 bytes), repeated entry_count times
+    static const char   file_magic[4] = { 'O', 'C', 'F', 'G' };
+    static const ImU32  file_version = 1;
+    static const char*  file_extension = ".cfg";
+
+    struct file_header
+    {
+        char    magic[4];
+        ImU32   version;
+        ImU32   entry_count;
+        ImU32   payload_size;   // Bytes following this header
+        ImU32   checksum;       // FNV-1a of the payload
+    };
+
+    struct entry_header
+    {
+        ImU32   name_hash;
+        ImU16   type;
+        ImU16   count;
+        ImU32   size;           // Payload bytes, excluding padding
+    };
+
+    struct var
+    {
+        std::string name;
+        ImU32       name_hash;
+        var_type    type;
+        int         count;
+        void*       ptr;
+        void*       ptr2;       // type_keybind: mode
+        ImU32       stage_offset;
+    };
+
+    enum job_kind { job_save, job_load, job_remove, job_scan };
+
+    struct job
+    {
+        job_kind            kind;
+        std::string         name;
+        std::vector<char>   blob;
+    };
+
+    struct result
+    {
+        job_kind                    kind;
+        bool                        ok = false;
+        std::string                 name;
+        std::vector<char>           stage;      // job_load: values in schema layout
+        std::vector<bool>           present;    // job_load: which schema entries were found in the file
+        std::vector<std::string>    files;      // job_scan
+    };
+
+    struct context
+    {
+        std::vector<var>            schema;
+        ImU32                       stage_size = 0;
+        std::string                 directory;
+
+        std::thread                 worker;
+        std::mutex                  mutex;
+        std::condition_variable     cond;
+        std::deque<job>             jobs;
+        std::deque<result>          results;
+        int                         pending = 0;
+        bool                        quit = false;
+        bool                        running = false;
+
+        std::vector<std::string>    index;
+        bool                        index_dirty = true;
+        bool                        index_scanning = false;
+    };
+
+    static context ctx;
+
+    //-----------------------------------------------------------------------------
+    // Helpers
+    //-----------------------------------------------------------------------------
+
+    static ImU32 fnv1a(const void* data, size_t size, ImU32 seed = 2166136261u)
+    {
+        const unsigned char* p = (const unsigned char*)data;
+        ImU32 h = seed;
+        for (size_t n = 0; n < size; n++)
+            h = (h ^ p[n]) * 16777619u;
+        return h;
+    }
+
+    static ImU32 type_size(var_type type)
+    {
+        switch (type)
+        {
+        case type_bool:     return 1;
+        case type_int:      return sizeof(int);
+        case type_float:    return sizeof(float);
+        case type_color:    return sizeof(ImVec4);
+        case type_keybind:  return sizeof(int) * 2;
+        }
+        return 0;
+    }
+
+    static ImU32 var_size(const var& v) { return type_size(v.type) * (ImU32)v.count; }
+    static ImU32 align4(ImU32 v) { return (v + 3) & ~3u; }
+
+    static bool valid_name(const char* name)
+    {
+        if (name == nullptr || name[0] == 0)
+            return false;
+        for (const char* p = name; *p; p++)
+            if (*p == '/' || *p == '\\' || *p == ':' || *p == '*' || *p == '?' || *p == '"' || *p == '<' || *p == '>' || *p == '|')
+                return false;
+        return strcmp(name, ".") != 0 && strcmp(name, "..") != 0;
+    }
+
+    static std::string file_path(const std::string& name, const char* suffix = file_extension)
+    {
+        return ctx.directory + "/" + name + suffix;
+    }
+
+    // Copy registered values <-> a flat buffer. Keybinds are split across two addresses.
+    static void read_var(const var& v, char* dst)
+    {
+        if (v.type == type_keybind)
+        {
+            memcpy(dst, v.ptr, sizeof(int));
+            memcpy(dst + sizeof(int), v.ptr2, sizeof(int));
+            return;
+        }
+        memcpy(dst, v.ptr, var_size(v));
+    }
+
+    static void write_var(const var& v, const char* src)
+    {
+        if (v.type == type_keybind)
+        {
+            memcpy(v.ptr, src, sizeof(int));
+            memcpy(v.ptr2, src + sizeof(int), sizeof(int));
+            return;
+        }
+        if (v.type == type_bool)
+        {
+            // Never trust a byte from disk to be a valid bool
+            bool* dst = (bool*)v.ptr;
+            for (int n = 0; n < v.count; n++)
+                dst[n] = src[n] != 0;
+            return;
+        }
+        memcpy(v.ptr, src, var_size(v));
+    }
+
+    //-----------------------------------------------------------------------------
+    // Platform: file mapping, atomic replace, directory listing
+    //-----------------------------------------------------------------------------
+
+    struct mapped_file
+    {
+        const char* data = nullptr;
+        size_t      size = 0;
+#ifdef _WIN32
+        HANDLE      file = INVALID_HANDLE_VALUE;
+        HANDLE      mapping = nullptr;
+#endif
+    };
+
+    static bool map_file(const std::string& path, mapped_file* out)
+    {
+#ifdef _WIN32
+        out->file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (out->file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER size;
+        if (!::GetFileSizeEx(out->file, &size) || size.QuadPart == 0)
+        {
+            ::CloseHandle(out->file);
+            return false;
+        }
+        out->mapping = ::CreateFileMappingA(out->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (out->mapping == nullptr)
+        {
+            ::CloseHandle(out->file);
+            return false;
+        }
+        out->data = (const char*)::MapViewOfFile(out->mapping, FILE_MAP_READ, 0, 0, 0);
+        out->size = (size_t)size.QuadPart;
+        if (out->data == nullptr)
+        {
+            ::CloseHandle(out->mapping);
+            ::CloseHandle(out->file);
+            return false;
+        }
+        return true;
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            ::close(fd);
+            return false;
+        }
+        void* data = ::mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED)
+            return false;
+        out->data = (const char*)data;
+        out->size = (size_t)st.st_size;
+        return true;
+#endif
+    }
+
+    static void unmap_file(mapped_file* f)
+    {
+#ifdef _WIN32
+        ::UnmapViewOfFile(f->data);
+        ::CloseHandle(f->mapping);
+        ::CloseHandle(f->file);
+#else
+        ::munmap((void*)f->data, f->size);
+#endif
+        f->data = nullptr;
+        f->size = 0;
+    }
+
+    // Write to a temporary file, flush it, then swap it over the destination so a crash never leaves a half-written config.
+    static bool write_file_atomic(const std::string& path, const std::vector<char>& blob)
+    {
+        const std::string tmp_path = path + ".tmp";
+#ifdef _WIN32
+        HANDLE file = ::CreateFileA(tmp_path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+        DWORD written = 0;
+        bool ok = ::WriteFile(file, blob.data(), (DWORD)blob.size(), &written, nullptr) && written == (DWORD)blob.size();
+        ok = ok && ::FlushFileBuffers(file);
+        ::CloseHandle(file);
+        ok = ok && ::MoveFileExA(tmp_path.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+        if (!ok)
+            ::DeleteFileA(tmp_path.c_str());
+        return ok;
+#else
+        int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0)
+            return false;
+        size_t done = 0;
+        while (done < blob.size())
+        {
+            ssize_t n = ::write(fd, blob.data() + done, blob.size() - done);
+            if (n <= 0)
+                break;
+            done += (size_t)n;
+        }
+        bool ok = done == blob.size() && ::fsync(fd) == 0;
+        ::close(fd);
+        ok = ok && ::rename(tmp_path.c_str(), path.c_str()) == 0;
+        if (!ok)
+            ::unlink(tmp_path.c_str());
+        return ok;
+#endif
+    }
+
+    static bool delete_file(const std::string& path)
+    {
+#ifdef _WIN32
+        return ::DeleteFileA(path.c_str()) != 0;
+#else
+        return ::unlink(path.c_str()) == 0;
+#endif
+    }
+
+    static void make_directory(const std::string& path)
+    {
+#ifdef _WIN32
+        ::CreateDirectoryA(path.c_str(), nullptr);
+#else
+        ::mkdir(path.c_str(), 0755);
+#endif
+    }
+
+    static std::vector<std::string> scan_directory(const std::string& path)
+    {
+        std::vector<std::string> out;
+        const size_t ext_len = strlen(file_extension);
+#ifdef _WIN32
+        WIN32_FIND_DATAA data;
+        HANDLE find = ::FindFirstFileA((path + "/*" + file_extension).c_str(), &data);
+        if (find != INVALID_HANDLE_VALUE)
+        {
+            do
+            {
+                if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+                    out.push_back(std::string(data.cFileName, strlen(data.cFileName) - ext_len));
+            } while (::FindNextFileA(find, &data));
+            ::FindClose(find);
+        }
+#else
+        if (DIR* dir = ::opendir(path.c_str()))
+        {
+            while (struct dirent* ent = ::readdir(dir))
+            {
+                const size_t len = strlen(ent->d_name);
+                if (len > ext_len && strcmp(ent->d_name + len - ext_len, file_extension) == 0)
+                    out.push_back(std::string(ent->d_name, len - ext_len));
+            }
+            ::closedir(dir);
+        }
+#endif
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Serialization
+    //-----------------------------------------------------------------------------
+
+    // Runs on the UI thread: one pass over the schema, no file access.
+    static void serialize(std::vector<char>* out)
+    {
+        ImU32 payload_size = 0;
+        for (const var& v : ctx.schema)
+            payload_size += (ImU32)sizeof(entry_header) + align4(var_size(v));
+
+        out->assign(sizeof(file_header) + payload_size, 0);
+        char* payload = out->data() + sizeof(file_header);
+        char* p = payload;
+        for (const var& v : ctx.schema)
+        {
+            entry_header eh;
+            eh.name_hash = v.name_hash;
+            eh.type = (ImU16)v.type;
+            eh.count = (ImU16)v.count;
+            eh.size = var_size(v);
+            memcpy(p, &eh, sizeof(eh));
+            read_var(v, p + sizeof(eh));
+            p += sizeof(eh) + align4(eh.size);
+        }
+
+        file_header fh;
+        memcpy(fh.magic, file_magic, sizeof(fh.magic));
+        fh.version = file_version;
+        fh.entry_count = (ImU32)ctx.schema.size();
+        fh.payload_size = payload_size;
+        fh.checksum = fnv1a(payload, payload_size);
+        memcpy(out->data(), &fh, sizeof(fh));
+    }
+
+    // Runs on the worker: validates the mapped file and copies matching entries into the schema-layout stage.
+    // The schema is immutable once init() has been called, so reading it here is safe.
+    static bool deserialize(const char* data, size_t size, result* out)
+    {
+        file_header fh;
+        if (size < sizeof(fh))
+            return false;
+        memcpy(&fh, data, sizeof(fh));
+        if (memcmp(fh.magic, file_magic, sizeof(fh.magic)) != 0 || fh.version == 0 || fh.version > file_version)
+            return false;
+        if (fh.payload_size > size - sizeof(fh))
+            return false;
+        const char* payload = data + sizeof(fh);
+        if (fnv1a(payload, fh.payload_size) != fh.checksum)
+            return false;
+
+        out->stage.assign(ctx.stage_size, 0);
+        out->present.assign(ctx.schema.size(), false);
+
+        const char* p = payload;
+        const char* end = payload + fh.payload_size;
+        for (ImU32 n = 0; n < fh.entry_count; n++)
+        {
+            entry_header eh;
+            if ((size_t)(end - p) < sizeof(eh))
+                return false;
+            memcpy(&eh, p, sizeof(eh));
+            p += sizeof(eh);
+            if ((size_t)(end - p) < eh.size)
+                return false;
+
+            // Schema check: name, type and size must all agree, anything else is skipped so old configs keep loading.
+            for (size_t i = 0; i < ctx.schema.size(); i++)
+            {
+                const var& v = ctx.schema[i];
+                if (v.name_hash != eh.name_hash || (ImU16)v.type != eh.type || var_size(v) != eh.size)
+                    continue;
+                memcpy(out->stage.data() + v.stage_offset, p, eh.size);
+                out->present[i] = true;
+                break;
+            }
+            p += std::min((size_t)align4(eh.size), (size_t)(end - p));
+        }
+        return true;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Worker
+    //-----------------------------------------------------------------------------
+
+    static void run_job(job& j, result* out)
+    {
+        out->kind = j.kind;
+        out->name = j.name;
+        switch (j.kind)
+        {
+        case job_save:
+            out->ok = write_file_atomic(file_path(j.name), j.blob);
+            break;
+        case job_load:
+        {
+            mapped_file f;
+            if (map_file(file_path(j.name), &f))
+            {
+                out->ok = deserialize(f.data, f.size, out);
+                unmap_file(&f);
+            }
+            break;
+        }
+        case job_remove:
+            out->ok = delete_file(file_path(j.name));
+            break;
+        case job_scan:
+            out->files = scan_directory(ctx.directory);
+            out->ok = true;
+            break;
+        }
+    }
+
+    static void worker_main()
+    {
+        std::unique_lock<std::mutex> lock(ctx.mutex);
+        for (;;)
+        {
+            ctx.cond.wait(lock, [] { return ctx.quit || !ctx.jobs.empty(); });
+            if (ctx.jobs.empty())
+                return;
+            job j = std::move(ctx.jobs.front());
+            ctx.jobs.pop_front();
+
+            lock.unlock();
+            result r;
+            run_job(j, &r);
+            lock.lock();
+
+            ctx.results.push_back(std::move(r));
+        }
+    }
+
+    static bool push_job(job_kind kind, const char* name, std::vector<char>* blob = nullptr)
+    {
+        IM_ASSERT(ctx.running && "config::init() must be called first");
+        if (!ctx.running)
+            return false;
+        job j;
+        j.kind = kind;
+        if (name)
+            j.name = name;
+        if (blob)
+            j.blob.swap(*blob);
+        {
+            std::lock_guard<std::mutex> lock(ctx.mutex);
+            ctx.jobs.push_back(std::move(j));
+            ctx.pending++;
+        }
+        ctx.cond.notify_one();
+        return true;
+    }
+
+    //-----------------------------------------------------------------------------
+    // API
+    //-----------------------------------------------------------------------------
+
+    void add(const char* name, var_type type, void* ptr, int count)
+    {
+        IM_ASSERT(!ctx.running && "Register every variable before config::init()");
+        IM_ASSERT(ptr != nullptr && count > 0 && count <= 0xFFFF);
+        var v;
+        v.name = name;
+        v.name_hash = fnv1a(name, strlen(name));
+        v.type = type;
+        v.count = count;
+        v.ptr = ptr;
+        v.ptr2 = nullptr;
+        v.stage_offset = ctx.stage_size;
+        for (const var& other : ctx.schema)
+            IM_ASSERT(other.name_hash != v.name_hash && "Duplicate (or colliding) config variable name");
+        ctx.stage_size += align4(var_size(v));
+        ctx.schema.push_back(v);
+    }
+
+    void add_keybind(const char* name, int* key, int* mode)
+    {
+        add(name, type_keybind, key, 1);
+        ctx.schema.back().ptr2 = mode;
+    }
+
+    void init(const char* directory)
+    {
+        IM_ASSERT(!ctx.running);
+        ctx.directory = directory;
+        make_directory(ctx.directory);
+        ctx.quit = false;
+        ctx.running = true;
+        ctx.worker = std::thread(worker_main);
+        refresh();
+    }
+
+    void shutdown()
+    {
+        if (!ctx.running)
+            return;
+        {
+            // Pending saves are drained before the worker exits
+            std::lock_guard<std::mutex> lock(ctx.mutex);
+            ctx.quit = true;
+        }
+        ctx.cond.notify_one();
+        ctx.worker.join();
+        ctx.running = false;
+        ctx.jobs.clear();
+        ctx.results.clear();
+        ctx.pending = 0;
+    }
+
+    bool update(event* out_event)
+    {
+        result r;
+        {
+            std::lock_guard<std::mutex> lock(ctx.mutex);
+            if (ctx.results.empty())
+                return false;
+            r = std::move(ctx.results.front());
+            ctx.results.pop_front();
+            ctx.pending--;
+        }
+
+        event e;
+        e.name = r.name;
+        e.type = r.ok ? event_none : event_failed;
+        switch (r.kind)
+        {
+        case job_save:
+            if (r.ok)
+            {
+                auto it = std::lower_bound(ctx.index.begin(), ctx.index.end(), r.name);
+                if (it == ctx.index.end() || *it != r.name)
+                    ctx.index.insert(it, r.name);
+                e.type = event_saved;
+            }
+            break;
+        case job_load:
+            if (r.ok)
+            {
+                for (size_t i = 0; i < ctx.schema.size(); i++)
+                    if (r.present[i])
+                        write_var(ctx.schema[i], r.stage.data() + ctx.schema[i].stage_offset);
+                e.type = event_loaded;
+            }
+            break;
+        case job_remove:
+            if (r.ok)
+                ctx.index.erase(std::remove(ctx.index.begin(), ctx.index.end(), r.name), ctx.index.end());
+            break;
+        case job_scan:
+            ctx.index.swap(r.files);
+            ctx.index_scanning = false;
+            break;
+        }
+        if (out_event)
+            *out_event = e;
+        return true;
+    }
+
+    bool create(const char* name)
+    {
+        if (!valid_name(name) || std::binary_search(ctx.index.begin(), ctx.index.end(), std::string(name)))
+            return false;
+        return save(name);
+    }
+
+    bool remove(const char* name)
+    {
+        if (!valid_name(name))
+            return false;
+        return push_job(job_remove, name);
+    }
+
+    bool load(const char* name)
+    {
+        if (!valid_name(name))
+            return false;
+        return push_job(job_load, name);
+    }
+
+    bool save(const char* name)
+    {
+        if (!valid_name(name))
+            return false;
+        std::vector<char> blob;
+        serialize(&blob);
+        return push_job(job_save, name, &blob);
+    }
+
+    bool busy()
+    {
+        std::lock_guard<std::mutex> lock(ctx.mutex);
+        return ctx.pending > 0;
+    }
+
+    const std::vector<std::string>& list()
+    {
+        if (ctx.index_dirty && ctx.running && !ctx.index_scanning)
+        {
+            ctx.index_dirty = false;
+            ctx.index_scanning = true;
+            push_job(job_scan, nullptr);
+        }
+        return ctx.index;
+    }
+
+    void refresh()
+    {
+        ctx.index_dirty = true;
+    }
+
+}
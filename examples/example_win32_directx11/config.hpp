@@ -0,0 +1,64 @@
+#pragma once
+
+#include "imgui.h"
+#include <string>
+#include <vector>
+
+// Binary config persistence for the menu.
+// - Variables are registered once into a schema (name + type + address).
+// - Files are a small versioned header followed by tagged entries, so configs written by an
+//   older/newer schema still load: unknown or mismatching entries are skipped, missing ones keep their value.
+// - Loading maps the file and validates it on a worker thread, the UI thread only applies a staged copy in update().
+// - Saving snapshots the values on the UI thread (a memcpy), then writes to "<name>.tmp" and atomically replaces "<name>.cfg".
+// - list() returns a cached directory index, rescanned only when marked dirty.
+namespace config {
+
+    enum var_type : ImU16
+    {
+        type_bool,
+        type_int,
+        type_float,
+        type_color,         // ImVec4
+        type_keybind,       // int key + int mode
+    };
+
+    enum event_type
+    {
+        event_none,
+        event_saved,
+        event_loaded,
+        event_failed,
+    };
+
+    struct event
+    {
+        event_type  type = event_none;
+        std::string name;
+    };
+
+    // Schema. 'count' > 1 registers an array (e.g. multi-select bool arrays).
+    void                add(const char* name, var_type type, void* ptr, int count = 1);
+    inline void         add(const char* name, bool* v, int count = 1)       { add(name, type_bool, v, count); }
+    inline void         add(const char* name, int* v, int count = 1)        { add(name, type_int, v, count); }
+    inline void         add(const char* name, float* v, int count = 1)      { add(name, type_float, v, count); }
+    inline void         add(const char* name, ImVec4* v, int count = 1)     { add(name, type_color, v, count); }
+    void                add_keybind(const char* name, int* key, int* mode);
+
+    // Lifetime. 'directory' is created if missing.
+    void                init(const char* directory);
+    void                shutdown();
+
+    // Call once per frame from the UI thread: applies finished loads and reports completed jobs.
+    bool                update(event* out_event = nullptr);
+
+    // All of these return immediately, the file work happens on the worker thread.
+    bool                create(const char* name);
+    bool                remove(const char* name);
+    bool                load(const char* name);
+    bool                save(const char* name);
+    bool                busy();
+
+    const std::vector<std::string>& list();
+    void                refresh();
+
+}
@@ -79,7 +79,7 @@ namespace combo {
 
         bool hovered, held, pressed = ButtonBehavior(bb, id, &hovered, &held);
 
-        static std::map<ImGuiID, begin_state> anim;
+        static IM_THREAD_LOCAL std::map<ImGuiID, begin_state> anim;
         begin_state& state = anim[id];
 
         if (hovered && g.IO.MouseClicked[0] || state.opened_combo && g.IO.MouseClicked[0] && !state.hovered) state.opened_combo = !state.opened_combo;
@@ -135,22 +135,33 @@ namespace combo {
     {
         ImGuiContext& g = *GImGui;
 
-        std::string preview = "None";
+        // Preview is rebuilt every frame, keep it in the frame arena rather than on the heap
+        size_t preview_len = 0;
+        for (auto i = 0; i < count; i++)
+            if (variable[i])
+                preview_len += strlen(labels[i]) + 2;
+
+        char* preview = (char*)MemAllocFrame(preview_len + 5);
+        memcpy(preview, "None", 5);
 
-        for (auto i = 0, j = 0; i < count; i++)
+        for (auto i = 0, j = 0, len = 0; i < count; i++)
         {
             if (variable[i])
             {
                 if (j)
-                    preview += (", ") + (std::string)labels[i];
-                else
-                    preview = labels[i];
+                {
+                    memcpy(preview + len, ", ", 2);
+                    len += 2;
+                }
+                const size_t label_len = strlen(labels[i]);
+                memcpy(preview + len, labels[i], label_len + 1);
+                len += (int)label_len;
 
                 j++;
             }
         }
 
-        if (BeginCombo(label, preview.c_str(), count, NULL, NULL))
+        if (BeginCombo(label, preview, count, NULL, NULL))
         {
             for (auto i = 0; i < count; i++)
             {
@@ -161,8 +172,6 @@ namespace combo {
             }
             End();
         }
-
-        preview = ("None");
     }
 
     bool BeginComboPreview()
@@ -17,6 +17,7 @@
 #include "images.h"
 #include <D3DX11tex.h>
 #include "imgui_combo.hpp"
+#include "config.hpp"
 #pragma comment(lib, "D3DX11.lib")
 // Data
 static ID3D11Device*            g_pd3dDevice = nullptr;
@@ -123,6 +124,103 @@ private:
 
 NotificationSystem notificationSystem;
 
+static void RegisterConfigVariables()
+{
+    config::add("features.check1", &features::check1);
+    config::add("features.check2", &features::check2);
+    config::add("features.check3", &features::check3);
+    config::add("features.check4", &features::check4);
+    config::add("features.check5", &features::check5);
+    config::add("features.check6", &features::check6);
+    config::add("features.check7", &features::check7);
+    config::add("features.sliderint", &features::sliderint);
+    config::add("features.sliderint2", &features::sliderint2);
+    config::add("features.sliderint3", &features::sliderint3);
+    config::add("features.sliderint4", &features::sliderint4);
+    config::add("features.selectedItem", &features::selectedItem);
+    config::add("features.selected", &features::selected);
+    config::add("features.fov_color", &features::fov_color);
+    config::add_keybind("features.key", &features::key, &features::mind);
+    config::add_keybind("features.key2", &features::key2, &features::mind2);
+    config::add_keybind("features.key3", &features::key3, &features::mind3);
+    config::add("features.multi", features::multi, IM_ARRAYSIZE(features::multi));
+    config::add("features.multi_esp", features::multi_esp, IM_ARRAYSIZE(features::multi_esp));
+    config::add("features.esp_perview", &features::esp_perview);
+    config::add("features.watermark", &features::watermark);
+
+    config::add("colors.accent_color", &colors::accent_color);
+    config::add("colors.menu.window_bg", &colors::menu::window_bg);
+    config::add("colors.menu.border", &colors::menu::border);
+    config::add("colors.menu.watermark_bg", &colors::menu::watermark_bg);
+    config::add("colors.menu.watermark_border", &colors::menu::watermark_border);
+    config::add("colors.menu.watermark_filled", &colors::menu::watermark_filled);
+    config::add("colors.child.child_background", &colors::child::child_background);
+    config::add("colors.child.child_top", &colors::child::child_top);
+    config::add("colors.child.child_rounding", &colors::child::child_rounding);
+    config::add("colors.checkbox.checkbox_bg_active", &colors::checkbox::checkbox_bg_active);
+    config::add("colors.checkbox.checkbox_bg_inactive", &colors::checkbox::checkbox_bg_inactive);
+    config::add("colors.checkbox.circle_inactive", &colors::checkbox::circle_inactive);
+    config::add("colors.slider.slider_inactive", &colors::slider::slider_inactive);
+    config::add("colors.combo.combo_bg", &colors::combo::combo_bg);
+    config::add("colors.color_picker.picker_bg", &colors::color_picker::picker_bg);
+    config::add("colors.binder.binder_bg", &colors::binder::binder_bg);
+    config::add("colors.button.button_bg", &colors::button::button_bg);
+    config::add("colors.input.input_bg", &colors::input::input_bg);
+    config::add("colors.preview.rect", &colors::preview::rect);
+    config::add("colors.preview.name", &colors::preview::name);
+    config::add("colors.preview.distance", &colors::preview::distance);
+    config::add("colors.preview.head", &colors::preview::head);
+    config::add("colors.preview.dice", &colors::preview::dice);
+}
+
+// Buttons only queue work, file access happens on the config worker so the frame never waits on disk.
+static void ConfigPanel()
+{
+    ImGui::InputTextWithHint("Text", "Config name", features::input, 64);
+
+    ImGui::BeginGroup(); {
+
+        if (ImGui::Button("Create Config", ImVec2(126, 30)) && !config::create(features::input))
+            notificationSystem.AddNotification("Invalid or existing config name", 2000);
+
+        ImGui::SameLine(0, 10);
+
+        if (ImGui::Button("Delete Config", ImVec2(126, 30)))
+            config::remove(features::input);
+
+    } ImGui::EndGroup();
+
+    ImGui::BeginGroup(); {
+
+        if (ImGui::Button("Load Config", ImVec2(126, 30)))
+            config::load(features::input);
+
+        ImGui::SameLine(0, 10);
+
+        if (ImGui::Button("Save Config", ImVec2(126, 30)))
+            config::save(features::input);
+
+    } ImGui::EndGroup();
+
+    for (const std::string& name : config::list())
+        if (ImGui::Selectable(name.c_str(), strcmp(name.c_str(), features::input) == 0))
+            strcpy_s(features::input, name.c_str());
+}
+
+static void ConfigUpdate()
+{
+    config::event e;
+    while (config::update(&e))
+    {
+        if (e.type == config::event_saved)
+            notificationSystem.AddNotification("Saved config " + e.name, 2000);
+        else if (e.type == config::event_loaded)
+            notificationSystem.AddNotification("Loaded config " + e.name, 2000);
+        else if (e.type == config::event_failed)
+            notificationSystem.AddNotification("Config operation failed: " + e.name, 2000);
+    }
+}
+
 // Main code
 int main(int, char**)
 {
@@ -170,6 +268,9 @@ int main(int, char**)
     fonts::combo_icon_font = io.Fonts->AddFontFromMemoryTTF(&combo_icon, sizeof combo_icon, 15, NULL, io.Fonts->GetGlyphRangesCyrillic());
     fonts::weapon_font = io.Fonts->AddFontFromMemoryTTF(&weapon, sizeof weapon, 15, NULL, io.Fonts->GetGlyphRangesCyrillic());
 
+    RegisterConfigVariables();
+    config::init("configs");
+
     // Our state
     bool show_demo_window = true;
     bool show_another_window = false;
@@ -206,6 +307,8 @@ int main(int, char**)
         ImGui_ImplWin32_NewFrame();
         ImGui::NewFrame();
 
+        ConfigUpdate();
+
         D3DX11_IMAGE_LOAD_INFO image; ID3DX11ThreadPump* pump{ nullptr };
 
        
@@ -510,27 +613,7 @@ int main(int, char**)
                     ImGui::BeginChildCustom(pictures::misc_img, "Configs", ImVec2(304, 300), false, ImGuiWindowFlags_NoScrollWithMouse);
                     {
 
-                        ImGui::InputTextWithHint("Text", "Config name", features::input, 64);
-
-                        ImGui::BeginGroup(); {
-
-                            ImGui::Button("Create Config", ImVec2(126, 30));
-
-                            ImGui::SameLine(0, 10);
-
-                            ImGui::Button("Delete Config", ImVec2(126, 30));
-
-                        } ImGui::EndGroup();                      
-
-                        ImGui::BeginGroup(); {
-
-                            ImGui::Button("Load Config", ImVec2(126, 30));
-
-                            ImGui::SameLine(0, 10);
-
-                            ImGui::Button("Save Config", ImVec2(126, 30));
-
-                        } ImGui::EndGroup();
+                        ConfigPanel();
 
                     }
                     ImGui::EndChildCustom();
@@ -601,27 +684,7 @@ int main(int, char**)
                         ImGui::BeginChildCustom(pictures::misc_img, "Configs", ImVec2(304, 430), false, ImGuiWindowFlags_NoScrollWithMouse);
                         {
 
-                            ImGui::InputTextWithHint("Text", "Config name", features::input, 64);
-
-                            ImGui::BeginGroup(); {
-
-                                ImGui::Button("Create Config", ImVec2(126, 30));
-
-                                ImGui::SameLine(0, 10);
-
-                                ImGui::Button("Delete Config", ImVec2(126, 30));
-
-                            } ImGui::EndGroup();
-
-                            ImGui::BeginGroup(); {
-
-                                ImGui::Button("Load Config", ImVec2(126, 30));
-
-                                ImGui::SameLine(0, 10);
-
-                                ImGui::Button("Save Config", ImVec2(126, 30));
-
-                            } ImGui::EndGroup();
+                            ConfigPanel();
 
                         }
                         ImGui::EndChildCustom();
@@ -778,6 +841,7 @@ int main(int, char**)
     }
 
     // Cleanup
+    config::shutdown();
     ImGui_ImplDX11_Shutdown();
     ImGui_ImplWin32_Shutdown();
     ImGui::DestroyContext();
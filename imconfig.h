@@ -35,6 +35,7 @@
 //#define IMGUI_DISABLE                                     // Disable everything: all headers and source files will be empty.
 //#define IMGUI_DISABLE_DEMO_WINDOWS                        // Disable demo windows: ShowDemoWindow()/ShowStyleEditor() will be empty.
 //#define IMGUI_DISABLE_DEBUG_TOOLS                         // Disable metrics/debugger and other debug tools: ShowMetricsWindow(), ShowDebugLogWindow() and ShowStackToolWindow() will be empty (this was called IMGUI_DISABLE_METRICS_WINDOW before 1.88).
+//#define IMGUI_DISABLE_PROFILER                            // Compile out profiler zones: ShowProfilerWindow() will be empty (implied by IMGUI_DISABLE_DEBUG_TOOLS).
 
 //---- Don't implement some functions to reduce linkage requirements.
 //#define IMGUI_DISABLE_WIN32_DEFAULT_CLIPBOARD_FUNCTIONS   // [Win32] Don't implement default clipboard handler. Won't use and link with OpenClipboard/GetClipboardData/CloseClipboard etc. (user32.lib/.a, kernel32.lib/.a)
@@ -112,6 +113,14 @@
 //typedef void (*MyImDrawCallback)(const ImDrawList* draw_list, const ImDrawCmd* cmd, void* my_renderer_user_data);
 //#define ImDrawCallback MyImDrawCallback
 
+//---- Make the current context pointer (GImGui) thread_local, so N threads can each build their own UI on their own context concurrently.
+// - Each thread calls CreateContext()/SetCurrentContext() for itself. A context must only be used by one thread at a time.
+// - Contexts may share one ImFontAtlas: build it before starting the threads and don't modify it while they are running.
+//   In this mode NewFrame() doesn't lock a shared atlas, so such modifications are not caught by an assert.
+// - Allocator functions set with SetAllocatorFunctions() are process-wide and must be thread-safe (default malloc/free are).
+// - Not compatible with building Dear ImGui as a DLL, thread_local variables can't be exported.
+//#define IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+
 //---- Debug Tools: Macro to break in Debugger (we provide a default implementation of this in the codebase)
 // (use 'Metrics->Tools->Item Picker' to pick widgets with the mouse and break into them for easy debugging.)
 //#define IM_DEBUG_BREAK  IM_ASSERT(0)
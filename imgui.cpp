@@ -67,7 +67,7 @@ CODE
 // [SECTION] MISC HELPERS/UTILITIES (Color functions)
 // [SECTION] ImGuiStorage
 // [SECTION] ImGuiTextFilter
-// [SECTION] ImGuiTextBuffer, ImGuiTextIndex
+// [SECTION] ImGuiTextBuffer, ImGuiTextIndex, ImFrameArena
 // [SECTION] ImGuiListClipper
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
@@ -89,6 +89,7 @@ CODE
 // [SECTION] METRICS/DEBUGGER WINDOW
 // [SECTION] DEBUG LOG WINDOW
 // [SECTION] OTHER DEBUG TOOLS (ITEM PICKER, STACK TOOL)
+// [SECTION] PROFILER
 
 */
 
@@ -945,6 +946,7 @@ CODE
 // System includes
 #include <stdio.h>      // vsnprintf, sscanf, printf
 #include <stdint.h>     // intptr_t
+#include <time.h>       // clock_gettime, clock (ProfilerGetTime)
 
 // [Windows] On non-Visual Studio compilers, we default to IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS unless explicitly enabled
 #if defined(_WIN32) && !defined(_MSC_VER) && !defined(IMGUI_ENABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
@@ -1130,15 +1132,25 @@ static void             UpdateViewportsNewFrame();
 //         extern thread_local ImGuiContext* MyImGuiTLS;
 //         #define GImGui MyImGuiTLS
 //     And then define MyImGuiTLS in one of your cpp files. Note that thread_local is a C++11 keyword, earlier C++ uses compiler-specific keyword.
+//     Or simply enable IMGUI_ENABLE_THREAD_LOCAL_CONTEXT in your imconfig.h, which does the above for you and also makes
+//     the widgets' function-local animation state per-thread (see IM_THREAD_LOCAL).
 //   - Future development aims to make this context pointer explicit to all calls. Also read https://github.com/ocornut/imgui/issues/586
 //   - If you need a finite number of contexts, you may compile and use multiple instances of the ImGui code from a different namespace.
+// - With IMGUI_ENABLE_THREAD_LOCAL_CONTEXT, a font atlas shared by several contexts (passed to CreateContext()) is never
+//   locked/unlocked by NewFrame()/EndFrame(), so it can be read by contexts running on different threads. Build it up-front
+//   and leave it untouched while they run: the "Cannot modify a locked ImFontAtlas" assert won't catch it.
 // - DLL users: read comments above.
 #ifndef GImGui
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+thread_local ImGuiContext*  GImGui = NULL;
+#else
 ImGuiContext*   GImGui = NULL;
 #endif
+#endif
 
 // Memory Allocator functions. Use SetAllocatorFunctions() to change them.
 // - You probably don't want to modify that mid-program, and if you use global/static e.g. ImVector<> instances you may need to keep them accessible during program destruction.
+// - They are shared by all contexts and all threads: set them before creating contexts on other threads, and make them thread-safe.
 // - DLL users: read comments above.
 #ifndef IMGUI_DISABLE_DEFAULT_ALLOCATORS
 static void*   MallocWrapper(size_t size, void* user_data)    { IM_UNUSED(user_data); return malloc(size); }
@@ -1286,6 +1298,8 @@ ImGuiIO::ImGuiIO()
     ConfigMacOSXBehaviors = false;
 #endif
     ConfigInputTrickleEventQueue = true;
+    ConfigInputCoalesceMouseMoves = false;
+    ConfigInputMouseTrailSize = 0;
     ConfigInputTextCursorBlink = true;
     ConfigInputTextEnterKeepActive = false;
     ConfigDragClickToInputText = false;
@@ -1294,6 +1308,7 @@ ImGuiIO::ImGuiIO()
     ConfigMemoryCompactTimer = 60.0f;
     ConfigDebugBeginReturnValueOnce = false;
     ConfigDebugBeginReturnValueLoop = false;
+    ConfigDebugAllocAuditWarmupFrames = 60;
 
     // Platform Functions
     // Note: Initialize() will setup default clipboard/ime handlers.
@@ -1385,6 +1400,8 @@ void ImGuiIO::ClearEventsQueue()
     IM_ASSERT(Ctx != NULL);
     ImGuiContext& g = *Ctx;
     g.InputEventsQueue.clear();
+    g.InputEventsMouseTrail.clear();
+    g.InputEventsMouseTrailHead = 0;
 }
 
 // Clear current keyboard/mouse/gamepad state + current frame text input buffer. Equivalent to releasing all keys/buttons.
@@ -1539,6 +1556,33 @@ void ImGuiIO::AddMousePosEvent(float x, float y)
     if (latest_pos.x == pos.x && latest_pos.y == pos.y)
         return;
 
+    // Record sub-frame trail. Once full, overwrite the oldest position (NewFrame() puts them back in order)
+    if (g.IO.ConfigInputMouseTrailSize > 0)
+    {
+        ImVector<ImVec2>& trail = g.InputEventsMouseTrail;
+        if (trail.Size < g.IO.ConfigInputMouseTrailSize && g.InputEventsMouseTrailHead == 0)
+        {
+            trail.push_back(pos);
+        }
+        else
+        {
+            trail[g.InputEventsMouseTrailHead] = pos;
+            g.InputEventsMouseTrailHead = (g.InputEventsMouseTrailHead + 1) % trail.Size;
+        }
+    }
+
+    // Coalesce with previous event if it is a mouse move from the same source and nothing else was queued since
+    if (g.IO.ConfigInputCoalesceMouseMoves && g.InputEventsQueue.Size > 0)
+    {
+        ImGuiInputEvent* tail = &g.InputEventsQueue.back();
+        if (tail->Type == ImGuiInputEventType_MousePos && tail->MousePos.MouseSource == g.InputEventsNextMouseSource && !tail->AddedByTestEngine)
+        {
+            tail->MousePos.PosX = pos.x;
+            tail->MousePos.PosY = pos.y;
+            return;
+        }
+    }
+
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_MousePos;
     e.Source = ImGuiInputSource_Mouse;
@@ -1839,6 +1883,90 @@ const char* ImStristr(const char* haystack, const char* haystack_end, const char
     return NULL;
 }
 
+// Same as ImStristr() but the needle was already converted with ImToUpper(), and the haystack is only folded on demand.
+// With SSE we compare the first and last character of the needle against 16 positions at once, and only check the
+// middle of the needle on positions where both matched. Characters are compared with their 0x20 bit set, which folds
+// 'A'-'Z' onto 'a'-'z' and may only add false candidates (e.g. '@' vs '`'), which are rejected by the full check.
+const char* ImStristrUpper(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
+{
+    if (!haystack_end)
+        haystack_end = haystack + strlen(haystack);
+    const int needle_len = (int)(needle_end - needle);
+    if (needle_len <= 0)
+        return haystack;
+    if (haystack_end - haystack < needle_len)
+        return NULL;
+    const char* last_start = haystack_end - needle_len; // Last position the needle may start at
+
+#ifdef IMGUI_ENABLE_SSE
+    if (needle_len == 1 && last_start - haystack >= 15)
+    {
+        // Single character (common while typing a filter): compare against both cases, every set bit is a match.
+        const char c = needle[0];
+        const __m128i needle_upper = _mm_set1_epi8(c);
+        const __m128i needle_lower = _mm_set1_epi8((c >= 'A' && c <= 'Z') ? (char)(c + 'a' - 'A') : c);
+        for (;;)
+        {
+            const char* block = ImMin(haystack, last_start - 15);
+            const __m128i chars = _mm_loadu_si128((const __m128i*)(const void*)block);
+            unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chars, needle_upper), _mm_cmpeq_epi8(chars, needle_lower)));
+            if (mask != 0)
+            {
+                const char* p = block;
+                while ((mask & 1) == 0)
+                    p++, mask >>= 1;
+                return p;
+            }
+            if (block == last_start - 15)
+                return NULL;
+            haystack = block + 16;
+        }
+    }
+    if (last_start - haystack >= 15)
+    {
+        const __m128i case_bit = _mm_set1_epi8(0x20);
+        const __m128i needle_first = _mm_set1_epi8((char)(needle[0] | 0x20));
+        const __m128i needle_last = _mm_set1_epi8((char)(needle[needle_len - 1] | 0x20));
+        for (;;)
+        {
+            // The last block overlaps the previous one instead of leaving a tail: positions checked twice didn't match.
+            const char* block = ImMin(haystack, last_start - 15);
+            const __m128i block_first = _mm_or_si128(_mm_loadu_si128((const __m128i*)(const void*)block), case_bit);
+            const __m128i block_last = _mm_or_si128(_mm_loadu_si128((const __m128i*)(const void*)(block + needle_len - 1)), case_bit);
+            unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, needle_first), _mm_cmpeq_epi8(block_last, needle_last)));
+            for (const char* p = block; mask != 0; p++, mask >>= 1)
+            {
+                if ((mask & 1) == 0)
+                    continue;
+                int n = 0;
+                while (n < needle_len && ImToUpper(p[n]) == needle[n])
+                    n++;
+                if (n == needle_len)
+                    return p;
+            }
+            if (block == last_start - 15)
+                return NULL;
+            haystack = block + 16;
+        }
+    }
+#endif
+
+    const char un0 = needle[0];
+    for (; haystack <= last_start; haystack++)
+    {
+        if (ImToUpper(*haystack) != un0)
+            continue;
+        const char* a = haystack + 1;
+        const char* b = needle + 1;
+        for (; b < needle_end; a++, b++)
+            if (ImToUpper(*a) != *b)
+                break;
+        if (b == needle_end)
+            return haystack;
+    }
+    return NULL;
+}
+
 // Trim str by offsetting contents when there's leading data + writing a \0 at the trailing position. We use this in situation where the cost is negligible.
 void ImStrTrimBlanks(char* buf)
 {
@@ -2450,7 +2578,10 @@ int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
+    {
+        IM_ALLOC_SCOPE(ImGuiAllocCategory_Storage);
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    }
     return &it->val_i;
 }
 
@@ -2463,7 +2594,10 @@ float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
+    {
+        IM_ALLOC_SCOPE(ImGuiAllocCategory_Storage);
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    }
     return &it->val_f;
 }
 
@@ -2471,7 +2605,10 @@ void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
+    {
+        IM_ALLOC_SCOPE(ImGuiAllocCategory_Storage);
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    }
     return &it->val_p;
 }
 
@@ -2481,6 +2618,7 @@ void ImGuiStorage::SetInt(ImGuiID key, int val)
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
     {
+        IM_ALLOC_SCOPE(ImGuiAllocCategory_Storage);
         Data.insert(it, ImGuiStoragePair(key, val));
         return;
     }
@@ -2497,6 +2635,7 @@ void ImGuiStorage::SetFloat(ImGuiID key, float val)
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
     {
+        IM_ALLOC_SCOPE(ImGuiAllocCategory_Storage);
         Data.insert(it, ImGuiStoragePair(key, val));
         return;
     }
@@ -2508,6 +2647,7 @@ void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
     {
+        IM_ALLOC_SCOPE(ImGuiAllocCategory_Storage);
         Data.insert(it, ImGuiStoragePair(key, val));
         return;
     }
@@ -2527,7 +2667,7 @@ void ImGuiStorage::SetAllInt(int v)
 // Helper: Parse and apply text filters. In format "aaaaa[,bbbb][,ccccc]"
 ImGuiTextFilter::ImGuiTextFilter(const char* default_filter) //-V1077
 {
-    InputBuf[0] = 0;
+    InputBuf[0] = InputBufUpper[0] = 0;
     CountGrep = 0;
     if (default_filter)
     {
@@ -2566,6 +2706,10 @@ void ImGuiTextFilter::ImGuiTextRange::split(char separator, ImVector<ImGuiTextRa
 
 void ImGuiTextFilter::Build()
 {
+    for (int n = 0; n < IM_ARRAYSIZE(InputBuf); n++)
+        if ((InputBufUpper[n] = ImToUpper(InputBuf[n])) == 0)
+            break;
+
     Filters.resize(0);
     ImGuiTextRange input_range(InputBuf, InputBuf + strlen(InputBuf));
     input_range.split(',', &Filters);
@@ -2590,22 +2734,26 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
         return true;
 
     if (text == NULL)
-        text = "";
+        text = text_end = "";
+    else if (text_end == NULL)
+        text_end = text + strlen(text); // Measure once instead of once per term
 
     for (const ImGuiTextRange& f : Filters)
     {
         if (f.empty())
             continue;
+        const char* needle = InputBufUpper + (f.b - InputBuf);
+        const char* needle_end = InputBufUpper + (f.e - InputBuf);
         if (f.b[0] == '-')
         {
             // Subtract
-            if (ImStristr(text, text_end, f.b + 1, f.e) != NULL)
+            if (needle + 1 < needle_end && ImStristrUpper(text, text_end, needle + 1, needle_end) != NULL)
                 return false;
         }
         else
         {
             // Grep
-            if (ImStristr(text, text_end, f.b, f.e) != NULL)
+            if (ImStristrUpper(text, text_end, needle, needle_end) != NULL)
                 return true;
         }
     }
@@ -2617,8 +2765,18 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
     return false;
 }
 
+// Doesn't modify the filter nor allocate: different ranges of a large array can be tested from different threads.
+int ImGuiTextFilter::PassFilterBatch(const char* const* texts, const char* const* texts_end, int count, bool* out_passed) const
+{
+    int passed_count = 0;
+    for (int n = 0; n < count; n++)
+        if ((out_passed[n] = PassFilter(texts[n], texts_end ? texts_end[n] : NULL)))
+            passed_count++;
+    return passed_count;
+}
+
 //-----------------------------------------------------------------------------
-// [SECTION] ImGuiTextBuffer, ImGuiTextIndex
+// [SECTION] ImGuiTextBuffer, ImGuiTextIndex, ImFrameArena
 //-----------------------------------------------------------------------------
 
 // On some platform vsnprintf() takes va_list by reference and modifies it.
@@ -2642,6 +2800,7 @@ void ImGuiTextBuffer::append(const char* str, const char* str_end)
     const int needed_sz = write_off + len;
     if (write_off + len >= Buf.Capacity)
     {
+        IM_ALLOC_SCOPE(ImGuiAllocCategory_Text);
         int new_capacity = Buf.Capacity * 2;
         Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
     }
@@ -2677,6 +2836,7 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     const int needed_sz = write_off + len;
     if (write_off + len >= Buf.Capacity)
     {
+        IM_ALLOC_SCOPE(ImGuiAllocCategory_Text);
         int new_capacity = Buf.Capacity * 2;
         Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
     }
@@ -2700,6 +2860,65 @@ void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
     EndOffset = ImMax(EndOffset, new_size);
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImFrameArena
+//-----------------------------------------------------------------------------
+
+void* ImFrameArena::Alloc(size_t size)
+{
+    size = (size + 15) & ~(size_t)15;
+    HighWaterMark += (int)size;
+    if (Size + (int)size <= Capacity)
+    {
+        void* ptr = Data + Size;
+        Size += (int)size;
+        return ptr;
+    }
+
+    // Overflow: serve from the heap this frame, Reset() will grow the block so this doesn't happen again.
+    void* ptr = IM_ALLOC(size);
+    OverflowBlocks.push_back(ptr);
+    OverflowCount++;
+    return ptr;
+}
+
+char* ImFrameArena::Strdup(const char* str, const char* str_end)
+{
+    size_t len = str_end ? (size_t)(str_end - str) : strlen(str);
+    char* buf = (char*)Alloc(len + 1);
+    memcpy(buf, str, len);
+    buf[len] = 0;
+    return buf;
+}
+
+void ImFrameArena::Reset()
+{
+    for (int n = 0; n < OverflowBlocks.Size; n++)
+        IM_FREE(OverflowBlocks[n]);
+    OverflowBlocks.resize(0);
+    if (HighWaterMark > Capacity)
+    {
+        // Grow with some headroom. Only happens when the frame's transient needs increase.
+        IM_FREE(Data);
+        Capacity = ImMax(HighWaterMark + HighWaterMark / 2, 4 * 1024);
+        Data = (char*)IM_ALLOC((size_t)Capacity);
+    }
+    LastHighWaterMark = HighWaterMark;
+    LastOverflowCount = OverflowCount;
+    Size = HighWaterMark = OverflowCount = 0;
+}
+
+void ImFrameArena::Clear()
+{
+    for (int n = 0; n < OverflowBlocks.Size; n++)
+        IM_FREE(OverflowBlocks[n]);
+    OverflowBlocks.clear();
+    if (Data)
+        IM_FREE(Data);
+    Data = NULL;
+    Size = Capacity = HighWaterMark = LastHighWaterMark = OverflowCount = LastOverflowCount = 0;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 //-----------------------------------------------------------------------------
@@ -3690,6 +3909,7 @@ void ImGui::Shutdown()
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
+    g.FrameArena.Clear();
     g.InputTextState.ClearFreeMemory();
     g.InputTextDeactivatedState.ClearFreeMemory();
 
@@ -4223,6 +4443,45 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
     return ImMax(wrap_pos_x - pos.x, 1.0f);
 }
 
+static const char* const GAllocCategoryNames[ImGuiAllocCategory_COUNT] = { "Widgets", "DrawLists", "Windows", "Storage", "Text", "Backend" };
+
+ImGuiAllocScope::ImGuiAllocScope(ImGuiAllocCategory category, const char* scope)
+{
+    Audit = GImGui ? &GImGui->DebugAllocAudit : NULL;
+    BackupCategory = ImGuiAllocCategory_None;
+    BackupScope = NULL;
+    if (Audit == NULL)
+        return;
+    BackupCategory = Audit->Category;
+    BackupScope = Audit->Scope;
+    Audit->Category = category;
+    Audit->Scope = scope;
+}
+
+ImGuiAllocScope::~ImGuiAllocScope()
+{
+    if (Audit == NULL)
+        return;
+    Audit->Category = BackupCategory;
+    Audit->Scope = BackupScope;
+}
+
+// Called by MemAlloc() for allocations made in steady state when io.ConfigDebugAllocAudit is enabled.
+static void DebugAllocAuditReport(ImGuiContext* ctx, ImGuiAllocCategory category, size_t size)
+{
+    ImGuiAllocAudit& audit = ctx->DebugAllocAudit;
+    audit.Reporting = true;
+    audit.Armed = false;            // Report once, then wait for another warmup
+    audit.UnchangedFrames = 0;
+    audit.ReportCount++;
+    ImGuiWindow* window = ctx->CurrentWindow;
+    ImFormatString(audit.LastReport, IM_ARRAYSIZE(audit.LastReport), "Frame %d: MemAlloc(%d) in steady state. Category: %s, scope: %s, window: '%s', last item: 0x%08X",
+        ctx->FrameCount, (int)size, GAllocCategoryNames[category], audit.Scope ? audit.Scope : "(none)", window ? window->Name : "(none)", ctx->LastItemData.ID);
+    IMGUI_DEBUG_LOG("[alloc] %s\n", audit.LastReport);
+    audit.Reporting = false;
+    IM_ASSERT(!ctx->IO.ConfigDebugAllocAuditAssert && "Heap allocation in steady state! See io.ConfigDebugAllocAudit and the debug log.");
+}
+
 // IM_ALLOC() == ImGui::MemAlloc()
 void* ImGui::MemAlloc(size_t size)
 {
@@ -4231,6 +4490,15 @@ void* ImGui::MemAlloc(size_t size)
     {
         ctx->IO.MetricsActiveAllocations++;
         //printf("[%05d] MemAlloc(%d) -> 0x%p\n", ctx->FrameCount, size, ptr);
+
+        ImGuiAllocAudit& audit = ctx->DebugAllocAudit;
+        ImGuiAllocCategory category = audit.Category;
+        if (category == ImGuiAllocCategory_None)
+            category = ctx->WithinFrameScope ? ImGuiAllocCategory_Widget : ImGuiAllocCategory_Backend;
+        audit.Frame.Count[category]++;
+        audit.Frame.Bytes[category] += size;
+        if (audit.Armed && !audit.Reporting)
+            DebugAllocAuditReport(ctx, category, size);
     }
     return ptr;
 }
@@ -4247,6 +4515,13 @@ void ImGui::MemFree(void* ptr)
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
 
+// Transient allocation from the context's frame arena, released all at once by the next NewFrame().
+void* ImGui::MemAllocFrame(size_t size)
+{
+    ImGuiContext& g = *GImGui;
+    return g.FrameArena.Alloc(size);
+}
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -4546,8 +4821,25 @@ void ImGui::NewFrame()
         if (g.Hooks[n].Type == ImGuiContextHookType_PendingRemoval_)
             g.Hooks.erase(&g.Hooks[n]);
 
+#ifndef IMGUI_DISABLE_PROFILER
+    // Close last frame's zones and start recording the new frame
+    ProfilerNewFrame();
+    IMGUI_PROFILE_SCOPE("NewFrame");
+#endif
+
     CallContextHooks(&g, ImGuiContextHookType_NewFramePre);
 
+    // Roll per-frame allocation statistics
+    int frame_allocations = 0;
+    for (int n = 0; n < ImGuiAllocCategory_COUNT; n++)
+        frame_allocations += g.DebugAllocAudit.Frame.Count[n];
+    g.IO.MetricsFrameAllocations = frame_allocations;
+    g.DebugAllocAudit.LastFrame = g.DebugAllocAudit.Frame;
+    g.DebugAllocAudit.Frame = ImGuiAllocStats();
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    DebugItemCostNewFrame();
+#endif
+
     // Check and assert for various common IO and Configuration mistakes
     ErrorCheckNewFrameSanityChecks();
 
@@ -4561,6 +4853,11 @@ void ImGui::NewFrame()
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
 
+    // Release last frame's transient allocations
+    g.FrameArena.Reset();
+    g.IO.MetricsFrameArenaHighWater = g.FrameArena.LastHighWaterMark;
+    g.IO.MetricsFrameArenaOverflows = g.FrameArena.LastOverflowCount;
+
     // Calculate frame-rate for the user, as a purely luxurious feature
     g.FramerateSecPerFrameAccum += g.IO.DeltaTime - g.FramerateSecPerFrame[g.FramerateSecPerFrameIdx];
     g.FramerateSecPerFrame[g.FramerateSecPerFrameIdx] = g.IO.DeltaTime;
@@ -4571,12 +4868,34 @@ void ImGui::NewFrame()
     // Process input queue (trickle as many events as possible), turn events into writes to IO structure
     g.InputEventsTrail.resize(0);
     UpdateInputEvents(g.IO.ConfigInputTrickleEventQueue);
+    {
+        // Unwrap the trail ring buffer, oldest first
+        const ImVector<ImVec2>& trail = g.InputEventsMouseTrail;
+        const int head = g.InputEventsMouseTrailHead;
+        g.MouseTrail.resize(trail.Size);
+        if (trail.Size > 0)
+        {
+            memcpy(g.MouseTrail.Data, trail.Data + head, (size_t)(trail.Size - head) * sizeof(ImVec2));
+            memcpy(g.MouseTrail.Data + trail.Size - head, trail.Data, (size_t)head * sizeof(ImVec2));
+        }
+        g.InputEventsMouseTrail.resize(0);
+        g.InputEventsMouseTrailHead = 0;
+    }
+
+    // [DEBUG] Allocation audit: a frame which processed no input should reach a steady state with no heap allocation
+    ImGuiAllocAudit& alloc_audit = g.DebugAllocAudit;
+    alloc_audit.UnchangedFrames = (g.IO.ConfigDebugAllocAudit && g.InputEventsTrail.Size == 0) ? alloc_audit.UnchangedFrames + 1 : 0;
+    alloc_audit.Armed = g.IO.ConfigDebugAllocAudit && alloc_audit.UnchangedFrames > g.IO.ConfigDebugAllocAuditWarmupFrames;
 
     // Update viewports (after processing input queue, so io.MouseHoveredViewport is set)
     UpdateViewportsNewFrame();
 
     // Setup current font and draw list shared data
-    g.IO.Fonts->Locked = true;
+    // (with thread-local contexts a shared atlas is left alone: it may be read concurrently by contexts living on other threads)
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+    if (g.FontAtlasOwnedByContext)
+#endif
+        g.IO.Fonts->Locked = true;
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
     ImRect virtual_space(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
@@ -5009,6 +5328,11 @@ void ImGui::EndFrame()
     if (g.FrameCountEnded == g.FrameCount)
         return;
     IM_ASSERT(g.WithinFrameScope && "Forgot to call ImGui::NewFrame()?");
+    IMGUI_PROFILE_SCOPE("EndFrame");
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    if (g.DebugItemCost.Recording)
+        DebugItemCostEndItem();
+#endif
 
     CallContextHooks(&g, ImGuiContextHookType_EndFramePre);
 
@@ -5084,7 +5408,10 @@ void ImGui::EndFrame()
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     // Unlock font atlas
-    g.IO.Fonts->Locked = false;
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+    if (g.FontAtlasOwnedByContext)
+#endif
+        g.IO.Fonts->Locked = false;
 
     // Clear Input data for next frame
     g.IO.MousePosPrev = g.IO.MousePos;
@@ -5108,6 +5435,8 @@ void ImGui::Render()
     if (g.FrameCountRendered == g.FrameCount)
         return;
     g.FrameCountRendered = g.FrameCount;
+    IM_ALLOC_SCOPE(ImGuiAllocCategory_DrawList);
+    IMGUI_PROFILE_SCOPE("Render");
 
     g.IO.MetricsRenderWindows = 0;
     CallContextHooks(&g, ImGuiContextHookType_RenderPre);
@@ -5169,6 +5498,7 @@ void ImGui::Render()
 ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILE_SCOPE("CalcTextSize");
 
     const char* text_display_end;
     if (hide_text_after_double_hash)
@@ -6386,6 +6716,11 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
     IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
     IM_ASSERT(g.FrameCountEnded != g.FrameCount);   // Called ImGui::Render() or ImGui::EndFrame() and haven't called ImGui::NewFrame() again yet
+    IM_ALLOC_SCOPE(ImGuiAllocCategory_Window);
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    if (g.DebugItemCost.Recording)
+        DebugItemCostEndItem();
+#endif
 
     // Find or create
     ImGuiWindow* window = FindWindowByName(name);
@@ -6403,6 +6738,11 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     const int current_frame = g.FrameCount;
     const bool first_begin_of_the_frame = (window->LastFrameActive != current_frame);
     window->IsFallbackWindow = (g.CurrentWindowStack.Size == 0 && g.WithinFrameScopeWithImplicitWindow);
+#ifndef IMGUI_DISABLE_PROFILER
+    // Window zone, closed at the end of End(). The implicit fallback window spans the whole frame: not recorded.
+    if (g.Profiler.Recording && !window->IsFallbackWindow)
+        ProfilerBeginZone("Window", window->ID);
+#endif
 
     // Update the Appearing flag
     bool window_just_activated_by_user = (window->LastFrameActive < current_frame - 1);   // Not using !WasActive because the implicit "Debug" window would always toggle off->on
@@ -7079,6 +7419,10 @@ void ImGui::End()
         return;
     }
     IM_ASSERT(g.CurrentWindowStack.Size > 0);
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    if (g.DebugItemCost.Recording)
+        DebugItemCostEndItem();
+#endif
 
     // Error checking: verify that user doesn't directly call End() on a child window.
     if (window->Flags & ImGuiWindowFlags_ChildWindow)
@@ -7106,6 +7450,11 @@ void ImGui::End()
     g.CurrentWindowStack.back().StackSizesOnBegin.CompareWithContextState(&g);
     g.CurrentWindowStack.pop_back();
     SetCurrentWindow(g.CurrentWindowStack.Size == 0 ? NULL : g.CurrentWindowStack.back().Window);
+
+#ifndef IMGUI_DISABLE_PROFILER
+    if (g.Profiler.Recording && !window->IsFallbackWindow)
+        ProfilerEndZone();
+#endif
 }
 
 void ImGui::BringWindowToFocusFront(ImGuiWindow* window)
@@ -9647,6 +9996,13 @@ bool ImGui::ItemAdd(const ImRect& bb, ImGuiID id, const ImRect* nav_bb_arg, ImGu
 {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
+    IMGUI_PROFILE_SCOPE("ItemAdd");
+
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    // [DEBUG] Per-item cost: complete previous item, measure this one until the next item
+    if (g.DebugItemCost.Recording)
+        DebugItemCostBeginItem(window, id, bb);
+#endif
 
     // Set item data
     // (DisplayRect is left untouched, made valid when ImGuiItemStatusFlags_HasDisplayRect is set)
@@ -13842,6 +14198,13 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     }
 }
 
+static int IMGUI_CDECL DebugItemCostCompareSortKeys(const void* lhs, const void* rhs)
+{
+    const ImU64 a = *(const ImU64*)lhs;
+    const ImU64 b = *(const ImU64*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
 void ImGui::ShowMetricsWindow(bool* p_open)
 {
     ImGuiContext& g = *GImGui;
@@ -13851,6 +14214,8 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         ShowDebugLogWindow(&cfg->ShowDebugLog);
     if (cfg->ShowStackTool)
         ShowStackToolWindow(&cfg->ShowStackTool);
+    if (cfg->ShowProfiler)
+        ShowProfilerWindow(&cfg->ShowProfiler);
 
     if (!Begin("Dear ImGui Metrics/Debugger", p_open) || GetCurrentWindow()->BeginCount > 1)
     {
@@ -13863,6 +14228,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     Text("%d visible windows, %d active allocations", io.MetricsRenderWindows, io.MetricsActiveAllocations);
+    Text("Frame arena: %d bytes high-water, %d overflows", io.MetricsFrameArenaHighWater, io.MetricsFrameArenaOverflows);
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
 
     Separator();
@@ -13946,6 +14312,10 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         SameLine();
         MetricsHelpMarker("You can also call ImGui::ShowStackToolWindow() from your code.");
 
+        Checkbox("Show Profiler", &cfg->ShowProfiler);
+        SameLine();
+        MetricsHelpMarker("You can also call ImGui::ShowProfilerWindow() from your code.");
+
         Checkbox("Show windows begin order", &cfg->ShowWindowsBeginOrder);
         Checkbox("Show windows rectangles", &cfg->ShowWindowsRects);
         SameLine();
@@ -14129,6 +14499,130 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     }
 #endif // #ifdef IMGUI_HAS_DOCK
 
+    // Allocations
+    if (TreeNode("Allocations", "Allocations (%d last frame)", io.MetricsFrameAllocations))
+    {
+        ImGuiAllocAudit& audit = g.DebugAllocAudit;
+        Text("%d active allocations. Frame arena: %d bytes high-water, %d overflows.", io.MetricsActiveAllocations, io.MetricsFrameArenaHighWater, io.MetricsFrameArenaOverflows);
+        if (BeginTable("##allocs", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+        {
+            TableSetupColumn("Category");
+            TableSetupColumn("Count");
+            TableSetupColumn("Bytes");
+            TableHeadersRow();
+            for (int n = 0; n < ImGuiAllocCategory_COUNT; n++)
+            {
+                TableNextColumn(); TextUnformatted(GAllocCategoryNames[n]);
+                TableNextColumn(); Text("%d", audit.LastFrame.Count[n]);
+                TableNextColumn(); Text("%d", (int)audit.LastFrame.Bytes[n]);
+            }
+            EndTable();
+        }
+        Checkbox("io.ConfigDebugAllocAudit", &io.ConfigDebugAllocAudit);
+        SameLine(); MetricsHelpMarker("Report any heap allocation made by a frame which processed no input, after a warmup. Reports go to the debug log.");
+        BeginDisabled(!io.ConfigDebugAllocAudit);
+        Checkbox("io.ConfigDebugAllocAuditAssert", &io.ConfigDebugAllocAuditAssert);
+        SetNextItemWidth(GetFontSize() * 8);
+        DragInt("io.ConfigDebugAllocAuditWarmupFrames", &io.ConfigDebugAllocAuditWarmupFrames, 1.0f, 1, 10000);
+        Text("Steady state: %s (%d frames without input)", audit.Armed ? "armed" : "warming up", audit.UnchangedFrames);
+        EndDisabled();
+        Text("%d report(s).", audit.ReportCount);
+        if (audit.LastReport[0])
+            TextWrapped("Last: %s", audit.LastReport);
+        TreePop();
+    }
+
+    // Widgets cost
+    ImGuiItemCostRecorder& item_cost = g.DebugItemCost;
+    if (TreeNode("WidgetsCost", "Widgets cost (%d items)", item_cost.Items.Size))
+    {
+        Checkbox("Record", &item_cost.Enabled);
+        SameLine(); MetricsHelpMarker("Attribute to each submitted item the vertices, indices and draw commands added to its window draw list, and the CPU time spent, from its ItemAdd() to the next item.\nItems without an ID are identified by their position in the window.\nHover a row to locate the item.");
+        SameLine();
+        if (SmallButton("Clear"))
+        {
+            item_cost.Items.resize(0);
+            item_cost.ItemsMap.Clear();
+            item_cost.CurrentIndex = -1;
+        }
+        enum { ItemCostColumn_Item, ItemCostColumn_Window, ItemCostColumn_Count, ItemCostColumn_Vtx, ItemCostColumn_Idx, ItemCostColumn_Cmd, ItemCostColumn_Time, ItemCostColumn_COUNT };
+        if (BeginTable("##itemcost", ItemCostColumn_COUNT, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 16)))
+        {
+            TableSetupScrollFreeze(0, 1);
+            TableSetupColumn("Item");
+            TableSetupColumn("Window", ImGuiTableColumnFlags_WidthStretch | ImGuiTableColumnFlags_NoSort);
+            TableSetupColumn("Count", ImGuiTableColumnFlags_PreferSortDescending);
+            TableSetupColumn("Vtx", ImGuiTableColumnFlags_PreferSortDescending);
+            TableSetupColumn("Idx", ImGuiTableColumnFlags_PreferSortDescending);
+            TableSetupColumn("Cmds", ImGuiTableColumnFlags_PreferSortDescending);
+            TableSetupColumn("CPU (us)", ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_DefaultSort);
+            TableHeadersRow();
+
+            // Sort keys: (value << 32) | index. Values are unsigned or positive floats, whose bits sort like integers.
+            const ImGuiTableSortSpecs* sort_specs = TableGetSortSpecs();
+            const int sort_column = (sort_specs && sort_specs->SpecsCount > 0) ? sort_specs->Specs[0].ColumnIndex : (int)ItemCostColumn_Time;
+            const bool sort_descending = (sort_specs && sort_specs->SpecsCount > 0) ? (sort_specs->Specs[0].SortDirection == ImGuiSortDirection_Descending) : true;
+            ImVector<ImU64>& sort_keys = item_cost.TempSortKeys;
+            sort_keys.resize(0);
+            for (int n = 0; n < item_cost.Items.Size; n++)
+            {
+                const ImGuiItemCost& item = item_cost.Items[n];
+                if (item.Count == 0)
+                    continue;
+                ImU32 value;
+                switch (sort_column)
+                {
+                case ItemCostColumn_Item:   value = item.ID; break;
+                case ItemCostColumn_Count:  value = (ImU32)item.Count; break;
+                case ItemCostColumn_Vtx:    value = (ImU32)item.VtxCount; break;
+                case ItemCostColumn_Idx:    value = (ImU32)item.IdxCount; break;
+                case ItemCostColumn_Cmd:    value = (ImU32)item.CmdCount; break;
+                default:                    memcpy(&value, &item.TimeAvg, sizeof(value)); break;
+                }
+                sort_keys.push_back(((ImU64)value << 32) | (ImU32)n);
+            }
+            ImQsort(sort_keys.Data, (size_t)sort_keys.Size, sizeof(ImU64), DebugItemCostCompareSortKeys);
+
+            ImGuiListClipper clipper;
+            clipper.Begin(sort_keys.Size);
+            while (clipper.Step())
+                for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                {
+                    const int item_n = (int)(sort_keys[sort_descending ? sort_keys.Size - 1 - row_n : row_n] & 0xFFFFFFFF);
+                    const ImGuiItemCost& item = item_cost.Items[item_n];
+                    ImGuiWindow* item_window = FindWindowByID(item.WindowID);
+                    TableNextRow();
+                    TableNextColumn();
+                    PushID(item_n);
+                    char buf[64];
+                    if (item.ID != 0)
+                        ImFormatString(buf, IM_ARRAYSIZE(buf), "0x%08X", item.ID);
+                    else
+                        ImFormatString(buf, IM_ARRAYSIZE(buf), "(no ID)");
+                    Selectable(buf, false, ImGuiSelectableFlags_SpanAllColumns);
+                    if (IsItemHovered() && item_window != NULL)
+                        GetForegroundDrawList(item_window)->AddRect(item.Rect.Min, item.Rect.Max, IM_COL32(255, 255, 0, 255));
+                    DebugLocateItemOnHover(item.ID);
+                    PopID();
+#ifdef IMGUI_ENABLE_TEST_ENGINE
+                    if (item.ID != 0)
+                    {
+                        SameLine();
+                        TextUnformatted(ImGuiTestEngine_FindItemDebugLabel(&g, item.ID));
+                    }
+#endif
+                    TableNextColumn(); TextUnformatted(item_window ? item_window->Name : "");
+                    TableNextColumn(); Text("%d", item.Count);
+                    TableNextColumn(); Text("%d", item.VtxCount);
+                    TableNextColumn(); Text("%d", item.IdxCount);
+                    TableNextColumn(); Text("%d", item.CmdCount);
+                    TableNextColumn(); Text("%.2f", item.TimeAvg);
+                }
+            EndTable();
+        }
+        TreePop();
+    }
+
     // Settings
     if (TreeNode("Settings"))
     {
@@ -14920,6 +15414,99 @@ void ImGui::DebugLocateItemOnHover(ImGuiID target_id)
     GetForegroundDrawList(g.CurrentWindow)->AddRect(g.LastItemData.Rect.Min - ImVec2(3.0f, 3.0f), g.LastItemData.Rect.Max + ImVec2(3.0f, 3.0f), DEBUG_LOCATE_ITEM_COLOR);
 }
 
+// [DEBUG] Per-item cost: publish last frame's measurements, forget items which haven't been submitted for a while
+void ImGui::DebugItemCostNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiItemCostRecorder& rec = g.DebugItemCost;
+    rec.CurrentIndex = -1;
+    if (rec.Recording)
+    {
+        int dst_n = 0;
+        for (int src_n = 0; src_n < rec.Items.Size; src_n++)
+        {
+            ImGuiItemCost& item = rec.Items[src_n];
+            item.Count = item.AccumCount;
+            item.VtxCount = item.AccumVtxCount;
+            item.IdxCount = item.AccumIdxCount;
+            item.CmdCount = item.AccumCmdCount;
+            item.Time = (float)item.AccumTime / 1000.0f;
+            item.TimeAvg = (item.TimeAvg == 0.0f) ? item.Time : ImLerp(item.TimeAvg, item.Time, 0.05f);
+            item.AccumCount = item.AccumVtxCount = item.AccumIdxCount = item.AccumCmdCount = 0;
+            item.AccumTime = 0;
+            if (g.FrameCount - item.LastFrameCount < 60)
+                rec.Items[dst_n++] = item;
+        }
+        if (dst_n < rec.Items.Size)
+        {
+            rec.Items.resize(dst_n);
+            rec.ItemsMap.Clear();
+            for (int n = 0; n < rec.Items.Size; n++)
+                rec.ItemsMap.SetInt(rec.Items[n].Key, n);
+        }
+    }
+    rec.Recording = rec.Enabled;
+}
+
+void ImGui::DebugItemCostBeginItem(ImGuiWindow* window, ImGuiID id, const ImRect& bb)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiItemCostRecorder& rec = g.DebugItemCost;
+    DebugItemCostEndItem();
+
+    // Items without an ID (e.g. Text()) are identified by their position in the window contents
+    ImGuiID key = id;
+    if (key == 0)
+    {
+        const ImVec2 pos_in_contents = bb.Min - window->Pos + window->Scroll;
+        key = ImHashData(&pos_in_contents, sizeof(pos_in_contents), window->ID);
+    }
+    int* p_item_n = rec.ItemsMap.GetIntRef(key, -1);
+    if (*p_item_n == -1)
+    {
+        *p_item_n = rec.Items.Size;
+        rec.Items.push_back(ImGuiItemCost());
+        rec.Items.back().Key = key;
+        rec.Items.back().ID = id;
+        rec.Items.back().WindowID = window->ID;
+    }
+    ImGuiItemCost& item = rec.Items[*p_item_n];
+    item.LastFrameCount = g.FrameCount;
+    item.Rect = bb;
+    item.AccumCount++;
+
+    ImDrawList* draw_list = window->DrawList;
+    rec.CurrentIndex = *p_item_n;
+    rec.CurrentDrawList = draw_list;
+    rec.CurrentVtxStart = draw_list->VtxBuffer.Size;
+    rec.CurrentIdxStart = draw_list->IdxBuffer.Size;
+    rec.CurrentCmdStart = draw_list->CmdBuffer.Size;
+    rec.CurrentChannel = draw_list->_Splitter._Count > 1 ? draw_list->_Splitter._Current : -1;
+    rec.CurrentTimeStart = ProfilerGetTime(); // Last
+}
+
+void ImGui::DebugItemCostEndItem()
+{
+    const ImU64 time = ProfilerGetTime(); // First
+    ImGuiContext& g = *GImGui;
+    ImGuiItemCostRecorder& rec = g.DebugItemCost;
+    if (rec.CurrentIndex == -1)
+        return;
+
+    // Index and command buffers are swapped by ImDrawListSplitter (e.g. tables columns): when the channel changed,
+    // only the vertices count is meaningful.
+    ImGuiItemCost& item = rec.Items[rec.CurrentIndex];
+    ImDrawList* draw_list = rec.CurrentDrawList;
+    item.AccumVtxCount += ImMax(draw_list->VtxBuffer.Size - rec.CurrentVtxStart, 0);
+    if (rec.CurrentChannel == (draw_list->_Splitter._Count > 1 ? draw_list->_Splitter._Current : -1))
+    {
+        item.AccumIdxCount += ImMax(draw_list->IdxBuffer.Size - rec.CurrentIdxStart, 0);
+        item.AccumCmdCount += ImMax(draw_list->CmdBuffer.Size - rec.CurrentCmdStart, 0);
+    }
+    item.AccumTime += time - rec.CurrentTimeStart;
+    rec.CurrentIndex = -1;
+}
+
 void ImGui::DebugLocateItemResolveWithLastItem()
 {
     ImGuiContext& g = *GImGui;
@@ -15171,10 +15758,438 @@ void ImGui::ShowDebugLogWindow(bool*) {}
 void ImGui::ShowStackToolWindow(bool*) {}
 void ImGui::DebugHookIdInfo(ImGuiID, ImGuiDataType, const void*, const void*) {}
 void ImGui::UpdateDebugToolItemPicker() {}
+void ImGui::DebugItemCostNewFrame() {}
+void ImGui::DebugItemCostBeginItem(ImGuiWindow*, ImGuiID, const ImRect&) {}
+void ImGui::DebugItemCostEndItem() {}
 void ImGui::UpdateDebugToolStackQueries() {}
 
 #endif // #ifndef IMGUI_DISABLE_DEBUG_TOOLS
 
+//-----------------------------------------------------------------------------
+// [SECTION] PROFILER
+//-----------------------------------------------------------------------------
+// - ProfilerGetTime()
+// - ProfilerNewFrame() [Internal]
+// - ProfilerBeginZone() [Internal]
+// - ProfilerEndZone() [Internal]
+// - ProfilerUpdateStats() [Internal]
+// - ShowProfilerWindow()
+//-----------------------------------------------------------------------------
+// Zones are recorded with IMGUI_PROFILE_SCOPE() in NewFrame(), EndFrame(), Render(), ItemAdd(), ButtonBehavior(), the
+// styled widgets, text functions and the shadow primitives, and with Begin()/End() for each window.
+// Recording only happens while the profiler window is visible (or g.Profiler.Enabled is set), so the cost of a zone
+// is a load and a branch the rest of the time. A recorded zone costs two clock reads.
+//-----------------------------------------------------------------------------
+
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+static ImU64 ProfilerGetTimerFrequency()
+{
+    LARGE_INTEGER frequency;
+    ::QueryPerformanceFrequency(&frequency);
+    return (ImU64)frequency.QuadPart;
+}
+#endif
+
+// Also used by the per-item cost recorder of the Metrics window, which doesn't require the profiler.
+ImU64 ImGui::ProfilerGetTime()
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    static const ImU64 freq = ProfilerGetTimerFrequency(); // Thread-safe one-time initialization (contexts may live on different threads)
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return ((ImU64)counter.QuadPart / freq) * 1000000000 + ((ImU64)counter.QuadPart % freq) * 1000000000 / freq;
+#elif !defined(_WIN32) && (defined(__unix__) || defined(__APPLE__))
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec;
+#else
+    return (ImU64)((double)clock() * (1000000000.0 / CLOCKS_PER_SEC)); // Low resolution fallback
+#endif
+}
+
+#ifndef IMGUI_DISABLE_PROFILER
+
+// Called at the very beginning of NewFrame(): complete the frame recorded since the previous NewFrame() (including
+// Render() and anything the application recorded after it), then decide whether to record the new frame.
+void ImGui::ProfilerNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler& prof = g.Profiler;
+    if (prof.Recording)
+    {
+        // Close zones left open (e.g. Begin() without End())
+        while (prof.Stack.Size > 0)
+            ProfilerEndZone();
+
+        ImGuiProfilerFrame* frame = &prof.Frames[prof.FramesHead];
+        frame->EndTime = frame->StartTime;
+        for (const ImGuiProfilerZone& zone : frame->Zones)
+            if (zone.Depth == 0 && zone.EndTime > frame->EndTime)
+                frame->EndTime = zone.EndTime;
+        ProfilerUpdateStats(frame);
+        prof.FramesHead = (prof.FramesHead + 1) % IMGUI_PROFILER_FRAMES;
+        prof.FramesCount = ImMin(prof.FramesCount + 1, IMGUI_PROFILER_FRAMES);
+    }
+
+    prof.Recording = !prof.Paused && (prof.Enabled || prof.LastShowFrame >= g.FrameCount);
+    if (prof.Recording)
+    {
+        ImGuiProfilerFrame* frame = &prof.Frames[prof.FramesHead];
+        frame->FrameCount = g.FrameCount + 1; // NewFrame() increments g.FrameCount after us
+        frame->Zones.resize(0);
+        frame->StartTime = frame->EndTime = ProfilerGetTime();
+    }
+}
+
+void ImGui::ProfilerBeginZone(const char* name, ImGuiID window_id)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler& prof = g.Profiler;
+    if (!prof.Recording)
+        return;
+    ImVector<ImGuiProfilerZone>& zones = prof.Frames[prof.FramesHead].Zones;
+    prof.Stack.push_back(zones.Size);
+    zones.resize(zones.Size + 1);
+    ImGuiProfilerZone& zone = zones.back();
+    zone.Name = name;
+    zone.WindowID = window_id ? window_id : g.CurrentWindow ? g.CurrentWindow->ID : 0;
+    zone.Depth = prof.Stack.Size - 1;
+    zone.EndTime = 0;
+    zone.StartTime = ProfilerGetTime(); // Last
+}
+
+void ImGui::ProfilerEndZone()
+{
+    const ImU64 end_time = ProfilerGetTime(); // First
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler& prof = g.Profiler;
+    if (prof.Stack.Size == 0)
+        return;
+    prof.Frames[prof.FramesHead].Zones[prof.Stack.back()].EndTime = end_time;
+    prof.Stack.pop_back();
+}
+
+// Accumulate a completed frame into per-zone and per-window statistics
+void ImGui::ProfilerUpdateStats(ImGuiProfilerFrame* frame)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler& prof = g.Profiler;
+    const int zones_count = frame->Zones.Size;
+
+    // Self time = duration minus the duration of direct children.
+    // A zone nested in a zone with the same name (e.g. a child window) doesn't add to the total of that name.
+    ImVector<int>& parents = prof.Stack;
+    IM_ASSERT(parents.Size == 0);
+    prof.TempSelfTime.resize(zones_count);
+    prof.TempIsOutermost.resize(zones_count);
+    for (int zone_n = 0; zone_n < zones_count; zone_n++)
+    {
+        const ImGuiProfilerZone& zone = frame->Zones[zone_n];
+        while (parents.Size > zone.Depth)
+            parents.pop_back();
+        const ImU64 duration = zone.EndTime - zone.StartTime;
+        bool is_outermost = true;
+        for (int parent_n : parents)
+            if (frame->Zones[parent_n].Name == zone.Name)
+                is_outermost = false;
+        if (parents.Size > 0)
+            prof.TempSelfTime[parents.back()] -= duration;
+        prof.TempSelfTime[zone_n] = duration;
+        prof.TempIsOutermost[zone_n] = is_outermost;
+        parents.push_back(zone_n);
+    }
+    parents.resize(0);
+
+    for (ImGuiProfilerZoneStats& stats : prof.ZonesStats)
+    {
+        stats.Calls = 0;
+        stats.AccumSelf = stats.AccumTotal = 0;
+    }
+    const char* last_name = NULL;
+    int stats_n = -1;
+    for (int zone_n = 0; zone_n < zones_count; zone_n++)
+    {
+        const ImGuiProfilerZone& zone = frame->Zones[zone_n];
+        const ImU64 duration = zone.EndTime - zone.StartTime;
+
+        // Per zone name
+        if (zone.Name != last_name)
+        {
+            int* p_stats_n = prof.ZonesStatsMap.GetIntRef(ImHashStr(zone.Name), -1);
+            if (*p_stats_n == -1)
+            {
+                *p_stats_n = prof.ZonesStats.Size;
+                prof.ZonesStats.push_back(ImGuiProfilerZoneStats());
+                prof.ZonesStats.back().Name = zone.Name;
+            }
+            stats_n = *p_stats_n;
+            last_name = zone.Name;
+        }
+        ImGuiProfilerZoneStats& stats = prof.ZonesStats[stats_n];
+        stats.Calls++;
+        stats.AccumSelf += prof.TempSelfTime[zone_n];
+        if (prof.TempIsOutermost[zone_n])
+            stats.AccumTotal += duration;
+
+        // Per window
+        if (zone.WindowID == 0)
+            continue;
+        int* p_window_stats_n = prof.WindowsStatsMap.GetIntRef(zone.WindowID, -1);
+        if (*p_window_stats_n == -1)
+        {
+            *p_window_stats_n = prof.WindowsStats.Size;
+            prof.WindowsStats.push_back(ImGuiProfilerWindowStats());
+            prof.WindowsStats.back().ID = zone.WindowID;
+        }
+        ImGuiProfilerWindowStats& window_stats = prof.WindowsStats[*p_window_stats_n];
+        if (window_stats.LastFrameCount != frame->FrameCount)
+        {
+            window_stats.LastFrameCount = frame->FrameCount;
+            window_stats.AccumSelf = window_stats.AccumTotal = 0;
+        }
+        window_stats.AccumSelf += prof.TempSelfTime[zone_n];
+        if (strcmp(zone.Name, "Window") == 0)
+            window_stats.AccumTotal += duration;
+    }
+
+    // Convert to milliseconds, update history
+    const float ns_to_ms = 1.0f / 1000000.0f;
+    for (ImGuiProfilerZoneStats& stats : prof.ZonesStats)
+    {
+        stats.TimeSelf = (float)stats.AccumSelf * ns_to_ms;
+        stats.TimeTotal = (float)stats.AccumTotal * ns_to_ms;
+        stats.TimeTotalAvg = (prof.HistoryCount == 0) ? stats.TimeTotal : ImLerp(stats.TimeTotalAvg, stats.TimeTotal, 0.05f);
+        stats.History[prof.HistoryIdx] = stats.TimeTotal;
+    }
+    prof.HistoryIdx = (prof.HistoryIdx + 1) % IMGUI_PROFILER_HISTORY;
+    prof.HistoryCount = ImMin(prof.HistoryCount + 1, IMGUI_PROFILER_HISTORY);
+    for (ImGuiProfilerWindowStats& window_stats : prof.WindowsStats)
+    {
+        const bool recorded = (window_stats.LastFrameCount == frame->FrameCount);
+        window_stats.TimeSelf = recorded ? (float)window_stats.AccumSelf * ns_to_ms : 0.0f;
+        window_stats.TimeTotal = recorded ? (float)window_stats.AccumTotal * ns_to_ms : 0.0f;
+        window_stats.TimeTotalAvg = ImLerp(window_stats.TimeTotalAvg, window_stats.TimeTotal, 0.05f);
+    }
+}
+
+static int IMGUI_CDECL ProfilerCompareFloats(const void* lhs, const void* rhs)
+{
+    const float a = *(const float*)lhs;
+    const float b = *(const float*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+// Sort indices by decreasing 'TimeTotalAvg' (few entries: insertion sort)
+template<typename T>
+static void ProfilerSortByTimeTotalAvg(const ImVector<T>& stats, ImVector<int>* out_order)
+{
+    out_order->resize(0);
+    for (int n = 0; n < stats.Size; n++)
+    {
+        int dst = out_order->Size;
+        out_order->push_back(n);
+        while (dst > 0 && stats[(*out_order)[dst - 1]].TimeTotalAvg < stats[n].TimeTotalAvg)
+        {
+            (*out_order)[dst] = (*out_order)[dst - 1];
+            dst--;
+        }
+        (*out_order)[dst] = n;
+    }
+}
+
+static const char* ProfilerGetZoneLabel(const ImGuiProfilerZone& zone)
+{
+    if (strcmp(zone.Name, "Window") == 0)
+        if (ImGuiWindow* window = ImGui::FindWindowByID(zone.WindowID))
+            return window->Name;
+    return zone.Name;
+}
+
+void ImGui::ShowProfilerWindow(bool* p_open)
+{
+    ImGuiContext& g = *GImGui;
+    if (!(g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasSize))
+        SetNextWindowSize(ImVec2(GetFontSize() * 50.0f, GetFontSize() * 36.0f), ImGuiCond_FirstUseEver);
+    if (!Begin("Dear ImGui Profiler", p_open) || GetCurrentWindow()->BeginCount > 1)
+    {
+        End();
+        return;
+    }
+
+    // Keep recording while visible
+    ImGuiProfiler& prof = g.Profiler;
+    prof.LastShowFrame = g.FrameCount;
+
+    Checkbox("Pause", &prof.Paused);
+    SameLine();
+    MetricsHelpMarker("Zones are recorded while this window is visible, from NewFrame() to the next NewFrame().\nWhile paused, the last frames can be browsed in the flame graph.\nTables display the last recorded frame. Percentiles are over the last frames.");
+    if (prof.FramesCount == 0)
+    {
+        Text("Recording...");
+        End();
+        return;
+    }
+    if (!prof.Paused)
+        prof.ViewFrame = 0;
+    prof.ViewFrame = ImClamp(prof.ViewFrame, 0, prof.FramesCount - 1);
+    BeginDisabled(!prof.Paused);
+    SameLine();
+    SetNextItemWidth(GetFontSize() * 8.0f);
+    SliderInt("Frame", &prof.ViewFrame, 0, prof.FramesCount - 1, "-%d", ImGuiSliderFlags_AlwaysClamp);
+    EndDisabled();
+    SameLine();
+    SetNextItemWidth(GetFontSize() * 8.0f);
+    SliderFloat("Zoom", &prof.ViewZoom, 1.0f, 200.0f, "%.1fx", ImGuiSliderFlags_Logarithmic | ImGuiSliderFlags_AlwaysClamp);
+
+    const ImGuiProfilerFrame* frame = prof.GetFrame(prof.ViewFrame);
+    const ImU64 frame_duration = ImMax(frame->EndTime - frame->StartTime, (ImU64)1);
+    Text("Frame %d: %.3f ms, %d zones", frame->FrameCount, (double)frame_duration / 1000000.0, frame->Zones.Size);
+
+    // Flame graph
+    int max_depth = 0;
+    for (const ImGuiProfilerZone& zone : frame->Zones)
+        max_depth = ImMax(max_depth, zone.Depth);
+    const float row_height = GetTextLineHeight() + 2.0f;
+    const float graph_height = ImMin(row_height * (max_depth + 1), row_height * 16.0f) + g.Style.ScrollbarSize + g.Style.WindowPadding.y * 2.0f;
+    if (BeginChild("##flamegraph", ImVec2(0.0f, graph_height), true, ImGuiWindowFlags_HorizontalScrollbar))
+    {
+        ImGuiWindow* window = GetCurrentWindow();
+        ImDrawList* draw_list = window->DrawList;
+        const float graph_width = GetContentRegionAvail().x * prof.ViewZoom;
+        const ImVec2 origin = GetCursorScreenPos();
+        Dummy(ImVec2(graph_width, row_height * (max_depth + 1)));
+        const double scale = graph_width / (double)frame_duration;
+        const ImRect clip_rect = window->ClipRect;
+        const ImVec4 clip_rect_v4 = clip_rect.ToVec4();
+        const bool graph_hovered = IsWindowHovered();
+        const ImU32 text_col = IM_COL32(255, 255, 255, 255);
+        int hovered_n = -1;
+        for (int zone_n = 0; zone_n < frame->Zones.Size; zone_n++)
+        {
+            // Zones narrower than a pixel are skipped: zoom in to see them
+            const ImGuiProfilerZone& zone = frame->Zones[zone_n];
+            const float x0 = origin.x + (float)((double)(zone.StartTime - frame->StartTime) * scale);
+            const float x1 = origin.x + (float)((double)(zone.EndTime - frame->StartTime) * scale);
+            if (x1 - x0 < 1.0f || x1 < clip_rect.Min.x || x0 > clip_rect.Max.x)
+                continue;
+            const ImRect bb(x0, origin.y + zone.Depth * row_height, x1, origin.y + (zone.Depth + 1) * row_height - 1.0f);
+            if (bb.Max.y < clip_rect.Min.y || bb.Min.y > clip_rect.Max.y)
+                continue;
+            const float hue = (ImHashStr(zone.Name) & 0xFF) / 255.0f;
+            float r, gr, b;
+            ColorConvertHSVtoRGB(hue, 0.55f, 0.65f, r, gr, b);
+            const bool hovered = graph_hovered && bb.Contains(g.IO.MousePos);
+            if (hovered)
+                hovered_n = zone_n;
+            draw_list->AddRectFilled(bb.Min, bb.Max, hovered ? GetColorU32(ImGuiCol_ButtonHovered) : GetColorU32(ImVec4(r, gr, b, 1.0f)));
+            if (bb.GetWidth() > GetFontSize() * 2.0f)
+            {
+                const ImVec4 text_clip_rect(ImMax(bb.Min.x, clip_rect_v4.x), bb.Min.y, ImMin(bb.Max.x - 2.0f, clip_rect_v4.z), bb.Max.y);
+                draw_list->AddText(NULL, 0.0f, ImVec2(text_clip_rect.x + 2.0f, bb.Min.y + 1.0f), text_col, ProfilerGetZoneLabel(zone), NULL, 0.0f, &text_clip_rect);
+            }
+        }
+        if (hovered_n != -1)
+        {
+            const ImGuiProfilerZone& zone = frame->Zones[hovered_n];
+            BeginTooltip();
+            Text("%s", zone.Name);
+            if (ImGuiWindow* zone_window = FindWindowByID(zone.WindowID))
+                Text("Window: %s", zone_window->Name);
+            Text("Duration: %.3f ms", (double)(zone.EndTime - zone.StartTime) / 1000000.0);
+            Text("Start: +%.3f ms", (double)(zone.StartTime - frame->StartTime) / 1000000.0);
+            EndTooltip();
+        }
+    }
+    EndChild();
+
+    // Per zone timings
+    ImVector<int>& order = prof.TempOrder;
+    const ImGuiTableFlags table_flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY;
+    SeparatorText("Zones");
+    if (BeginTable("##zones", 9, table_flags, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 12)))
+    {
+        TableSetupScrollFreeze(0, 1);
+        TableSetupColumn("Zone", ImGuiTableColumnFlags_WidthStretch);
+        TableSetupColumn("Calls");
+        TableSetupColumn("Self");
+        TableSetupColumn("Total");
+        TableSetupColumn("p50");
+        TableSetupColumn("p95");
+        TableSetupColumn("p99");
+        TableSetupColumn("Max");
+        TableSetupColumn("History");
+        TableHeadersRow();
+
+        float sorted_history[IMGUI_PROFILER_HISTORY];
+        const int history_count = prof.HistoryCount;
+        const int history_offset = (history_count < IMGUI_PROFILER_HISTORY) ? 0 : prof.HistoryIdx;
+        ProfilerSortByTimeTotalAvg(prof.ZonesStats, &order);
+        for (int stats_n : order)
+        {
+            const ImGuiProfilerZoneStats& stats = prof.ZonesStats[stats_n];
+            memcpy(sorted_history, stats.History, sizeof(float) * history_count);
+            ImQsort(sorted_history, (size_t)history_count, sizeof(float), ProfilerCompareFloats);
+            TableNextRow();
+            TableNextColumn(); TextUnformatted(stats.Name);
+            TableNextColumn(); Text("%d", stats.Calls);
+            TableNextColumn(); Text("%.3f", stats.TimeSelf);
+            TableNextColumn(); Text("%.3f", stats.TimeTotal);
+            TableNextColumn(); Text("%.3f", sorted_history[(history_count - 1) * 50 / 100]);
+            TableNextColumn(); Text("%.3f", sorted_history[(history_count - 1) * 95 / 100]);
+            TableNextColumn(); Text("%.3f", sorted_history[(history_count - 1) * 99 / 100]);
+            TableNextColumn(); Text("%.3f", sorted_history[history_count - 1]);
+            TableNextColumn();
+            PushID(stats_n);
+            PlotLines("##history", stats.History, history_count, history_offset, NULL, 0.0f, FLT_MAX, ImVec2(GetFontSize() * 8.0f, GetTextLineHeight()));
+            PopID();
+        }
+        EndTable();
+    }
+
+    // Per window timings
+    SeparatorText("Windows");
+    if (BeginTable("##windows", 4, table_flags, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 10)))
+    {
+        TableSetupScrollFreeze(0, 1);
+        TableSetupColumn("Window", ImGuiTableColumnFlags_WidthStretch);
+        TableSetupColumn("Self");
+        TableSetupColumn("Total");
+        TableSetupColumn("Average");
+        TableHeadersRow();
+
+        const int last_frame_count = prof.GetFrame(0)->FrameCount;
+        ProfilerSortByTimeTotalAvg(prof.WindowsStats, &order);
+        for (int stats_n : order)
+        {
+            const ImGuiProfilerWindowStats& stats = prof.WindowsStats[stats_n];
+            ImGuiWindow* window = FindWindowByID(stats.ID);
+            if (window == NULL || stats.LastFrameCount != last_frame_count)
+                continue;
+            TableNextRow();
+            TableNextColumn(); TextUnformatted(window->Name);
+            if (IsItemHovered())
+                GetForegroundDrawList()->AddRect(window->Pos, window->Pos + window->Size, IM_COL32(255, 255, 0, 255));
+            TableNextColumn(); Text("%.3f", stats.TimeSelf);
+            TableNextColumn(); Text("%.3f", stats.TimeTotal);
+            TableNextColumn(); Text("%.3f", stats.TimeTotalAvg);
+        }
+        EndTable();
+    }
+    order.resize(0);
+
+    End();
+}
+
+#else
+
+void ImGui::ProfilerNewFrame() {}
+void ImGui::ProfilerBeginZone(const char*, ImGuiID) {}
+void ImGui::ProfilerEndZone() {}
+void ImGui::ProfilerUpdateStats(ImGuiProfilerFrame*) {}
+void ImGui::ShowProfilerWindow(bool*) {}
+
+#endif // #ifndef IMGUI_DISABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 
 // Include imgui_user.inl at the end of imgui.cpp to access private data/functions that aren't exposed.
@@ -39,7 +39,7 @@ Index of this file:
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload, ImGuiTableSortSpecs, ImGuiTableColumnSortSpecs)
 // [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
-// [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
+// [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData, ImDrawDataSnapshot)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
 // [SECTION] Platform Dependent Interfaces (ImGuiPlatformImeData)
@@ -137,6 +137,7 @@ Index of this file:
 struct ImDrawChannel;               // Temporary storage to output draw commands out of order, used by ImDrawListSplitter and ImDrawList::ChannelsSplit()
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
+struct ImDrawDataSnapshot;          // Copy of an ImDrawData made by swapping buffers, to render a frame on another thread while the next one is built.
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
@@ -156,9 +157,11 @@ struct ImGuiListClipper;            // Helper to manually clip large list of ite
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiPlatformImeData;        // Platform IME data for io.SetPlatformImeDataFn() function.
+struct ImGuiPlotBuffer;             // Helper to plot very large sample counts: ring buffer of samples with a min/max pyramid
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage
 struct ImGuiStyle;                  // Runtime data for styling/colors
+struct ImGuiTableColumnClipper;     // Helper to manually clip columns of a table with many columns
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
@@ -308,6 +311,7 @@ namespace ImGui
     IMGUI_API void          ShowMetricsWindow(bool* p_open = NULL);     // create Metrics/Debugger window. display Dear ImGui internals: windows, draw commands, various internal state, etc.
     IMGUI_API void          ShowDebugLogWindow(bool* p_open = NULL);    // create Debug Log window. display a simplified log of important dear imgui events.
     IMGUI_API void          ShowStackToolWindow(bool* p_open = NULL);   // create Stack Tool window. hover items with mouse to query information about the source of their unique ID.
+    IMGUI_API void          ShowProfilerWindow(bool* p_open = NULL);    // create Profiler window. display a flame graph of Dear ImGui internal zones, per-zone timings and per-window cost.
     IMGUI_API void          ShowAboutWindow(bool* p_open = NULL);       // create About window. display Dear ImGui version, credits and build/system information.
     IMGUI_API void          ShowStyleEditor(ImGuiStyle* ref = NULL);    // add style editor block (not a window). you can pass in a reference ImGuiStyle structure to compare to, revert to and save to (else it uses the default style)
     IMGUI_API bool          ShowStyleSelector(const char* label);       // add style selector block (not a window), essentially a combo listing the default styles.
@@ -652,6 +656,8 @@ namespace ImGui
     IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotHistogram(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotLines(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));       // Plot all samples of 'buffer', one min/max span per pixel. Cost depends on width, not on sample count.
+    IMGUI_API void          PlotHistogram(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
 
     // Widgets: Value() Helpers.
     // - Those are merely shortcut to calling Text() with a format string. Output single value in "name: value" format (tip: freely declare more in your code to handle your types. you can add functions to the ImGui namespace)
@@ -965,6 +971,7 @@ namespace ImGui
     IMGUI_API void          GetAllocatorFunctions(ImGuiMemAllocFunc* p_alloc_func, ImGuiMemFreeFunc* p_free_func, void** p_user_data);
     IMGUI_API void*         MemAlloc(size_t size);
     IMGUI_API void          MemFree(void* ptr);
+    IMGUI_API void*         MemAllocFrame(size_t size);                                 // allocate from the current context's frame arena. Valid until the next NewFrame(), never call MemFree() on it.
 
 } // namespace ImGui
 
@@ -1216,6 +1223,8 @@ enum ImGuiTableFlags_
     // Sorting
     ImGuiTableFlags_SortMulti                  = 1 << 26,  // Hold shift when clicking headers to sort on multiple column. TableGetSortSpecs() may return specs where (SpecsCount > 1).
     ImGuiTableFlags_SortTristate               = 1 << 27,  // Allow no sorting, disable default sorting. TableGetSortSpecs() may return specs where (SpecsCount == 0).
+    // Clipping
+    ImGuiTableFlags_SkipClippedColumns         = 1 << 28,  // Skip cells of columns which are out of sight (scrolled/clipped): TableNextColumn()/TableSetColumnIndex() return false early and items submitted into them are ignored. Those cells won't contribute to row height! Recommended with many columns and ScrollX. See ImGuiTableColumnClipper.
 
     // [Internal] Combinations and masks
     ImGuiTableFlags_SizingMask_                = ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_SizingFixedSame | ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_SizingStretchSame,
@@ -1994,6 +2003,8 @@ struct ImGuiIO
     bool        MouseDrawCursor;                // = false          // Request ImGui to draw a mouse cursor for you (if you are on a platform without a mouse cursor). Cannot be easily renamed to 'io.ConfigXXX' because this is frequently used by backend implementations.
     bool        ConfigMacOSXBehaviors;          // = defined(__APPLE__) // OS X style: Text editing cursor movement using Alt instead of Ctrl, Shortcuts using Cmd/Super instead of Ctrl, Line/Text Start and End using Cmd+Arrows instead of Home/End, Double click selects by word instead of selecting whole text, Multi-selection in lists uses Cmd/Super instead of Ctrl.
     bool        ConfigInputTrickleEventQueue;   // = true           // Enable input queue trickling: some types of events submitted during the same frame (e.g. button down + up) will be spread over multiple frames, improving interactions with low framerates.
+    bool        ConfigInputCoalesceMouseMoves;  // = false          // Merge consecutive io.AddMousePosEvent() calls into a single queued event when nothing else was submitted in between. Keeps the queue short with high polling rate mice.
+    int         ConfigInputMouseTrailSize;      // = 0              // Keep up to this many mouse positions submitted between two frames (including merged ones), for widgets which want sub-frame motion. See GetMouseTrail() in imgui_internal.h.
     bool        ConfigInputTextCursorBlink;     // = true           // Enable blinking cursor (optional as some users consider it to be distracting).
     bool        ConfigInputTextEnterKeepActive; // = false          // [BETA] Pressing Enter will keep item active and select contents (single-line only).
     bool        ConfigDragClickToInputText;     // = false          // [BETA] Enable turning DragXXX widgets into text input with a simple mouse click-release (without moving). Not desirable on devices without a keyboard.
@@ -2028,6 +2039,12 @@ struct ImGuiIO
     // Options to audit .ini data
     bool        ConfigDebugIniSettings;         // = false          // Save .ini data with extra comments (particularly helpful for Docking, but makes saving slower)
 
+    // Options to audit heap allocations. Per-frame counts by category are always collected, see "Allocations" in ShowMetricsWindow().
+    // Once ConfigDebugAllocAuditWarmupFrames consecutive frames have processed no input event, any MemAlloc() is reported to the debug log with its category, scope and current window.
+    bool        ConfigDebugAllocAudit;          // = false          // Report heap allocations made by frames with no input (steady state).
+    bool        ConfigDebugAllocAuditAssert;    // = false          // Also assert on such allocations (with a debugger attached, the callstack names the caller).
+    int         ConfigDebugAllocAuditWarmupFrames; // = 60          // Number of consecutive frames without input before allocations are reported.
+
     //------------------------------------------------------------------
     // Platform Functions
     // (the imgui_impl_xxxx backend files are setting those up for you)
@@ -2101,6 +2118,9 @@ struct ImGuiIO
     int         MetricsRenderWindows;               // Number of visible windows
     int         MetricsActiveWindows;               // Number of active windows
     int         MetricsActiveAllocations;           // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
+    int         MetricsFrameArenaHighWater;         // Bytes requested from the frame arena (MemAllocFrame) during the previous frame.
+    int         MetricsFrameArenaOverflows;         // Number of frame arena requests which had to fall back to MemAlloc() during the previous frame. Should be 0 in steady state.
+    int         MetricsFrameAllocations;            // Number of MemAlloc() calls during the previous frame (NewFrame() to NewFrame(), so including the backends).
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
     // Legacy: before 1.87, we required backend to fill io.KeyMap[] (imgui->native map) during initialization and io.KeysDown[] (native indices) every frame.
@@ -2286,6 +2306,7 @@ struct ImGuiTextFilter
     IMGUI_API           ImGuiTextFilter(const char* default_filter = "");
     IMGUI_API bool      Draw(const char* label = "Filter (inc,-exc)", float width = 0.0f);  // Helper calling InputText+Build
     IMGUI_API bool      PassFilter(const char* text, const char* text_end = NULL) const;
+    IMGUI_API int       PassFilterBatch(const char* const* texts, const char* const* texts_end, int count, bool* out_passed) const; // Test 'count' strings at once ('texts_end' may be NULL for zero-terminated strings). Return the number of passing strings. May be called from multiple threads on different ranges.
     IMGUI_API void      Build();
     void                Clear()          { InputBuf[0] = 0; Build(); }
     bool                IsActive() const { return !Filters.empty(); }
@@ -2302,6 +2323,7 @@ struct ImGuiTextFilter
         IMGUI_API void  split(char separator, ImVector<ImGuiTextRange>* out) const;
     };
     char                    InputBuf[256];
+    char                    InputBufUpper[256]; // Copy of InputBuf converted with ImToUpper() by Build(). The terms of Filters[] are matched using their pre-converted version from here.
     ImVector<ImGuiTextRange>Filters;
     int                     CountGrep;
 };
@@ -2428,6 +2450,69 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Manually clip columns of a table with many columns (e.g. thousands of columns with ImGuiTableFlags_ScrollX).
+// ImGuiListClipper lets you submit only the visible rows, this lets you submit only the visible cells of each row.
+// Call Begin() once per frame after declaring columns (it locks the table layout, so after TableSetupColumn()/TableSetupScrollFreeze()),
+// then on every row only call TableSetColumnIndex() on the columns it lists, in display order:
+// the frozen columns followed by the range of columns overlapping the horizontal scrolling view.
+// Columns needing to be measured for auto-fitting are included, so prefer _WidthFixed columns with large column counts.
+// Usage:
+//   ImGuiTableColumnClipper column_clipper;
+//   column_clipper.Begin();
+//   for (int row = ...)                         // Typically within a ImGuiListClipper loop
+//   {
+//       ImGui::TableNextRow();
+//       for (int n = 0; n < column_clipper.ColumnsCount; n++)
+//       {
+//           int column = column_clipper.GetColumnIndex(n);
+//           ImGui::TableSetColumnIndex(column);
+//           ImGui::Text("%d,%d", column, row);
+//       }
+//   }
+// Also see ImGuiTableFlags_SkipClippedColumns if you can't easily change the way your cells are submitted.
+struct ImGuiTableColumnClipper
+{
+    int             FrozenCount;        // Columns [0, FrozenCount) in display order are frozen and always submitted
+    int             DisplayStart;       // First non-frozen column to submit, in display order
+    int             DisplayEnd;         // End of non-frozen columns to submit, in display order (exclusive)
+    int             ColumnsCount;       // Number of columns to submit on each row (== FrozenCount + DisplayEnd - DisplayStart)
+    void*           TempData;           // [Internal] Table
+
+    ImGuiTableColumnClipper()           { memset(this, 0, sizeof(*this)); }
+    IMGUI_API void  Begin();                            // Must be called between BeginTable() and EndTable()
+    IMGUI_API int   GetColumnIndex(int n) const;        // Return index of the n-th column to submit (0 <= n < ColumnsCount), to pass to TableSetColumnIndex()
+};
+
+// Helper: Ring buffer of samples for PlotLines()/PlotHistogram(), for sample counts much larger than the plot width (e.g. millions of samples).
+// - Along with the samples we keep a pyramid of min/max values: level 1 holds the min/max of each block of 16 samples, level 2 of each block
+//   of 16 level 1 entries, etc. It is updated incrementally as samples are pushed (overwriting the oldest ones when full).
+// - The min/max of any range of samples is obtained from a few blocks of each level, so plotting draws one vertical min/max span per
+//   pixel column: spikes are never lost between two drawn samples, and the cost doesn't depend on the number of samples.
+// Usage:
+//   static ImGuiPlotBuffer buf;
+//   if (buf.GetCapacity() == 0)
+//       buf.Init(10000000);
+//   buf.Push(new_values, new_values_count);
+//   ImGui::PlotLines("Telemetry", &buf);
+struct ImGuiPlotBuffer
+{
+    ImVector<float>     Samples;        // Ring buffer. NaN values are ignored.
+    ImVector<ImVec2>    Pyramid;        // (min, max) of blocks, level after level
+    ImVector<int>       LevelOffsets;   // Start of each level in Pyramid[]: level 1 starts at LevelOffsets[0]. Last entry is Pyramid.Size.
+    int                 Count;          // Number of valid samples
+    int                 Head;           // Index in Samples[] of the next sample to write
+
+    ImGuiPlotBuffer()   { Count = Head = 0; }
+    IMGUI_API void      Init(int capacity);
+    IMGUI_API void      Clear();
+    IMGUI_API void      Push(float v);
+    IMGUI_API void      Push(const float* values, int values_count);
+    int                 GetCapacity() const { return Samples.Size; }
+    int                 GetCount() const    { return Count; }
+    IMGUI_API float     GetValue(int idx) const;                    // idx == 0 is the oldest sample, GetCount() - 1 the most recent.
+    IMGUI_API ImVec2    GetMinMax(int idx_begin, int idx_end) const; // Min/max of samples [idx_begin, idx_end). Return (FLT_MAX, -FLT_MAX) if there are no values.
+};
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -2498,7 +2583,7 @@ struct ImColor
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Drawing API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
+// [SECTION] Drawing API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData, ImDrawDataSnapshot)
 // Hold a series of drawing commands. The user provides a renderer for ImDrawData which essentially contains an array of ImDrawList.
 //-----------------------------------------------------------------------------
 
@@ -2803,6 +2888,40 @@ struct ImDrawData
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 };
 
+// Snapshot of an ImDrawData, for rendering a frame on another thread while the next one is being built.
+// - SnapUsingSwap() swaps the vertex/index/command buffers of each source ImDrawList with a copy owned by the snapshot:
+//   no deep copy is made, and both sides keep their capacity so a steady-state frame doesn't allocate.
+//   The source draw lists are left holding stale buffers which the next NewFrame() clears: don't read them after snapping.
+// - Double-buffered usage with a render thread (synchronization is up to you, e.g. a mutex + condition variable per slot):
+//     UI thread:      NewFrame(); ...; Render(); wait until slot[N % 2] is free; slot[N % 2].SnapUsingSwap(GetDrawData()); hand it over.
+//     Render thread:  wait for a slot; ImGui_ImplXXX_RenderDrawData(&slot.DrawData); Present(); mark the slot free.
+//   The render thread then submits frame N while the UI thread builds frame N+1.
+// - Texture lifetime: every ImTextureID (and ImDrawCmd::UserCallbackData) referenced by a snapshot must stay valid until
+//   the render thread is done with that snapshot, which may be up to 2 frames after the UI thread last submitted it.
+//   Defer releasing textures accordingly, and don't rebuild/reupload the font atlas while a snapshot is in flight.
+// - User callbacks (ImDrawCmd::UserCallback) are invoked by the backend, so they run on the render thread.
+// - Draw lists which stop being submitted have their copy freed after 'CompactAfterFrames' snaps.
+struct ImDrawDataSnapshotEntry
+{
+    ImDrawList*         SrcList;            // Source draw list, used as a key only (never dereferenced by the snapshot after SnapUsingSwap() returns).
+    ImDrawList*         OurCopy;            // Draw list owned by the snapshot.
+    int                 LastUsedFrame;      // Value of ImDrawDataSnapshot::SnapCount when this entry was last used.
+};
+
+struct ImDrawDataSnapshot
+{
+    ImDrawData                          DrawData;           // Pass this to your renderer backend. Points to draw lists owned by the snapshot.
+    ImVector<ImDrawDataSnapshotEntry>   Entries;
+    ImGuiStorage                        EntriesMap;         // Key: hashed source ImDrawList pointer, Value: index into Entries[] + 1.
+    int                                 SnapCount;
+    int                                 CompactAfterFrames;
+
+    ImDrawDataSnapshot()                { SnapCount = 0; CompactAfterFrames = 60; }
+    ~ImDrawDataSnapshot()               { Clear(); }
+    IMGUI_API void  Clear();                                // Free all owned draw lists.
+    IMGUI_API void  SnapUsingSwap(ImDrawData* src);         // Take ownership of the contents of 'src' (typically GetDrawData() right after Render()).
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontAtlasFlags, ImFontAtlas, ImFontGlyphRangesBuilder, ImFont)
 //-----------------------------------------------------------------------------
@@ -291,6 +291,7 @@ void ImGui::ShowDemoWindow(bool* p_open)
     static bool show_tool_metrics = false;
     static bool show_tool_debug_log = false;
     static bool show_tool_stack_tool = false;
+    static bool show_tool_profiler = false;
     static bool show_tool_style_editor = false;
     static bool show_tool_about = false;
 
@@ -300,6 +301,8 @@ void ImGui::ShowDemoWindow(bool* p_open)
         ImGui::ShowDebugLogWindow(&show_tool_debug_log);
     if (show_tool_stack_tool)
         ImGui::ShowStackToolWindow(&show_tool_stack_tool);
+    if (show_tool_profiler)
+        ImGui::ShowProfilerWindow(&show_tool_profiler);
     if (show_tool_style_editor)
     {
         ImGui::Begin("Dear ImGui Style Editor", &show_tool_style_editor);
@@ -399,6 +402,7 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::MenuItem("Metrics/Debugger", NULL, &show_tool_metrics, has_debug_tools);
             ImGui::MenuItem("Debug Log", NULL, &show_tool_debug_log, has_debug_tools);
             ImGui::MenuItem("Stack Tool", NULL, &show_tool_stack_tool, has_debug_tools);
+            ImGui::MenuItem("Profiler", NULL, &show_tool_profiler, has_debug_tools);
             ImGui::MenuItem("Style Editor", NULL, &show_tool_style_editor);
             ImGui::MenuItem("About Dear ImGui", NULL, &show_tool_about);
             ImGui::EndMenu();
@@ -460,6 +464,11 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::SameLine(); HelpMarker("Instruct backend to not alter mouse cursor shape and visibility.");
             ImGui::Checkbox("io.ConfigInputTrickleEventQueue", &io.ConfigInputTrickleEventQueue);
             ImGui::SameLine(); HelpMarker("Enable input queue trickling: some types of events submitted during the same frame (e.g. button down + up) will be spread over multiple frames, improving interactions with low framerates.");
+            ImGui::Checkbox("io.ConfigInputCoalesceMouseMoves", &io.ConfigInputCoalesceMouseMoves);
+            ImGui::SameLine(); HelpMarker("Merge consecutive mouse position events into a single queued event when nothing else was submitted in between. Keeps the queue short with high polling rate mice.");
+            ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+            ImGui::DragInt("io.ConfigInputMouseTrailSize", &io.ConfigInputMouseTrailSize, 1.0f, 0, 1024);
+            ImGui::SameLine(); HelpMarker("Keep up to this many mouse positions submitted between two frames (including merged ones), for widgets which want sub-frame motion. See GetMouseTrail() in imgui_internal.h.");
             ImGui::Checkbox("io.MouseDrawCursor", &io.MouseDrawCursor);
             ImGui::SameLine(); HelpMarker("Instruct Dear ImGui to render a mouse cursor itself. Note that a mouse cursor rendered via your application GPU rendering path will feel more laggy than hardware cursor, but will be more in sync with your other visuals.\n\nSome desktop applications may use both kinds of cursors (e.g. enable software cursor only when resizing/dragging something).");
 
@@ -1829,6 +1838,33 @@ static void ShowDemoWindowWidgets()
         float (*func)(void*, int) = (func_type == 0) ? Funcs::Sin : Funcs::Saw;
         ImGui::PlotLines("Lines", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
         ImGui::PlotHistogram("Histogram", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
+
+        // Use ImGuiPlotBuffer to plot millions of samples: one min/max span is drawn per pixel column.
+        IMGUI_DEMO_MARKER("Widgets/Plotting/ImGuiPlotBuffer");
+        ImGui::SeparatorText("Large sample buffer");
+        ImGui::SameLine(); HelpMarker("ImGuiPlotBuffer keeps a min/max pyramid over a ring buffer of samples. Plotting cost depends on the plot width, not on the number of samples, and spikes are never skipped.");
+        static ImGuiPlotBuffer plot_buffer;
+        static int plot_buffer_rate = 10000;
+        static unsigned int plot_buffer_time = 0;
+        if (plot_buffer.GetCapacity() == 0)
+            plot_buffer.Init(2000000);
+        if (animate)
+        {
+            float new_values[1000];
+            for (int remaining = plot_buffer_rate; remaining > 0; remaining -= IM_ARRAYSIZE(new_values))
+            {
+                const int count = IM_MIN(remaining, IM_ARRAYSIZE(new_values));
+                for (int n = 0; n < count; n++, plot_buffer_time++)
+                    new_values[n] = sinf(plot_buffer_time * 0.00002f) * 0.5f + (float)(((plot_buffer_time * 1103515245u) >> 22) & 255) / 1024.0f + ((plot_buffer_time % 500009) == 0 ? 0.8f : 0.0f);
+                plot_buffer.Push(new_values, count);
+            }
+        }
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+        ImGui::SliderInt("Samples per frame", &plot_buffer_rate, 0, 100000, "%d", ImGuiSliderFlags_Logarithmic);
+        ImGui::SameLine();
+        ImGui::Text("%d/%d samples", plot_buffer.GetCount(), plot_buffer.GetCapacity());
+        ImGui::PlotLines("Lines##buffer", &plot_buffer, NULL, FLT_MAX, FLT_MAX, ImVec2(0, 80));
+        ImGui::PlotHistogram("Histogram##buffer", &plot_buffer, NULL, FLT_MAX, FLT_MAX, ImVec2(0, 80));
         ImGui::Separator();
 
         // Animate a simple progress bar
@@ -4618,6 +4654,85 @@ static void ShowDemoWindowTables()
         ImGui::TreePop();
     }
 
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    IMGUI_DEMO_MARKER("Tables/Wide tables");
+    if (ImGui::TreeNode("Wide tables"))
+    {
+        HelpMarker(
+            "Stress test for tables with many columns.\n\n"
+            "Draw channels are only allocated for visible columns, and visible columns using ImGuiTableColumnFlags_NoClip share a single channel. "
+            "Use Metrics/Debugger->Tables to inspect draw channels and Metrics/Debugger->Windows to inspect draw calls.\n\n"
+            "With ImGuiTableFlags_SkipClippedColumns, cells of columns scrolled out of view are skipped early. "
+            "With ImGuiTableColumnClipper, we only visit the cells of frozen and visible columns, so the cost of each row doesn't depend on the number of columns.");
+        static ImGuiTableFlags flags = ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_SkipClippedColumns;
+        static int columns_count = 100;
+        static bool columns_noclip = false;
+        static bool use_column_clipper = true;
+        static int freeze_cols = 1;
+        static int freeze_rows = 1;
+
+        PushStyleCompact();
+        ImGui::RadioButton("10 columns", &columns_count, 10); ImGui::SameLine();
+        ImGui::RadioButton("100 columns", &columns_count, 100); ImGui::SameLine();
+        ImGui::RadioButton("500 columns", &columns_count, 500); ImGui::SameLine();
+        ImGui::RadioButton("4000 columns", &columns_count, 4000);
+        ImGui::CheckboxFlags("ImGuiTableFlags_ScrollX", &flags, ImGuiTableFlags_ScrollX);
+        ImGui::CheckboxFlags("ImGuiTableFlags_SkipClippedColumns", &flags, ImGuiTableFlags_SkipClippedColumns);
+        ImGui::Checkbox("ImGuiTableColumnFlags_NoClip", &columns_noclip);
+        ImGui::Checkbox("Use ImGuiTableColumnClipper", &use_column_clipper);
+        ImGui::SetNextItemWidth(ImGui::GetFrameHeight());
+        ImGui::DragInt("freeze_cols", &freeze_cols, 0.2f, 0, 9, NULL, ImGuiSliderFlags_NoInput);
+        ImGui::SetNextItemWidth(ImGui::GetFrameHeight());
+        ImGui::DragInt("freeze_rows", &freeze_rows, 0.2f, 0, 9, NULL, ImGuiSliderFlags_NoInput);
+        PopStyleCompact();
+
+        ImGuiIO& io = ImGui::GetIO();
+        ImGui::Text("%.3f ms/frame (%.1f FPS), %d vertices, %d indices", 1000.0f / io.Framerate, io.Framerate, io.MetricsRenderVertices, io.MetricsRenderIndices);
+
+        ImVec2 outer_size = ImVec2(0.0f, TEXT_BASE_HEIGHT * 15);
+        if (ImGui::BeginTable("table_wide", columns_count, flags, outer_size))
+        {
+            ImGui::TableSetupScrollFreeze(freeze_cols, freeze_rows);
+            for (int column = 0; column < columns_count; column++)
+            {
+                char label[16];
+                sprintf(label, "Col %d", column);
+                ImGui::TableSetupColumn(label, columns_noclip ? ImGuiTableColumnFlags_NoClip : ImGuiTableColumnFlags_None);
+            }
+            ImGui::TableHeadersRow();
+
+            ImGuiTableColumnClipper column_clipper;
+            if (use_column_clipper)
+                column_clipper.Begin();
+
+            ImGuiListClipper clipper;
+            clipper.Begin(1000);
+            while (clipper.Step())
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                {
+                    ImGui::TableNextRow();
+                    if (use_column_clipper)
+                    {
+                        for (int n = 0; n < column_clipper.ColumnsCount; n++)
+                        {
+                            const int column = column_clipper.GetColumnIndex(n);
+                            if (ImGui::TableSetColumnIndex(column))
+                                ImGui::Text("%d,%d", column, row);
+                        }
+                    }
+                    else
+                    {
+                        for (int column = 0; column < columns_count; column++)
+                            if (ImGui::TableSetColumnIndex(column))
+                                ImGui::Text("%d,%d", column, row);
+                    }
+                }
+            ImGui::EndTable();
+        }
+        ImGui::TreePop();
+    }
+
     if (open_action != -1)
         ImGui::SetNextItemOpen(open_action != 0);
     IMGUI_DEMO_MARKER("Tables/Columns flags");
@@ -5450,6 +5565,8 @@ static void ShowDemoWindowTables()
                 ImGui::SameLine(); HelpMarker("Disable distributing remainder width to stretched columns (width allocation on a 100-wide table with 3 columns: Without this flag: 33,33,34. With this flag: 33,33,33). With larger number of columns, resizing will appear to be less smooth.");
                 ImGui::CheckboxFlags("ImGuiTableFlags_NoClip", &flags, ImGuiTableFlags_NoClip);
                 ImGui::SameLine(); HelpMarker("Disable clipping rectangle for every individual columns (reduce draw command count, items will be able to overflow into other columns). Generally incompatible with ScrollFreeze options.");
+                ImGui::CheckboxFlags("ImGuiTableFlags_SkipClippedColumns", &flags, ImGuiTableFlags_SkipClippedColumns);
+                ImGui::SameLine(); HelpMarker("Skip cells of columns which are out of sight. Items submitted into them are ignored and won't contribute to row height.");
                 ImGui::TreePop();
             }
 
@@ -11,6 +11,7 @@ Index of this file:
 // [SECTION] ImDrawList Shadow Primitives
 // [SECTION] ImDrawListSplitter
 // [SECTION] ImDrawData
+// [SECTION] ImDrawDataSnapshot
 // [SECTION] Helpers ShadeVertsXXX functions
 // [SECTION] ImFontAtlasShadowTexConfig
 // [SECTION] ImFontConfig
@@ -471,6 +472,12 @@ void ImDrawList::AddDrawCmd()
     draw_cmd.IdxOffset = IdxBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
+    if (CmdBuffer.Size == CmdBuffer.Capacity)
+    {
+        IM_ALLOC_SCOPE(ImGuiAllocCategory_DrawList);
+        CmdBuffer.push_back(draw_cmd);
+        return;
+    }
     CmdBuffer.push_back(draw_cmd);
 }
 
@@ -661,6 +668,15 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
     ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     draw_cmd->ElemCount += idx_count;
 
+    if (VtxBuffer.Size + vtx_count > VtxBuffer.Capacity || IdxBuffer.Size + idx_count > IdxBuffer.Capacity)
+    {
+        IM_ALLOC_SCOPE(ImGuiAllocCategory_DrawList);
+        if (VtxBuffer.Size + vtx_count > VtxBuffer.Capacity)
+            VtxBuffer.reserve(VtxBuffer._grow_capacity(VtxBuffer.Size + vtx_count));
+        if (IdxBuffer.Size + idx_count > IdxBuffer.Capacity)
+            IdxBuffer.reserve(IdxBuffer._grow_capacity(IdxBuffer.Size + idx_count));
+    }
+
     int vtx_buffer_old_size = VtxBuffer.Size;
     VtxBuffer.resize(vtx_buffer_old_size + vtx_count);
     _VtxWritePtr = VtxBuffer.Data + vtx_buffer_old_size;
@@ -2196,6 +2212,7 @@ static void AddSubtractedRect(ImDrawList* draw_list, const ImVec2& a_min, const
 
 void ImDrawList::AddShadowRect(const ImVec2& obj_min, const ImVec2& obj_max, ImU32 shadow_col, float shadow_thickness, const ImVec2& shadow_offset, ImDrawFlags flags, float obj_rounding)
 {
+    IMGUI_PROFILE_SCOPE("ImDrawList::AddShadowRect");
     if ((shadow_col & IM_COL32_A_MASK) == 0)
         return;
 
@@ -2256,6 +2273,7 @@ void ImDrawList::AddShadowRect(const ImVec2& obj_min, const ImVec2& obj_max, ImU
 // Add a shadow for a convex shape described by points and num_points
 void ImDrawList::AddShadowConvexPoly(const ImVec2* points, int points_count, ImU32 shadow_col, float shadow_thickness, const ImVec2& shadow_offset, ImDrawFlags flags)
 {
+    IMGUI_PROFILE_SCOPE("ImDrawList::AddShadowConvexPoly");
     const bool is_filled = (flags & ImDrawFlags_ShadowCutOutShapeBackground) == 0;
     IM_ASSERT((is_filled || (ImLengthSqr(shadow_offset) < 0.00001f)) && "Drawing circle/convex shape shadows with no center fill and an offset is not currently supported");
     IM_ASSERT(points_count >= 3);
@@ -2481,6 +2499,7 @@ void ImDrawList::AddShadowConvexPoly(const ImVec2* points, int points_count, ImU
 // Uses the draw path and so wipes any existing data there
 void ImDrawList::AddShadowCircle(const ImVec2& obj_center, float obj_radius, ImU32 shadow_col, float shadow_thickness, const ImVec2& shadow_offset, ImDrawFlags flags, int num_segments)
 {
+    IMGUI_PROFILE_SCOPE("ImDrawList::AddShadowCircle");
     // Obtain segment count
     if (num_segments <= 0)
     {
@@ -2539,6 +2558,7 @@ void ImDrawListSplitter::ClearFreeMemory()
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
     IM_UNUSED(draw_list);
+    IM_ALLOC_SCOPE(ImGuiAllocCategory_DrawList);
     IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
     int old_channels_count = _Channels.Size;
     if (old_channels_count < channels_count)
@@ -2571,6 +2591,7 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     // Note that we never use or rely on _Channels.Size because it is merely a buffer that we never shrink back to 0 to keep all sub-buffers ready for use.
     if (_Count <= 1)
         return;
+    IM_ALLOC_SCOPE(ImGuiAllocCategory_DrawList);
 
     SetCurrentChannel(draw_list, 0);
     draw_list->_PopUnusedDrawCmd();
@@ -2751,6 +2772,81 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
             cmd.ClipRect = ImVec4(cmd.ClipRect.x * fb_scale.x, cmd.ClipRect.y * fb_scale.y, cmd.ClipRect.z * fb_scale.x, cmd.ClipRect.w * fb_scale.y);
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawDataSnapshot
+//-----------------------------------------------------------------------------
+
+void ImDrawDataSnapshot::Clear()
+{
+    for (ImDrawDataSnapshotEntry& entry : Entries)
+        IM_DELETE(entry.OurCopy);
+    Entries.clear();
+    EntriesMap.Clear();
+    DrawData.Clear();
+}
+
+void ImDrawDataSnapshot::SnapUsingSwap(ImDrawData* src)
+{
+    ImDrawData* dst = &DrawData;
+    IM_ASSERT(src != dst && src->Valid);
+    SnapCount++;
+
+    // Copy all fields except CmdLists[] (assigning the ImVector<> would reallocate)
+    dst->Valid = src->Valid;
+    dst->CmdListsCount = src->CmdListsCount;
+    dst->TotalIdxCount = src->TotalIdxCount;
+    dst->TotalVtxCount = src->TotalVtxCount;
+    dst->DisplayPos = src->DisplayPos;
+    dst->DisplaySize = src->DisplaySize;
+    dst->FramebufferScale = src->FramebufferScale;
+    dst->OwnerViewport = src->OwnerViewport;
+
+    dst->CmdLists.resize(0);
+    for (ImDrawList* src_list : src->CmdLists)
+    {
+        // Find or create our copy
+        ImGuiID key = ImHashData(&src_list, sizeof(src_list));
+        int entry_idx = EntriesMap.GetInt(key, 0) - 1;
+        if (entry_idx < 0)
+        {
+            ImDrawDataSnapshotEntry new_entry;
+            new_entry.SrcList = src_list;
+            new_entry.OurCopy = IM_NEW(ImDrawList)(src_list->_Data);
+            entry_idx = Entries.Size;
+            Entries.push_back(new_entry);
+            EntriesMap.SetInt(key, entry_idx + 1);
+        }
+        ImDrawDataSnapshotEntry& entry = Entries[entry_idx];
+        entry.LastUsedFrame = SnapCount;
+
+        // Swap buffers. Both sides keep their capacity: the source list will clear and refill ours on the next frame.
+        ImDrawList* our_list = entry.OurCopy;
+        our_list->CmdBuffer.swap(src_list->CmdBuffer);
+        our_list->IdxBuffer.swap(src_list->IdxBuffer);
+        our_list->VtxBuffer.swap(src_list->VtxBuffer);
+        our_list->Flags = src_list->Flags;
+        dst->CmdLists.push_back(our_list);
+    }
+
+    // Free copies of draw lists which haven't been submitted for a while (e.g. closed windows)
+    bool removed_any = false;
+    for (int entry_idx = 0; entry_idx < Entries.Size; entry_idx++)
+        if (SnapCount - Entries[entry_idx].LastUsedFrame > CompactAfterFrames)
+        {
+            IM_DELETE(Entries[entry_idx].OurCopy);
+            Entries[entry_idx] = Entries.back();
+            Entries.pop_back();
+            entry_idx--;
+            removed_any = true;
+        }
+    if (removed_any)
+    {
+        EntriesMap.Clear();
+        for (int entry_idx = 0; entry_idx < Entries.Size; entry_idx++)
+            EntriesMap.SetInt(ImHashData(&Entries[entry_idx].SrcList, sizeof(ImDrawList*)), entry_idx + 1);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Helpers ShadeVertsXXX functions
 //-----------------------------------------------------------------------------
@@ -4716,6 +4812,7 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip) const
 {
+    IMGUI_PROFILE_SCOPE("ImFont::RenderText");
     if (!text_end)
         text_end = text_begin + strlen(text_begin); // ImGui:: functions generally already provides a valid text_end, so this is merely to handle direct calls.
 
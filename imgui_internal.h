@@ -192,8 +192,20 @@ typedef void (*ImGuiErrorLogCallback)(void* user_data, const char* fmt, ...);
 //-----------------------------------------------------------------------------
 
 #ifndef GImGui
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+extern thread_local ImGuiContext* GImGui;   // Current implicit context pointer, one per thread
+#else
 extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #endif
+#endif
+
+// Storage qualifier for function-local static state kept by widgets (e.g. animation maps).
+// Under IMGUI_ENABLE_THREAD_LOCAL_CONTEXT each thread gets its own copy, otherwise it is a plain static shared by all contexts.
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+#define IM_THREAD_LOCAL thread_local
+#else
+#define IM_THREAD_LOCAL
+#endif
 
 //-------------------------------------------------------------------------
 // [SECTION] STB libraries includes
@@ -348,6 +360,7 @@ namespace ImStb
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
 // - Helper: ImGuiTextIndex
+// - Helper: ImFrameArena
 //-----------------------------------------------------------------------------
 
 // Helpers: Hashing
@@ -376,6 +389,7 @@ IMGUI_API char*         ImStrdupcpy(char* dst, size_t* p_dst_size, const char* s
 IMGUI_API const char*   ImStrchrRange(const char* str_begin, const char* str_end, char c);  // Find first occurrence of 'c' in string range.
 IMGUI_API const char*   ImStreolRange(const char* str, const char* str_end);                // End end-of-line
 IMGUI_API const char*   ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end);  // Find a substring in a string range.
+IMGUI_API const char*   ImStristrUpper(const char* haystack, const char* haystack_end, const char* needle_upper, const char* needle_upper_end); // Find a substring in a string range, case insensitive, with a needle already converted with ImToUpper(). Vectorized.
 IMGUI_API void          ImStrTrimBlanks(char* str);                                         // Remove leading and trailing blanks from a buffer.
 IMGUI_API const char*   ImStrSkipBlank(const char* str);                                    // Find first non-blank character.
 IMGUI_API int           ImStrlenW(const ImWchar* str);                                      // Computer string length (ImWchar string)
@@ -738,6 +752,28 @@ struct ImGuiTextIndex
     void            append(const char* base, int old_size, int new_size);
 };
 
+// Helper: ImFrameArena
+// Linear allocator for transient allocations which only need to live until the next NewFrame().
+// Requests which don't fit fall back to MemAlloc() and are freed on Reset(), which also grows the block to the
+// high-water mark so that the following frames are served without touching the heap.
+struct IMGUI_API ImFrameArena
+{
+    char*           Data = NULL;
+    int             Size = 0;                               // Bytes used in Data[] this frame
+    int             Capacity = 0;
+    int             HighWaterMark = 0;                      // Bytes requested this frame, including overflow
+    int             LastHighWaterMark = 0;                  // HighWaterMark of the previous frame
+    int             OverflowCount = 0;                      // Number of MemAlloc() fallbacks this frame
+    int             LastOverflowCount = 0;
+    ImVector<void*> OverflowBlocks;
+
+    ~ImFrameArena()                                         { Clear(); }
+    void*           Alloc(size_t size);                     // 16-bytes aligned. Never returns NULL.
+    char*           Strdup(const char* str, const char* str_end = NULL);
+    void            Reset();
+    void            Clear();
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList support
 //-----------------------------------------------------------------------------
@@ -1787,10 +1823,60 @@ enum ImGuiDebugLogFlags_
     ImGuiDebugLogFlags_OutputToTestEngine = 1 << 11,  // Also send output to Test Engine
 };
 
+// Heap allocation audit (see io.ConfigDebugAllocAudit and the "Allocations" section of ShowMetricsWindow())
+// MemAlloc() attributes every allocation to the innermost ImGuiAllocScope, or to a default category depending on whether we are within NewFrame()..EndFrame().
+enum ImGuiAllocCategory : int
+{
+    ImGuiAllocCategory_None = -1,
+    ImGuiAllocCategory_Widget,          // Default within the frame scope
+    ImGuiAllocCategory_DrawList,
+    ImGuiAllocCategory_Window,
+    ImGuiAllocCategory_Storage,
+    ImGuiAllocCategory_Text,
+    ImGuiAllocCategory_Backend,         // Default outside the frame scope (backends, user code between Render() and NewFrame())
+    ImGuiAllocCategory_COUNT
+};
+
+struct ImGuiAllocStats
+{
+    int                     Count[ImGuiAllocCategory_COUNT];
+    size_t                  Bytes[ImGuiAllocCategory_COUNT];
+
+    ImGuiAllocStats()       { memset(this, 0, sizeof(*this)); }
+};
+
+struct ImGuiAllocAudit
+{
+    ImGuiAllocCategory      Category;           // Set by ImGuiAllocScope
+    const char*             Scope;              // Function name set by ImGuiAllocScope
+    ImGuiAllocStats         Frame;              // Accumulating for the current frame (NewFrame() to NewFrame())
+    ImGuiAllocStats         LastFrame;
+    int                     UnchangedFrames;    // Consecutive frames which processed no input event
+    bool                    Armed;              // UnchangedFrames >= io.ConfigDebugAllocAuditWarmupFrames: any allocation is reported
+    bool                    Reporting;          // Reporting allocates into the debug log, don't recurse
+    int                     ReportCount;
+    char                    LastReport[256];
+
+    ImGuiAllocAudit()       { Category = ImGuiAllocCategory_None; Scope = NULL; UnchangedFrames = 0; Armed = Reporting = false; ReportCount = 0; LastReport[0] = 0; }
+};
+
+// Attribute allocations made during the lifetime of this object to a category. Cheap, but keep out of per-vertex paths: prefer wrapping growth branches only.
+struct IMGUI_API ImGuiAllocScope
+{
+    ImGuiAllocAudit*        Audit;
+    ImGuiAllocCategory      BackupCategory;
+    const char*             BackupScope;
+
+    ImGuiAllocScope(ImGuiAllocCategory category, const char* scope);
+    ~ImGuiAllocScope();
+};
+#define IM_ALLOC_SCOPE(_CATEGORY)       ImGuiAllocScope im_alloc_scope(_CATEGORY, __FUNCTION__)
+
 struct ImGuiMetricsConfig
 {
     bool        ShowDebugLog = false;
     bool        ShowStackTool = false;
+    bool        ShowProfiler = false;
     bool        ShowWindowsRects = false;
     bool        ShowWindowsBeginOrder = false;
     bool        ShowTablesRects = false;
@@ -1825,6 +1911,135 @@ struct ImGuiStackTool
     ImGuiStackTool()        { memset(this, 0, sizeof(*this)); CopyToClipboardLastTime = -FLT_MAX; }
 };
 
+// Profiler (see ShowProfilerWindow())
+// Zones are recorded only while the profiler window is visible (or g.Profiler.Enabled is set), between two NewFrame() calls.
+// When not recording, a zone costs a load and a branch. Define IMGUI_DISABLE_PROFILER to compile them out.
+#if defined(IMGUI_DISABLE_DEBUG_TOOLS) && !defined(IMGUI_DISABLE_PROFILER)
+#define IMGUI_DISABLE_PROFILER
+#endif
+#define IMGUI_PROFILER_FRAMES           16      // Number of frames of zones kept for the flame graph
+#define IMGUI_PROFILER_HISTORY          240     // Number of frames of per-zone timings kept for percentiles
+
+struct ImGuiProfilerZone
+{
+    const char*             Name;               // Must be a literal/persistent string
+    ImGuiID                 WindowID;           // Window the zone is attributed to (current window when the zone started, 0 if none)
+    int                     Depth;
+    ImU64                   StartTime;          // In nanoseconds, see ProfilerGetTime()
+    ImU64                   EndTime;
+};
+
+struct ImGuiProfilerFrame
+{
+    int                     FrameCount;         // g.FrameCount of the recorded frame
+    ImU64                   StartTime;          // Start of NewFrame()
+    ImU64                   EndTime;            // End of the last zone (generally Render())
+    ImVector<ImGuiProfilerZone> Zones;          // Sorted by StartTime
+
+    ImGuiProfilerFrame()    { FrameCount = -1; StartTime = EndTime = 0; }
+};
+
+// Timings per zone name, accumulated over a frame
+struct ImGuiProfilerZoneStats
+{
+    const char*             Name;
+    int                     Calls;              // Last recorded frame
+    float                   TimeSelf;           // Last recorded frame, in milliseconds, excluding nested zones
+    float                   TimeTotal;          // Last recorded frame, in milliseconds, including nested zones (recursive zones are counted once)
+    float                   TimeTotalAvg;       // Smoothed TimeTotal, used to sort
+    float                   History[IMGUI_PROFILER_HISTORY]; // TimeTotal, indexed by ImGuiProfiler::HistoryIdx
+    ImU64                   AccumSelf;          // [Internal]
+    ImU64                   AccumTotal;         // [Internal]
+
+    ImGuiProfilerZoneStats() { memset(this, 0, sizeof(*this)); }
+};
+
+// Timings per window, accumulated over a frame
+struct ImGuiProfilerWindowStats
+{
+    ImGuiID                 ID;
+    int                     LastFrameCount;     // Last frame the window was recorded in
+    float                   TimeSelf;           // Milliseconds spent in zones attributed to the window (excluding its child windows)
+    float                   TimeTotal;          // Milliseconds spent between Begin() and End() of the window (including its child windows)
+    float                   TimeTotalAvg;       // Smoothed TimeTotal, used to sort
+    ImU64                   AccumSelf;          // [Internal]
+    ImU64                   AccumTotal;         // [Internal]
+
+    ImGuiProfilerWindowStats() { memset(this, 0, sizeof(*this)); }
+};
+
+struct ImGuiProfiler
+{
+    bool                    Enabled;            // Record even when the profiler window is not visible (e.g. for exporting zones)
+    bool                    Recording;          // Recording the current frame. Set by NewFrame().
+    bool                    Paused;             // Set by the profiler window: stop recording, keep data
+    int                     LastShowFrame;      // Last frame ShowProfilerWindow() was called
+    ImGuiProfilerFrame      Frames[IMGUI_PROFILER_FRAMES]; // Ring of recorded frames. Frames[FramesHead] is being recorded.
+    int                     FramesHead;
+    int                     FramesCount;        // Number of completed frames in the ring
+    ImVector<int>           Stack;              // Indices of open zones in Frames[FramesHead].Zones
+    ImVector<ImGuiProfilerZoneStats> ZonesStats;
+    ImGuiStorage            ZonesStatsMap;      // Hashed name -> index in ZonesStats
+    ImVector<ImGuiProfilerWindowStats> WindowsStats;
+    ImGuiStorage            WindowsStatsMap;    // Window ID -> index in WindowsStats
+    int                     HistoryIdx;         // Next entry written in ImGuiProfilerZoneStats::History[]
+    int                     HistoryCount;
+    ImVector<ImU64>         TempSelfTime;       // [Internal] Scratch buffers for ProfilerUpdateStats()
+    ImVector<ImU8>          TempIsOutermost;
+    ImVector<int>           TempOrder;          // [Internal] Scratch buffer for ShowProfilerWindow()
+
+    // Profiler window
+    int                     ViewFrame;          // Frame displayed in the flame graph, 0 = last recorded frame
+    float                   ViewZoom;
+
+    ImGuiProfiler()         { Enabled = Recording = Paused = false; LastShowFrame = -1; FramesHead = FramesCount = 0; HistoryIdx = HistoryCount = 0; ViewFrame = 0; ViewZoom = 1.0f; }
+
+    const ImGuiProfilerFrame* GetFrame(int n) const { IM_ASSERT(n >= 0 && n < FramesCount); return &Frames[(FramesHead - 1 - n + IMGUI_PROFILER_FRAMES) % IMGUI_PROFILER_FRAMES]; } // n = 0: last completed frame
+};
+
+// Per-item cost (see the "Widgets cost" section of ShowMetricsWindow())
+// What is emitted into the window draw list between an ItemAdd() and the next ItemAdd()/Begin()/End() is attributed to
+// that item, along with the CPU time spent. Geometry emitted into other draw lists (e.g. foreground) is not counted.
+struct ImGuiItemCost
+{
+    ImGuiID                 Key;                // Item ID, or hash of the window-relative position for items without an ID
+    ImGuiID                 ID;
+    ImGuiID                 WindowID;
+    int                     LastFrameCount;     // Last frame the item was submitted
+    ImRect                  Rect;               // Last submitted rectangle
+    int                     Count;              // Last recorded frame: number of submissions
+    int                     VtxCount;           // Last recorded frame
+    int                     IdxCount;           // "
+    int                     CmdCount;           // "
+    float                   Time;               // Last recorded frame, in microseconds
+    float                   TimeAvg;            // Smoothed Time
+    int                     AccumCount;         // [Internal] Accumulating for the current frame
+    int                     AccumVtxCount;
+    int                     AccumIdxCount;
+    int                     AccumCmdCount;
+    ImU64                   AccumTime;
+
+    ImGuiItemCost()         { memset(this, 0, sizeof(*this)); }
+};
+
+struct ImGuiItemCostRecorder
+{
+    bool                    Enabled;            // Set from the Metrics window
+    bool                    Recording;          // Enabled when the frame started
+    int                     CurrentIndex;       // Item being measured (index in Items[]), -1 if none
+    ImDrawList*             CurrentDrawList;
+    int                     CurrentVtxStart;
+    int                     CurrentIdxStart;
+    int                     CurrentCmdStart;
+    int                     CurrentChannel;     // Draw list splitter channel, -1 if not split
+    ImU64                   CurrentTimeStart;
+    ImVector<ImGuiItemCost> Items;
+    ImGuiStorage            ItemsMap;           // Key -> index in Items[]
+    ImVector<ImU64>         TempSortKeys;       // [Internal] Scratch buffer for the Metrics window
+
+    ImGuiItemCostRecorder() { Enabled = Recording = false; CurrentIndex = -1; CurrentDrawList = NULL; CurrentVtxStart = CurrentIdxStart = CurrentCmdStart = 0; CurrentChannel = -1; CurrentTimeStart = 0; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Generic context hooks
 //-----------------------------------------------------------------------------
@@ -1871,8 +2086,11 @@ struct ImGuiContext
     // Inputs
     ImVector<ImGuiInputEvent> InputEventsQueue;                 // Input events which will be trickled/written into IO structure.
     ImVector<ImGuiInputEvent> InputEventsTrail;                 // Past input events processed in NewFrame(). This is to allow domain-specific application to access e.g mouse/pen trail.
+    ImVector<ImVec2>        InputEventsMouseTrail;              // Mouse positions submitted since the last NewFrame() (when io.ConfigInputMouseTrailSize > 0). Ring buffer once full.
+    int                     InputEventsMouseTrailHead;          // Index of the oldest position in InputEventsMouseTrail[]
     ImGuiMouseSource        InputEventsNextMouseSource;
     ImU32                   InputEventsNextEventId;
+    ImVector<ImVec2>        MouseTrail;                         // Mouse positions submitted before the current frame, oldest first. Unlike InputEventsTrail, this includes moves merged by io.ConfigInputCoalesceMouseMoves.
 
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
@@ -2143,6 +2361,9 @@ struct ImGuiContext
     ImGuiID                 DebugItemPickerBreakId;             // Will call IM_DEBUG_BREAK() when encountering this ID
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiStackTool          DebugStackTool;
+    ImGuiAllocAudit         DebugAllocAudit;
+    ImGuiProfiler           Profiler;
+    ImGuiItemCostRecorder   DebugItemCost;
 
     // Misc
     float                   FramerateSecPerFrame[60];           // Calculate estimate of framerate for user over the last 60 frames..
@@ -2153,6 +2374,7 @@ struct ImGuiContext
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;
     ImVector<char>          TempBuffer;                         // Temporary text buffer
+    ImFrameArena            FrameArena;                         // Transient allocations, reset by NewFrame(). See MemAllocFrame().
 
     ImGuiContext(ImFontAtlas* shared_font_atlas)
     {
@@ -2174,6 +2396,7 @@ struct ImGuiContext
 
         InputEventsNextMouseSource = ImGuiMouseSource_Mouse;
         InputEventsNextEventId = 1;
+        InputEventsMouseTrailHead = 0;
 
         WindowsActiveCount = 0;
         CurrentWindow = NULL;
@@ -2590,7 +2813,7 @@ struct IMGUI_API ImGuiTabBar
 //-----------------------------------------------------------------------------
 
 #define IM_COL32_DISABLE                IM_COL32(0,0,0,1)   // Special sentinel code which cannot be used as a regular color.
-#define IMGUI_TABLE_MAX_COLUMNS         512                 // May be further lifted
+#define IMGUI_TABLE_MAX_COLUMNS         4096                // May be further lifted, but must stay < 32767 (ImGuiTableColumnIdx is 16-bit)
 
 // Our current column maximum is 64 but we may raise that in the future.
 typedef ImS16 ImGuiTableColumnIdx;
@@ -2619,7 +2842,7 @@ struct ImGuiTableColumn
     float                   ContentMaxXUnfrozen;
     float                   ContentMaxXHeadersUsed;         // Contents maximum position for headers rows (regardless of freezing). TableHeader() automatically softclip itself + report ideal desired size, to avoid creating extraneous draw calls
     float                   ContentMaxXHeadersIdeal;
-    ImS16                   NameOffset;                     // Offset into parent ColumnsNames[]
+    ImS32                   NameOffset;                     // Offset into parent ColumnsNames[]
     ImGuiTableColumnIdx     DisplayOrder;                   // Index within Table's IndexToDisplayOrder[] (column may be reordered by users)
     ImGuiTableColumnIdx     IndexWithinEnabledSet;          // Index within enabled/visible set (<= IndexToDisplayOrder)
     ImGuiTableColumnIdx     PrevEnabledColumn;              // Index of prev enabled/visible column within Columns[], -1 if first enabled/visible column
@@ -2635,7 +2858,9 @@ struct ImGuiTableColumn
     bool                    IsVisibleY;
     bool                    IsRequestOutput;                // Return value for TableSetColumnIndex() / TableNextColumn(): whether we request user to output contents or not.
     bool                    IsSkipItems;                    // Do we want item submissions to this column to be completely ignored (no layout will happen).
+    bool                    IsSkipCell;                     // Do we skip cells of this column entirely, without touching cursor or draw channel (ImGuiTableFlags_SkipClippedColumns).
     bool                    IsPreserveWidthAuto;
+    bool                    IsDrawChannelShared;            // Draw into the channel shared by visible NoClip columns, using a common clip rect (see TableSetupDrawChannels())
     ImS8                    NavLayerCurrent;                // ImGuiNavLayer in 1 byte
     ImU8                    AutoFitQueue;                   // Queue of 8 values for the next 8 frames to request auto-fit
     ImU8                    CannotSkipItemsQueue;           // Queue of 8 values for the next 8 frames to disable Clipped/SkipItem
@@ -2742,6 +2967,8 @@ struct IMGUI_API ImGuiTable
     ImDrawListSplitter*         DrawSplitter;               // Shortcut to TempData->DrawSplitter while in table. Isolate draw commands per columns to avoid switching clip rect constantly
     ImGuiTableInstanceData      InstanceDataFirst;
     ImVector<ImGuiTableInstanceData>    InstanceDataExtra;  // FIXME-OPT: Using a small-vector pattern would be good.
+    ImVector<ImGuiTableDrawChannelIdx> DrawChannelsMergeOrder; // Channels order computed by TableMergeDrawChannels(), reused while merge groups are unchanged
+    ImVector<ImU32>             DrawChannelsMergeKey;       // Channels count + merge groups masks which produced DrawChannelsMergeOrder[]
     ImGuiTableColumnSortSpecs   SortSpecsSingle;
     ImVector<ImGuiTableColumnSortSpecs> SortSpecsMulti;     // FIXME-OPT: Using a small-vector pattern would be good.
     ImGuiTableSortSpecs         SortSpecs;                  // Public facing sorts specs, this is what we return in TableGetSortSpecs()
@@ -3076,6 +3303,7 @@ namespace ImGui
     IMGUI_API int           CalcTypematicRepeatAmount(float t0, float t1, float repeat_delay, float repeat_rate);
     IMGUI_API void          GetTypematicRepeatRate(ImGuiInputFlags flags, float* repeat_delay, float* repeat_rate);
     IMGUI_API void          TeleportMousePos(const ImVec2& pos);
+    inline const ImVector<ImVec2>& GetMouseTrail()                                      { ImGuiContext& g = *GImGui; return g.MouseTrail; } // Mouse positions submitted before this frame, oldest first. Empty unless io.ConfigInputMouseTrailSize > 0.
     IMGUI_API void          SetActiveIdUsingAllKeyboardKeys();
     inline bool             IsActiveIdUsingNavDir(ImGuiDir dir)                         { ImGuiContext& g = *GImGui; return (g.ActiveIdUsingNavDirMask & (1 << dir)) != 0; }
 
@@ -3325,6 +3553,7 @@ namespace ImGui
 
     // Plot
     IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
+    IMGUI_API int           PlotBufferEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
@@ -3370,6 +3599,17 @@ namespace ImGui
     IMGUI_API void          DebugNodeViewport(ImGuiViewportP* viewport);
     IMGUI_API void          DebugRenderKeyboardPreview(ImDrawList* draw_list);
     IMGUI_API void          DebugRenderViewportThumbnail(ImDrawList* draw_list, ImGuiViewportP* viewport, const ImRect& bb);
+    IMGUI_API void          DebugItemCostNewFrame();
+    IMGUI_API void          DebugItemCostBeginItem(ImGuiWindow* window, ImGuiID id, const ImRect& bb); // Called by ItemAdd() when g.DebugItemCost.Recording is set
+    IMGUI_API void          DebugItemCostEndItem();
+
+    // Profiler
+    // Zones must be properly nested: prefer the IMGUI_PROFILE_SCOPE() macro.
+    IMGUI_API ImU64         ProfilerGetTime();                                      // Monotonic clock, in nanoseconds
+    IMGUI_API void          ProfilerNewFrame();
+    IMGUI_API void          ProfilerBeginZone(const char* name, ImGuiID window_id = 0); // window_id = 0: attribute to current window
+    IMGUI_API void          ProfilerEndZone();
+    IMGUI_API void          ProfilerUpdateStats(ImGuiProfilerFrame* frame);
 
     // Obsolete functions
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
@@ -3390,6 +3630,20 @@ namespace ImGui
 
 } // namespace ImGui
 
+// Record a profiler zone for the lifetime of this object (see ShowProfilerWindow())
+#ifndef IMGUI_DISABLE_PROFILER
+struct ImGuiProfilerScope
+{
+    bool                    Active;
+
+    ImGuiProfilerScope(const char* name)    { ImGuiContext* ctx = GImGui; Active = (ctx != NULL && ctx->Profiler.Recording); if (Active) ImGui::ProfilerBeginZone(name); }
+    ~ImGuiProfilerScope()                   { if (Active) ImGui::ProfilerEndZone(); }
+};
+#define IMGUI_PROFILE_SCOPE(_NAME)      ImGuiProfilerScope im_profiler_scope(_NAME)
+#else
+#define IMGUI_PROFILE_SCOPE(_NAME)      do { } while (0)
+#endif
+
 
 //-----------------------------------------------------------------------------
 // [SECTION] ImFontAtlas internal API
@@ -176,6 +176,11 @@ Index of this file:
 //
 // - We need to distinguish those cases because non-hidden columns that are clipped outside of scrolling bounds should still contribute their height to the row.
 //   However, in the majority of cases, the contribution to row height is the same for all columns, or the tallest cells are known by the programmer.
+// - With ImGuiTableFlags_SkipClippedColumns, case B behaves like case C without even setting up the cell: TableBeginCell()/TableEndCell()
+//   early out for those columns, items submitted into them are ignored and they don't contribute to row height.
+//   (they are still set up while a keyboard/gamepad navigation request is being scored, so navigation can reach out of view columns)
+// - With a large number of columns (e.g. thousands of columns with ImGuiTableFlags_ScrollX), iterating all columns on every row adds up
+//   even when clipped cells are cheap. Use ImGuiTableColumnClipper to only visit frozen columns + columns overlapping the scrolling view.
 //-----------------------------------------------------------------------------
 // About clipping/culling of whole Tables:
 // - Scrolling tables with a known outer size can be clipped earlier as BeginTable() will return false.
@@ -257,7 +262,15 @@ static const float TABLE_BORDER_SIZE                     = 1.0f;    // FIXME-TAB
 static const float TABLE_RESIZE_SEPARATOR_HALF_THICKNESS = 4.0f;    // Extend outside inner borders.
 static const float TABLE_RESIZE_SEPARATOR_FEEDBACK_TIMER = 0.06f;   // Delay/timer before making the hover feedback (color+cursor) visible because tables/columns tends to be more cramped.
 
-// Helper
+// Helpers
+// Columns sharing a draw channel (see TableSetupDrawChannels()) all use the same clip rect, so their contents end up in a same draw command.
+static inline ImRect TableGetColumnDrawClipRect(const ImGuiTable* table, const ImGuiTableColumn* column)
+{
+    if (!column->IsDrawChannelShared)
+        return column->ClipRect;
+    return ImRect(table->InnerClipRect.Min.x, column->ClipRect.Min.y, table->InnerClipRect.Max.x, column->ClipRect.Max.y);
+}
+
 inline ImGuiTableFlags TableFixFlags(ImGuiTableFlags flags, ImGuiWindow* outer_window)
 {
     // Adjust flags: set default sizing policy
@@ -986,6 +999,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     // Process columns in their visible orders as we are comparing the visible order and adjusting host_clip_rect while looping.
     int visible_n = 0;
     bool has_at_least_one_column_requesting_output = false;
+    const bool skip_clipped_cells = (table->Flags & ImGuiTableFlags_SkipClippedColumns) && !g.NavMoveScoringItems; // Let nav reach out-of-view cells
     bool offset_x_frozen = (table->FreezeColumnsCount > 0);
     float offset_x = ((table->FreezeColumnsCount > 0) ? table->OuterRect.Min.x : work_rect.Min.x) + table->OuterPaddingX - table->CellSpacingX1;
     ImRect host_clip_rect = table->InnerClipRect;
@@ -1018,6 +1032,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
             column->ClipRect.ClipWithFull(host_clip_rect);
             column->IsVisibleX = column->IsVisibleY = column->IsRequestOutput = false;
             column->IsSkipItems = true;
+            column->IsSkipCell = skip_clipped_cells;
             column->ItemWidth = 1.0f;
             continue;
         }
@@ -1072,6 +1087,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
             IM_ASSERT(!is_visible);
         if (column->IsRequestOutput && !column->IsSkipItems)
             has_at_least_one_column_requesting_output = true;
+        column->IsSkipCell = skip_clipped_cells && !column->IsRequestOutput;
 
         // Update status flags
         column->Flags |= ImGuiTableColumnFlags_IsEnabled;
@@ -1115,6 +1131,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     {
         table->Columns[table->LeftMostEnabledColumn].IsRequestOutput = true;
         table->Columns[table->LeftMostEnabledColumn].IsSkipItems = false;
+        table->Columns[table->LeftMostEnabledColumn].IsSkipCell = false;
     }
 
     // [Part 7] Detect/store when we are hovering the unused space after the right-most column (so e.g. context menus can react on it)
@@ -1256,6 +1273,10 @@ void    ImGui::EndTable()
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT(table != NULL && "Only call EndTable() if BeginTable() returns true!");
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    if (g.DebugItemCost.Recording)
+        DebugItemCostEndItem(); // Don't attribute merging draw channels to the last cell
+#endif
 
     // This assert would be very useful to catch a common error... unfortunately it would probably trigger in some
     // cases, and for consistency user may sometimes output empty tables (and still benefit from e.g. outer border)
@@ -1525,7 +1546,7 @@ void ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags, flo
     column->NameOffset = -1;
     if (label != NULL && label[0] != 0)
     {
-        column->NameOffset = (ImS16)table->ColumnsNames.size();
+        column->NameOffset = (ImS32)table->ColumnsNames.size();
         table->ColumnsNames.append(label, label + strlen(label) + 1);
     }
 }
@@ -1941,7 +1962,7 @@ void ImGui::TableEndRow(ImGuiTable* table)
         }
 
         // Update cliprect ahead of TableBeginCell() so clipper can access to new ClipRect->Min.y
-        SetWindowClipRectBeforeSetChannel(window, table->Columns[0].ClipRect);
+        SetWindowClipRectBeforeSetChannel(window, TableGetColumnDrawClipRect(table, &table->Columns[0]));
         table->DrawSplitter->SetCurrentChannel(window->DrawList, table->Columns[0].DrawChannelCurrent);
     }
 
@@ -1958,6 +1979,7 @@ void ImGui::TableEndRow(ImGuiTable* table)
 // - TableNextColumn()
 // - TableBeginCell() [Internal]
 // - TableEndCell() [Internal]
+// - ImGuiTableColumnClipper
 //-------------------------------------------------------------------------
 
 int ImGui::TableGetColumnIndex()
@@ -2026,6 +2048,15 @@ void ImGui::TableBeginCell(ImGuiTable* table, int column_n)
     ImGuiWindow* window = table->InnerWindow;
     table->CurrentColumn = column_n;
 
+    // With ImGuiTableFlags_SkipClippedColumns, out of sight cells are skipped entirely: ignore items but leave cursor and draw channel alone.
+    if (column->IsSkipCell)
+    {
+        window->SkipItems = true;
+        g.LastItemData.ID = 0;
+        g.LastItemData.StatusFlags = 0;
+        return;
+    }
+
     // Start position is roughly ~~ CellRect.Min + CellPadding + Indent
     float start_x = column->WorkMinX;
     if (column->Flags & ImGuiTableColumnFlags_IndentEnable)
@@ -2061,7 +2092,7 @@ void ImGui::TableBeginCell(ImGuiTable* table, int column_n)
     else
     {
         // FIXME-TABLE: Could avoid this if draw channel is dummy channel?
-        SetWindowClipRectBeforeSetChannel(window, column->ClipRect);
+        SetWindowClipRectBeforeSetChannel(window, TableGetColumnDrawClipRect(table, column));
         table->DrawSplitter->SetCurrentChannel(window->DrawList, column->DrawChannelCurrent);
     }
 
@@ -2078,6 +2109,8 @@ void ImGui::TableEndCell(ImGuiTable* table)
 {
     ImGuiTableColumn* column = &table->Columns[table->CurrentColumn];
     ImGuiWindow* window = table->InnerWindow;
+    if (column->IsSkipCell)
+        return;
 
     if (window->DC.IsSetPos)
         ErrorCheckUsingSetCursorPosToExtendParentBoundaries();
@@ -2098,6 +2131,48 @@ void ImGui::TableEndCell(ImGuiTable* table)
     table->RowTextBaseline = ImMax(table->RowTextBaseline, window->DC.PrevLineTextBaseOffset);
 }
 
+// Compute the range of columns to submit for the current frame (frozen columns + columns requesting output), in display order.
+// Positions are increasing in display order, so columns overlapping the scrolling view are contiguous.
+void ImGuiTableColumnClipper::Begin()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL && "Need to call ImGuiTableColumnClipper::Begin() between BeginTable()/EndTable()!");
+    if (!table->IsLayoutLocked)
+        ImGui::TableUpdateLayout(table);
+    TempData = table;
+
+    // Frozen columns: FreezeColumnsCount counts enabled columns, find where they end in display order.
+    FrozenCount = 0;
+    for (int enabled_n = 0; FrozenCount < table->ColumnsCount && enabled_n < table->FreezeColumnsCount; FrozenCount++)
+        if (table->Columns[table->DisplayOrderToIndex[FrozenCount]].IsEnabled)
+            enabled_n++;
+
+    DisplayStart = DisplayEnd = FrozenCount;
+    for (int order_n = FrozenCount; order_n < table->ColumnsCount; order_n++)
+        if (table->Columns[table->DisplayOrderToIndex[order_n]].IsRequestOutput)
+        {
+            if (DisplayStart == DisplayEnd)
+                DisplayStart = order_n;
+            DisplayEnd = order_n + 1;
+        }
+
+    // Include one more column on each side while scoring a navigation request, so it can move into them and scroll them into view.
+    if (g.NavMoveScoringItems && DisplayStart < DisplayEnd)
+    {
+        DisplayStart = ImMax(DisplayStart - 1, FrozenCount);
+        DisplayEnd = ImMin(DisplayEnd + 1, (int)table->ColumnsCount);
+    }
+    ColumnsCount = FrozenCount + DisplayEnd - DisplayStart;
+}
+
+int ImGuiTableColumnClipper::GetColumnIndex(int n) const
+{
+    ImGuiTable* table = (ImGuiTable*)TempData;
+    IM_ASSERT(n >= 0 && n < ColumnsCount);
+    return table->DisplayOrderToIndex[(n < FrozenCount) ? n : DisplayStart + n - FrozenCount];
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Columns width management
 //-------------------------------------------------------------------------
@@ -2339,16 +2414,34 @@ void ImGui::TablePopBackgroundChannel()
 //   channels, while simplifying per-row/per-cell overhead. It will be empty and discarded when merged.
 // - We allocate 1 or 2 background draw channels. This is because we know TablePushBackgroundChannel() is only used for
 //   horizontal spanning. If we allowed vertical spanning we'd need one background draw channel per merge group (1-4).
+// - We only allocate channels for visible columns. With many columns and horizontal scrolling, most of them are
+//   clipped and redirected to the dummy channel, so the cost of splitting/merging stays proportional to what is on screen.
+// - Visible columns using ImGuiTableColumnFlags_NoClip don't need a clip rect of their own: when there are no frozen
+//   columns they all share a single channel and a common clip rect, see TableGetColumnDrawClipRect().
 // Draw channel allocation (before merging):
 // - NoClip                       --> 2+D+1 channels: bg0/1 + bg2 + foreground (same clip rect == always 1 draw call)
 // - Clip                         --> 2+D+N channels
 // - FreezeRows                   --> 2+D+N*2 (unless scrolling value is zero)
 // - FreezeRows || FreezeColunns  --> 3+D+N*2 (unless scrolling value is zero)
 // Where D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
+// Where N is the number of visible columns, with all visible NoClip columns counting as 1.
 void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 {
+    const bool share_noclip_columns = (table->FreezeColumnsCount == 0) && !(table->Flags & ImGuiTableFlags_NoClip);
+    int channels_for_columns = 0;
+    int channels_for_shared = 0;
+    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    {
+        ImGuiTableColumn* column = &table->Columns[column_n];
+        column->IsDrawChannelShared = share_noclip_columns && column->IsVisibleX && column->IsVisibleY && (column->Flags & ImGuiTableColumnFlags_NoClip);
+        if (column->IsDrawChannelShared)
+            channels_for_shared = 1;
+        else if (column->IsVisibleX && column->IsVisibleY)
+            channels_for_columns++;
+    }
+
     const int freeze_row_multiplier = (table->FreezeRowsCount > 0) ? 2 : 1;
-    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsEnabledCount;
+    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : ImMax(channels_for_columns + channels_for_shared, 1);
     const int channels_for_bg = 1 + 1 * freeze_row_multiplier;
     const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || (memcmp(table->VisibleMaskByIndex, table->EnabledMaskByIndex, ImBitArrayGetStorageSizeInBytes(table->ColumnsCount)) != 0)) ? +1 : 0;
     const int channels_total = channels_for_bg + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
@@ -2358,15 +2451,25 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
     table->Bg2DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)((table->FreezeRowsCount > 0) ? 2 + channels_for_row : TABLE_DRAW_CHANNEL_BG2_FROZEN);
 
     int draw_channel_current = 2;
+    int draw_channel_shared = -1;
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
     {
         ImGuiTableColumn* column = &table->Columns[column_n];
         if (column->IsVisibleX && column->IsVisibleY)
         {
-            column->DrawChannelFrozen = (ImGuiTableDrawChannelIdx)(draw_channel_current);
-            column->DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)(draw_channel_current + (table->FreezeRowsCount > 0 ? channels_for_row + 1 : 0));
-            if (!(table->Flags & ImGuiTableFlags_NoClip))
+            int draw_channel = draw_channel_current;
+            if (column->IsDrawChannelShared)
+            {
+                if (draw_channel_shared == -1)
+                    draw_channel_shared = draw_channel_current++;
+                draw_channel = draw_channel_shared;
+            }
+            else if (!(table->Flags & ImGuiTableFlags_NoClip))
+            {
                 draw_channel_current++;
+            }
+            column->DrawChannelFrozen = (ImGuiTableDrawChannelIdx)(draw_channel);
+            column->DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)(draw_channel + (table->FreezeRowsCount > 0 ? channels_for_row + 1 : 0));
         }
         else
         {
@@ -2401,8 +2504,10 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 // When the contents of a column didn't stray off its limit, we move its channels into the corresponding group
 // based on its position (within frozen rows/columns groups or not).
 // At the end of the operation our 1-4 groups will each have a ImDrawCmd using the same ClipRect.
-// This function assume that each column are pointing to a distinct draw channel,
-// otherwise merge_group->ChannelsCount will not match set bit count of merge_group->ChannelsMask.
+// Columns sharing a draw channel (NoClip columns, see TableSetupDrawChannels()) only register that channel once,
+// so merge_group->ChannelsCount matches set bit count of merge_group->ChannelsMask.
+// When merge groups are identical to the ones of the previous call (typically when layout and contents are stable),
+// we reuse the channel order computed by that call instead of rebuilding it.
 //
 // Column channels will not be merged into one of the 1-4 groups in the following cases:
 // - The contents stray off its clipping rectangle (we only compare the MaxX value, not the MinX value).
@@ -2477,6 +2582,8 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
             const int merge_group_n = (has_freeze_h && column_n < table->FreezeColumnsCount ? 0 : 1) + (has_freeze_v && merge_group_sub_n == 0 ? 0 : 2);
             IM_ASSERT(channel_no < max_draw_channels);
             MergeGroup* merge_group = &merge_groups[merge_group_n];
+            if (IM_BITARRAY_TESTBIT(merge_group->ChannelsMask, channel_no)) // Shared channel already registered
+                continue;
             if (merge_group->ChannelsCount == 0)
                 merge_group->ClipRect = ImRect(+FLT_MAX, +FLT_MAX, -FLT_MAX, -FLT_MAX);
             ImBitArraySetBit(merge_group->ChannelsMask, channel_no);
@@ -2513,70 +2620,106 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
     {
         // We skip channel 0 (Bg0/Bg1) and 1 (Bg2 frozen) from the shuffling since they won't move - see channels allocation in TableSetupDrawChannels().
         const int LEADING_DRAW_CHANNELS = 2;
-        g.DrawChannelsTempMergeBuffer.resize(splitter->_Count - LEADING_DRAW_CHANNELS); // Use shared temporary storage so the allocation gets amortized
-        ImDrawChannel* dst_tmp = g.DrawChannelsTempMergeBuffer.Data;
-        ImBitArraySetBitRange(remaining_mask, LEADING_DRAW_CHANNELS, splitter->_Count);
-        ImBitArrayClearBit(remaining_mask, table->Bg2DrawChannelUnfrozen);
         IM_ASSERT(has_freeze_v == false || table->Bg2DrawChannelUnfrozen != TABLE_DRAW_CHANNEL_BG2_FROZEN);
-        int remaining_count = splitter->_Count - (has_freeze_v ? LEADING_DRAW_CHANNELS + 1 : LEADING_DRAW_CHANNELS);
+
+        // Compute the final clip rect of each merge group
         //ImRect host_rect = (table->InnerWindow == table->OuterWindow) ? table->InnerClipRect : table->HostClipRect;
         ImRect host_rect = table->HostClipRect;
+        ImRect merge_clip_rects[IM_ARRAYSIZE(merge_groups)];
         for (int merge_group_n = 0; merge_group_n < IM_ARRAYSIZE(merge_groups); merge_group_n++)
         {
-            if (int merge_channels_count = merge_groups[merge_group_n].ChannelsCount)
+            MergeGroup* merge_group = &merge_groups[merge_group_n];
+            if (merge_group->ChannelsCount == 0)
+                continue;
+            ImRect merge_clip_rect = merge_group->ClipRect;
+
+            // Extend outer-most clip limits to match those of host, so draw calls can be merged even if
+            // outer-most columns have some outer padding offsetting them from their parent ClipRect.
+            // The principal cases this is dealing with are:
+            // - On a same-window table (not scrolling = single group), all fitting columns ClipRect -> will extend and match host ClipRect -> will merge
+            // - Columns can use padding and have left-most ClipRect.Min.x and right-most ClipRect.Max.x != from host ClipRect -> will extend and match host ClipRect -> will merge
+            // FIXME-TABLE FIXME-WORKRECT: We are wasting a merge opportunity on tables without scrolling if column doesn't fit
+            // within host clip rect, solely because of the half-padding difference between window->WorkRect and window->InnerClipRect.
+            if ((merge_group_n & 1) == 0 || !has_freeze_h)
+                merge_clip_rect.Min.x = ImMin(merge_clip_rect.Min.x, host_rect.Min.x);
+            if ((merge_group_n & 2) == 0 || !has_freeze_v)
+                merge_clip_rect.Min.y = ImMin(merge_clip_rect.Min.y, host_rect.Min.y);
+            if ((merge_group_n & 1) != 0)
+                merge_clip_rect.Max.x = ImMax(merge_clip_rect.Max.x, host_rect.Max.x);
+            if ((merge_group_n & 2) != 0 && (table->Flags & ImGuiTableFlags_NoHostExtendY) == 0)
+                merge_clip_rect.Max.y = ImMax(merge_clip_rect.Max.y, host_rect.Max.y);
+            //GetForegroundDrawList()->AddRect(merge_group->ClipRect.Min, merge_group->ClipRect.Max, IM_COL32(255, 0, 0, 200), 0.0f, 0, 1.0f); // [DEBUG]
+            //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Min, merge_clip_rect.Min, IM_COL32(255, 100, 0, 200));
+            //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Max, merge_clip_rect.Max, IM_COL32(255, 100, 0, 200));
+            merge_clip_rects[merge_group_n] = merge_clip_rect;
+        }
+
+        // Build channel order, unless merge groups are the same as last time.
+        // The order only depends on channels count, position of Bg2DrawChannelUnfrozen and merge groups masks (stored contiguously).
+        const int masks_words = (size_for_masks_bitarrays_one >> 2) * IM_ARRAYSIZE(merge_groups);
+        ImVector<ImU32>& merge_key = table->DrawChannelsMergeKey;
+        ImVector<ImGuiTableDrawChannelIdx>& merge_order = table->DrawChannelsMergeOrder;
+        const bool reuse_order = merge_key.Size == 2 + masks_words && merge_key[0] == (ImU32)splitter->_Count && merge_key[1] == (ImU32)table->Bg2DrawChannelUnfrozen
+            && memcmp(merge_key.Data + 2, merge_groups[0].ChannelsMask, masks_words * sizeof(ImU32)) == 0;
+        if (!reuse_order)
+        {
+            merge_key.resize(2 + masks_words);
+            merge_key[0] = (ImU32)splitter->_Count;
+            merge_key[1] = (ImU32)table->Bg2DrawChannelUnfrozen;
+            memcpy(merge_key.Data + 2, merge_groups[0].ChannelsMask, masks_words * sizeof(ImU32));
+            merge_order.resize(0);
+            merge_order.reserve(splitter->_Count - LEADING_DRAW_CHANNELS);
+
+            ImBitArraySetBitRange(remaining_mask, LEADING_DRAW_CHANNELS, splitter->_Count);
+            ImBitArrayClearBit(remaining_mask, table->Bg2DrawChannelUnfrozen);
+            int remaining_count = splitter->_Count - (has_freeze_v ? LEADING_DRAW_CHANNELS + 1 : LEADING_DRAW_CHANNELS);
+            for (int merge_group_n = 0; merge_group_n < IM_ARRAYSIZE(merge_groups); merge_group_n++)
             {
-                MergeGroup* merge_group = &merge_groups[merge_group_n];
-                ImRect merge_clip_rect = merge_group->ClipRect;
-
-                // Extend outer-most clip limits to match those of host, so draw calls can be merged even if
-                // outer-most columns have some outer padding offsetting them from their parent ClipRect.
-                // The principal cases this is dealing with are:
-                // - On a same-window table (not scrolling = single group), all fitting columns ClipRect -> will extend and match host ClipRect -> will merge
-                // - Columns can use padding and have left-most ClipRect.Min.x and right-most ClipRect.Max.x != from host ClipRect -> will extend and match host ClipRect -> will merge
-                // FIXME-TABLE FIXME-WORKRECT: We are wasting a merge opportunity on tables without scrolling if column doesn't fit
-                // within host clip rect, solely because of the half-padding difference between window->WorkRect and window->InnerClipRect.
-                if ((merge_group_n & 1) == 0 || !has_freeze_h)
-                    merge_clip_rect.Min.x = ImMin(merge_clip_rect.Min.x, host_rect.Min.x);
-                if ((merge_group_n & 2) == 0 || !has_freeze_v)
-                    merge_clip_rect.Min.y = ImMin(merge_clip_rect.Min.y, host_rect.Min.y);
-                if ((merge_group_n & 1) != 0)
-                    merge_clip_rect.Max.x = ImMax(merge_clip_rect.Max.x, host_rect.Max.x);
-                if ((merge_group_n & 2) != 0 && (table->Flags & ImGuiTableFlags_NoHostExtendY) == 0)
-                    merge_clip_rect.Max.y = ImMax(merge_clip_rect.Max.y, host_rect.Max.y);
-                //GetForegroundDrawList()->AddRect(merge_group->ClipRect.Min, merge_group->ClipRect.Max, IM_COL32(255, 0, 0, 200), 0.0f, 0, 1.0f); // [DEBUG]
-                //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Min, merge_clip_rect.Min, IM_COL32(255, 100, 0, 200));
-                //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Max, merge_clip_rect.Max, IM_COL32(255, 100, 0, 200));
-                remaining_count -= merge_group->ChannelsCount;
-                for (int n = 0; n < (size_for_masks_bitarrays_one >> 2); n++)
-                    remaining_mask[n] &= ~merge_group->ChannelsMask[n];
-                for (int n = 0; n < splitter->_Count && merge_channels_count != 0; n++)
+                if (int merge_channels_count = merge_groups[merge_group_n].ChannelsCount)
                 {
-                    // Copy + overwrite new clip rect
-                    if (!IM_BITARRAY_TESTBIT(merge_group->ChannelsMask, n))
-                        continue;
-                    IM_BITARRAY_CLEARBIT(merge_group->ChannelsMask, n);
-                    merge_channels_count--;
-
-                    ImDrawChannel* channel = &splitter->_Channels[n];
-                    IM_ASSERT(channel->_CmdBuffer.Size == 1 && merge_clip_rect.Contains(ImRect(channel->_CmdBuffer[0].ClipRect)));
-                    channel->_CmdBuffer[0].ClipRect = merge_clip_rect.ToVec4();
-                    memcpy(dst_tmp++, channel, sizeof(ImDrawChannel));
+                    MergeGroup* merge_group = &merge_groups[merge_group_n];
+                    remaining_count -= merge_group->ChannelsCount;
+                    for (int n = 0; n < (size_for_masks_bitarrays_one >> 2); n++)
+                        remaining_mask[n] &= ~merge_group->ChannelsMask[n];
+                    for (int n = 0; n < splitter->_Count && merge_channels_count != 0; n++)
+                    {
+                        if (!IM_BITARRAY_TESTBIT(merge_group->ChannelsMask, n))
+                            continue;
+                        merge_channels_count--;
+                        merge_order.push_back((ImGuiTableDrawChannelIdx)n);
+                    }
                 }
+
+                // Make sure Bg2DrawChannelUnfrozen appears in the middle of our groups (whereas Bg0/Bg1 and Bg2 frozen are fixed to 0 and 1)
+                if (merge_group_n == 1 && has_freeze_v)
+                    merge_order.push_back(table->Bg2DrawChannelUnfrozen);
             }
 
-            // Make sure Bg2DrawChannelUnfrozen appears in the middle of our groups (whereas Bg0/Bg1 and Bg2 frozen are fixed to 0 and 1)
-            if (merge_group_n == 1 && has_freeze_v)
-                memcpy(dst_tmp++, &splitter->_Channels[table->Bg2DrawChannelUnfrozen], sizeof(ImDrawChannel));
+            // Append unmergeable channels that we didn't reorder at the end of the list
+            for (int n = 0; n < splitter->_Count && remaining_count != 0; n++)
+            {
+                if (!IM_BITARRAY_TESTBIT(remaining_mask, n))
+                    continue;
+                merge_order.push_back((ImGuiTableDrawChannelIdx)n);
+                remaining_count--;
+            }
+            IM_ASSERT(merge_order.Size == splitter->_Count - LEADING_DRAW_CHANNELS);
         }
 
-        // Append unmergeable channels that we didn't reorder at the end of the list
-        for (int n = 0; n < splitter->_Count && remaining_count != 0; n++)
+        // Copy channels in their new order + overwrite clip rect of merged ones
+        g.DrawChannelsTempMergeBuffer.resize(splitter->_Count - LEADING_DRAW_CHANNELS); // Use shared temporary storage so the allocation gets amortized
+        ImDrawChannel* dst_tmp = g.DrawChannelsTempMergeBuffer.Data;
+        for (ImGuiTableDrawChannelIdx channel_no : merge_order)
         {
-            if (!IM_BITARRAY_TESTBIT(remaining_mask, n))
-                continue;
-            ImDrawChannel* channel = &splitter->_Channels[n];
+            ImDrawChannel* channel = &splitter->_Channels[channel_no];
+            for (int merge_group_n = 0; merge_group_n < IM_ARRAYSIZE(merge_groups); merge_group_n++)
+                if (IM_BITARRAY_TESTBIT(merge_groups[merge_group_n].ChannelsMask, channel_no))
+                {
+                    IM_ASSERT(channel->_CmdBuffer.Size == 1 && merge_clip_rects[merge_group_n].Contains(ImRect(channel->_CmdBuffer[0].ClipRect)));
+                    channel->_CmdBuffer[0].ClipRect = merge_clip_rects[merge_group_n].ToVec4();
+                    break;
+                }
             memcpy(dst_tmp++, channel, sizeof(ImDrawChannel));
-            remaining_count--;
         }
         IM_ASSERT(dst_tmp == g.DrawChannelsTempMergeBuffer.Data + g.DrawChannelsTempMergeBuffer.Size);
         memcpy(splitter->_Channels.Data + LEADING_DRAW_CHANNELS, g.DrawChannelsTempMergeBuffer.Data, (splitter->_Count - LEADING_DRAW_CHANNELS) * sizeof(ImDrawChannel));
@@ -3572,6 +3715,8 @@ void ImGui::TableGcCompactTransientBuffers(ImGuiTable* table)
     table->SortSpecsMulti.clear();
     table->IsSortSpecsDirty = true; // FIXME: In theory shouldn't have to leak into user performing a sort on resume.
     table->ColumnsNames.clear();
+    table->DrawChannelsMergeOrder.clear();
+    table->DrawChannelsMergeKey.clear();
     table->MemoryCompacted = true;
     for (int n = 0; n < table->ColumnsCount; n++)
         table->Columns[n].NameOffset = -1;
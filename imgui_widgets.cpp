@@ -492,6 +492,7 @@ void ImGui::BulletTextV(const char* fmt, va_list args)
 
 bool ImGui::ButtonBehavior(const ImRect& bb, ImGuiID id, bool* out_hovered, bool* out_held, ImGuiButtonFlags flags)
 {
+    IMGUI_PROFILE_SCOPE("ButtonBehavior");
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = GetCurrentWindow();
 
@@ -725,7 +726,7 @@ bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags
 
     bool hovered, held, pressed = ButtonBehavior(bb, id, &hovered, &held, flags);
 
-    static std::map<ImGuiID, button_state> anim;
+    static IM_THREAD_LOCAL std::map<ImGuiID, button_state> anim;
     auto it_anim = anim.find(id);
 
     if (it_anim == anim.end())
@@ -1148,6 +1149,7 @@ struct tab_state
 
 bool ImGui::Tab(const char* label, ImTextureID icon, const ImVec2& size_arg, bool active)
 {
+    IMGUI_PROFILE_SCOPE("Tab");
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
@@ -1168,7 +1170,7 @@ bool ImGui::Tab(const char* label, ImTextureID icon, const ImVec2& size_arg, boo
     if (pressed)
         MarkItemEdited(id);
 
-    static std::map<ImGuiID, tab_state> anim;
+    static IM_THREAD_LOCAL std::map<ImGuiID, tab_state> anim;
     auto it_anim = anim.find(id);
 
     if (it_anim == anim.end())
@@ -1198,6 +1200,7 @@ struct checkbox_state
 
 bool ImGui::Checkbox(const char* label, bool* v)
 {
+    IMGUI_PROFILE_SCOPE("Checkbox");
     ImGuiWindow* window = GetCurrentWindow();
 
     if (window->SkipItems) return false;
@@ -1224,7 +1227,7 @@ bool ImGui::Checkbox(const char* label, bool* v)
         MarkItemEdited(id);
     }
 
-    static std::map<ImGuiID, checkbox_state> anim;
+    static IM_THREAD_LOCAL std::map<ImGuiID, checkbox_state> anim;
     auto it_anim = anim.find(id);
 
     if (it_anim == anim.end())
@@ -1936,8 +1939,6 @@ const char* keys[] =
     "Alt"
 };
 
-#include <string>
-
 struct key_state
 {
     ImVec4 background, text, image;
@@ -1949,6 +1950,7 @@ struct key_state
 
 bool ImGui::Keybind(ImTextureID icon, const char* label, int* key, int* mode, bool label_active)
 {
+    IMGUI_PROFILE_SCOPE("Keybind");
     ImGuiWindow* window = ImGui::GetCurrentWindow();
     if (window->SkipItems)
         return false;
@@ -1972,11 +1974,8 @@ bool ImGui::Keybind(ImTextureID icon, const char* label, int* key, int* mode, bo
     bool value_changed = false;
     int k = *key;
 
-    std::string active_key = "";
-    active_key += keys[*key];
-
     if (*key != 0 && g.ActiveId != id) {
-        strcpy_s(buf_display, active_key.c_str());
+        ImStrncpy(buf_display, keys[*key], IM_ARRAYSIZE(buf_display));
     }
     else if (g.ActiveId == id) {
         strcpy_s(buf_display, "-");
@@ -1987,7 +1986,7 @@ bool ImGui::Keybind(ImTextureID icon, const char* label, int* key, int* mode, bo
     ImRect clickable(ImVec2(rect.Max.x - 19 - label_size.x, rect.Min.y), rect.Max);
     bool hovered = ItemHoverable(clickable, id, 0);
 
-    static std::map<ImGuiID, key_state> anim;
+    static IM_THREAD_LOCAL std::map<ImGuiID, key_state> anim;
     auto it_anim = anim.find(id);
 
     if (it_anim == anim.end())
@@ -3450,6 +3449,7 @@ struct slider_state {
     ImVec4 text;
 };
 bool ImGui::SliderScalar(const char* label, ImGuiDataType data_type, void* p_data, const void* p_min, const void* p_max, const char* format, ImGuiSliderFlags flags) {
+    IMGUI_PROFILE_SCOPE("SliderScalar");
 
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -3492,7 +3492,7 @@ bool ImGui::SliderScalar(const char* label, ImGuiDataType data_type, void* p_dat
     char value_buf[64];
     const char* value_buf_end = value_buf + DataTypeFormatString(value_buf, IM_ARRAYSIZE(value_buf), data_type, p_data, format);
 
-    static std::map<ImGuiID, slider_state> anim;
+    static IM_THREAD_LOCAL std::map<ImGuiID, slider_state> anim;
     auto it_anim = anim.find(id);
 
     if (it_anim == anim.end())
@@ -3501,7 +3501,7 @@ bool ImGui::SliderScalar(const char* label, ImGuiDataType data_type, void* p_dat
         it_anim = anim.find(id);
     }
 
-    static std::unordered_map< ImGuiID, float > values;
+    static IM_THREAD_LOCAL std::unordered_map< ImGuiID, float > values;
     auto value = values.find(id);
 
     if (value == values.end()) {
@@ -4563,6 +4563,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         return false;
 
     IM_ASSERT(buf != NULL && buf_size >= 0);
+    IM_ALLOC_SCOPE(ImGuiAllocCategory_Text);
     IM_ASSERT(!((flags & ImGuiInputTextFlags_CallbackHistory) && (flags & ImGuiInputTextFlags_Multiline)));        // Can't use both together (they both use up/down keys)
     IM_ASSERT(!((flags & ImGuiInputTextFlags_CallbackCompletion) && (flags & ImGuiInputTextFlags_AllowTabInput))); // Can't use both together (they both use tab key)
 
@@ -5216,7 +5217,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     if (clear_active_id && g.ActiveId == id)
         ClearActiveID();
 
-    static std::map<ImGuiID, inputtext_state> anim;
+    static IM_THREAD_LOCAL std::map<ImGuiID, inputtext_state> anim;
     auto it_anim = anim.find(id);
 
     if (it_anim == anim.end())
@@ -5659,7 +5660,7 @@ bool ImGui::ColorEdit4(const char* label, float col[4], ImGuiColorEditFlags flag
     else
         ImFormatString(buf, IM_ARRAYSIZE(buf), "#%02X%02X%02X", ImClamp(i[0], 0, 255), ImClamp(i[1], 0, 255), ImClamp(i[2], 0, 255));
 
-    static std::map<ImGuiID, color_state> anim;
+    static IM_THREAD_LOCAL std::map<ImGuiID, color_state> anim;
     auto it_anim = anim.find(GetID(label));
 
     if (it_anim == anim.end())
@@ -5668,8 +5669,10 @@ bool ImGui::ColorEdit4(const char* label, float col[4], ImGuiColorEditFlags flag
         it_anim = anim.find(GetID(label));
     }
 
-    std::string window_name = "picker";
-    window_name += label;
+    const size_t label_len = strlen(label);
+    char* window_name = (char*)MemAllocFrame(label_len + 7);
+    memcpy(window_name, "picker", 6);
+    memcpy(window_name + 6, label, label_len + 1);
 
     ImGuiWindow* picker_active_window = NULL;
     if (!(flags & ImGuiColorEditFlags_NoSmallPreview))
@@ -5699,7 +5702,7 @@ bool ImGui::ColorEdit4(const char* label, float col[4], ImGuiColorEditFlags flag
         PushStyleColor(ImGuiCol_WindowBg, ImVec4(ImColor(25, 25, 27)));
         if (it_anim->second.alpha >= 0.01f);
         {
-            Begin(window_name.c_str(), NULL, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysUseWindowPadding);
+            Begin(window_name, NULL, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysUseWindowPadding);
             {
                 it_anim->second.hovered = IsWindowHovered();
                 picker_active_window = g.CurrentWindow;
@@ -6085,6 +6088,7 @@ bool ImGui::ColorPicker4(const char* label, float col[4], ImGuiColorEditFlags fl
 // Note that 'col' may be encoded in HSV if ImGuiColorEditFlags_InputHSV is set.
 bool ImGui::ColorButton(const char* desc_id, const ImVec4& col, ImGuiColorEditFlags flags, const ImVec2& size_arg)
 {
+    IMGUI_PROFILE_SCOPE("ColorButton");
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
@@ -6745,6 +6749,7 @@ struct selectable_state {
 };
 bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
 {
+    IMGUI_PROFILE_SCOPE("Selectable");
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
@@ -6867,7 +6872,7 @@ bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags fl
     else if (span_all_columns && g.CurrentTable)
         TablePopBackgroundChannel();
 
-    static std::map<ImGuiID, selectable_state> anim;
+    static IM_THREAD_LOCAL std::map<ImGuiID, selectable_state> anim;
     auto it_anim = anim.find(id);
 
     if (it_anim == anim.end())
@@ -7235,6 +7240,8 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 // - PlotEx() [Internal]
 // - PlotLines()
 // - PlotHistogram()
+// - ImGuiPlotBuffer
+// - PlotBufferEx() [Internal]
 //-------------------------------------------------------------------------
 // Plot/Graph widgets are not very good.
 // Consider writing your own, or using a third-party one, see:
@@ -7394,6 +7401,306 @@ void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data,
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+// Number of entries merged by each level of the pyramid
+static const int PLOT_BUFFER_BLOCK_SIZE = 16;
+
+void ImGuiPlotBuffer::Init(int capacity)
+{
+    IM_ASSERT(capacity > 0);
+    Samples.resize(capacity);
+    LevelOffsets.resize(0);
+    int pyramid_size = 0;
+    for (int level_size = capacity; level_size > 1; )
+    {
+        level_size = (level_size + PLOT_BUFFER_BLOCK_SIZE - 1) / PLOT_BUFFER_BLOCK_SIZE;
+        LevelOffsets.push_back(pyramid_size);
+        pyramid_size += level_size;
+    }
+    LevelOffsets.push_back(pyramid_size);
+    Pyramid.resize(pyramid_size);
+    Clear();
+}
+
+void ImGuiPlotBuffer::Clear()
+{
+    Count = Head = 0;
+    for (ImVec2& min_max : Pyramid)
+        min_max = ImVec2(FLT_MAX, -FLT_MAX);
+}
+
+// Recompute the pyramid entries covering Samples[first, last)
+static void PlotBuffer_UpdatePyramid(ImGuiPlotBuffer* buf, int first, int last)
+{
+    const int B = PLOT_BUFFER_BLOCK_SIZE;
+    const int samples_end = (buf->Count == buf->Samples.Size) ? buf->Samples.Size : buf->Head; // Samples after Head are unused until we wrap around
+    const int levels_count = buf->LevelOffsets.Size - 1;
+    for (int level = 1; level <= levels_count; level++)
+    {
+        first = first / B;
+        last = (last - 1) / B + 1;
+        ImVec2* dst = buf->Pyramid.Data + buf->LevelOffsets[level - 1];
+        if (level == 1)
+        {
+            for (int entry = first; entry < last; entry++)
+            {
+                ImVec2 min_max(FLT_MAX, -FLT_MAX);
+                for (int n = entry * B, n_end = ImMin(n + B, samples_end); n < n_end; n++)
+                {
+                    const float v = buf->Samples.Data[n];
+                    if (v != v) // Ignore NaN values
+                        continue;
+                    min_max.x = ImMin(min_max.x, v);
+                    min_max.y = ImMax(min_max.y, v);
+                }
+                dst[entry] = min_max;
+            }
+        }
+        else
+        {
+            const ImVec2* src = buf->Pyramid.Data + buf->LevelOffsets[level - 2];
+            const int src_count = buf->LevelOffsets[level - 1] - buf->LevelOffsets[level - 2];
+            for (int entry = first; entry < last; entry++)
+            {
+                ImVec2 min_max(FLT_MAX, -FLT_MAX);
+                for (int n = entry * B, n_end = ImMin(n + B, src_count); n < n_end; n++)
+                {
+                    min_max.x = ImMin(min_max.x, src[n].x);
+                    min_max.y = ImMax(min_max.y, src[n].y);
+                }
+                dst[entry] = min_max;
+            }
+        }
+    }
+}
+
+void ImGuiPlotBuffer::Push(float v)
+{
+    IM_ASSERT(Samples.Size > 0 && "Call Init() first!");
+
+    // Fast path: if the overwritten sample (if any) was strictly between the min and max of its block, it can't be the min/max of any
+    // entry above either, so merging the new value into them is enough.
+    const float v_old = Samples.Data[Head];
+    const bool overwrite = (Count == Samples.Size);
+    const int B = PLOT_BUFFER_BLOCK_SIZE;
+    if (LevelOffsets.Size > 1)
+    {
+        const ImVec2 block_min_max = Pyramid.Data[LevelOffsets[0] + Head / B];
+        if (!overwrite || v_old != v_old || (v_old > block_min_max.x && v_old < block_min_max.y))
+        {
+            Samples.Data[Head] = v;
+            if (v == v) // Ignore NaN values
+                for (int level = 1, entry = Head / B; level < LevelOffsets.Size; level++, entry /= B)
+                {
+                    ImVec2& min_max = Pyramid.Data[LevelOffsets[level - 1] + entry];
+                    min_max.x = ImMin(min_max.x, v);
+                    min_max.y = ImMax(min_max.y, v);
+                }
+            Head = (Head + 1) % Samples.Size;
+            Count = ImMin(Count + 1, Samples.Size);
+            return;
+        }
+    }
+    Push(&v, 1);
+}
+
+void ImGuiPlotBuffer::Push(const float* values, int values_count)
+{
+    IM_ASSERT(Samples.Size > 0 && "Call Init() first!");
+    const int capacity = Samples.Size;
+    if (values_count > capacity)
+    {
+        values += values_count - capacity;
+        values_count = capacity;
+    }
+    while (values_count > 0)
+    {
+        // Write up to the end of the ring, then wrap around
+        const int first = Head;
+        const int count = ImMin(values_count, capacity - Head);
+        memcpy(Samples.Data + first, values, (size_t)count * sizeof(float));
+        values += count;
+        values_count -= count;
+        Head = (Head + count) % capacity;
+        Count = ImMin(Count + count, capacity);
+        PlotBuffer_UpdatePyramid(this, first, first + count);
+    }
+}
+
+float ImGuiPlotBuffer::GetValue(int idx) const
+{
+    IM_ASSERT(idx >= 0 && idx < Count);
+    const int oldest = (Count == Samples.Size) ? Head : 0;
+    return Samples.Data[(oldest + idx) % Samples.Size];
+}
+
+// Min/max of Samples[first, last): use whole blocks of the highest possible level, and individual entries of lower levels on the edges.
+static ImVec2 PlotBuffer_GetMinMaxNoWrap(const ImGuiPlotBuffer* buf, int first, int last)
+{
+    const int B = PLOT_BUFFER_BLOCK_SIZE;
+    const int levels_count = buf->LevelOffsets.Size - 1;
+    ImVec2 min_max(FLT_MAX, -FLT_MAX);
+    for (int level = 0; first < last; level++)
+    {
+        int first_aligned = (first + B - 1) / B * B;
+        int last_aligned = last / B * B;
+        if (level == levels_count || first_aligned >= last_aligned)
+            first_aligned = last_aligned = last; // Scan all remaining entries at this level
+        for (int pass = 0; pass < 2; pass++)
+        {
+            const int n_begin = (pass == 0) ? first : last_aligned;
+            const int n_end = (pass == 0) ? first_aligned : last;
+            if (level == 0)
+            {
+                for (int n = n_begin; n < n_end; n++)
+                {
+                    const float v = buf->Samples.Data[n];
+                    if (v != v) // Ignore NaN values
+                        continue;
+                    min_max.x = ImMin(min_max.x, v);
+                    min_max.y = ImMax(min_max.y, v);
+                }
+            }
+            else
+            {
+                const ImVec2* entries = buf->Pyramid.Data + buf->LevelOffsets[level - 1];
+                for (int n = n_begin; n < n_end; n++)
+                {
+                    min_max.x = ImMin(min_max.x, entries[n].x);
+                    min_max.y = ImMax(min_max.y, entries[n].y);
+                }
+            }
+        }
+        first = first_aligned / B;
+        last = last_aligned / B;
+    }
+    return min_max;
+}
+
+ImVec2 ImGuiPlotBuffer::GetMinMax(int idx_begin, int idx_end) const
+{
+    IM_ASSERT(idx_begin >= 0 && idx_begin <= idx_end && idx_end <= Count);
+    const int capacity = Samples.Size;
+    const int oldest = (Count == capacity) ? Head : 0;
+    const int first = (oldest + idx_begin) % ImMax(capacity, 1);
+    const int last = first + (idx_end - idx_begin);
+    if (last <= capacity)
+        return PlotBuffer_GetMinMaxNoWrap(this, first, last);
+    const ImVec2 a = PlotBuffer_GetMinMaxNoWrap(this, first, capacity);
+    const ImVec2 b = PlotBuffer_GetMinMaxNoWrap(this, 0, last - capacity);
+    return ImVec2(ImMin(a.x, b.x), ImMax(a.y, b.y));
+}
+
+static float PlotBuffer_Getter(void* data, int idx)
+{
+    return ((const ImGuiPlotBuffer*)data)->GetValue(idx);
+}
+
+// Draw one vertical span per pixel column, covering the min/max of the samples falling in this column.
+// For lines we also include the last sample of the previous column, to cover the segment joining both columns.
+int ImGui::PlotBufferEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return -1;
+
+    const ImGuiStyle& style = g.Style;
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 frame_size = CalcItemSize(size_arg, CalcItemWidth(), label_size.y + style.FramePadding.y * 2.0f);
+
+    // Not more samples than pixels: plot them all
+    const int values_count = buffer->GetCount();
+    const int columns_count = (int)(frame_size.x - style.FramePadding.x * 2.0f);
+    if (values_count <= columns_count)
+        return PlotEx(plot_type, label, &PlotBuffer_Getter, (void*)buffer, values_count, 0, overlay_text, scale_min, scale_max, size_arg);
+
+    const ImGuiID id = window->GetID(label);
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+    const ImRect inner_bb(frame_bb.Min + style.FramePadding, frame_bb.Max - style.FramePadding);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Max + ImVec2(label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f, 0));
+    ItemSize(total_bb, style.FramePadding.y);
+    if (!ItemAdd(total_bb, 0, &frame_bb))
+        return -1;
+    const bool hovered = ItemHoverable(frame_bb, id, g.LastItemData.InFlags);
+
+    // Determine scale from values if not specified
+    if (scale_min == FLT_MAX || scale_max == FLT_MAX)
+    {
+        const ImVec2 min_max = buffer->GetMinMax(0, values_count);
+        if (scale_min == FLT_MAX)
+            scale_min = min_max.x;
+        if (scale_max == FLT_MAX)
+            scale_max = min_max.y;
+    }
+
+    RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
+
+    int idx_hovered = -1;
+    int column_hovered = -1;
+    if (hovered && inner_bb.Contains(g.IO.MousePos))
+        column_hovered = ImClamp((int)(g.IO.MousePos.x - inner_bb.Min.x), 0, columns_count - 1);
+
+    const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+    const float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (1 + scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);   // Where does the zero line stands
+    const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
+    const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
+    const float x_start = IM_FLOOR(inner_bb.Min.x);
+
+    for (int column_n = 0; column_n < columns_count; column_n++)
+    {
+        const int idx_begin = (int)((ImS64)column_n * values_count / columns_count);
+        const int idx_end = (int)((ImS64)(column_n + 1) * values_count / columns_count);
+        ImVec2 min_max = buffer->GetMinMax(idx_begin, idx_end);
+        if (plot_type == ImGuiPlotType_Lines && idx_begin > 0)
+        {
+            const float v_prev = buffer->GetValue(idx_begin - 1);
+            if (v_prev == v_prev && min_max.x <= min_max.y) // Not NaN, and this column has values to join to
+            {
+                min_max.x = ImMin(min_max.x, v_prev);
+                min_max.y = ImMax(min_max.y, v_prev);
+            }
+        }
+        if (column_n == column_hovered)
+        {
+            if (min_max.x <= min_max.y)
+                SetTooltip("%d..%d: min %8.4g, max %8.4g", idx_begin, idx_end - 1, min_max.x, min_max.y);
+            idx_hovered = idx_begin;
+        }
+        if (min_max.x > min_max.y)
+            continue;
+
+        float t_top = 1.0f - ImSaturate((min_max.y - scale_min) * inv_scale);
+        float t_bottom = 1.0f - ImSaturate((min_max.x - scale_min) * inv_scale);
+        if (plot_type == ImGuiPlotType_Histogram)
+        {
+            t_top = ImMin(t_top, histogram_zero_line_t);
+            t_bottom = ImMax(t_bottom, histogram_zero_line_t);
+        }
+        const float y_top = ImLerp(inner_bb.Min.y, inner_bb.Max.y, t_top);
+        const float y_bottom = ImMax(ImLerp(inner_bb.Min.y, inner_bb.Max.y, t_bottom), y_top + 1.0f);
+        window->DrawList->AddRectFilled(ImVec2(x_start + column_n, y_top), ImVec2(x_start + column_n + 1.0f, y_bottom), column_n == column_hovered ? col_hovered : col_base);
+    }
+
+    // Text overlay
+    if (overlay_text)
+        RenderTextClipped(ImVec2(frame_bb.Min.x, frame_bb.Min.y + style.FramePadding.y), frame_bb.Max, overlay_text, NULL, NULL, ImVec2(0.5f, 0.0f));
+
+    if (label_size.x > 0.0f)
+        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, inner_bb.Min.y), label);
+
+    return idx_hovered;
+}
+
+void ImGui::PlotLines(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotBufferEx(ImGuiPlotType_Lines, label, buffer, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::PlotHistogram(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotBufferEx(ImGuiPlotType_Histogram, label, buffer, overlay_text, scale_min, scale_max, graph_size);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.
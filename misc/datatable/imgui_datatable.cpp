@@ -0,0 +1,368 @@
+// dear imgui: data table for large row counts over columnar storage
+
+// Changelog:
+// - v0.10: Initial version.
+
+// See imgui_datatable.h for usage.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_internal.h"     // ImBitVector, DataTypeGetInfo(), DataTypeFormatString()
+#include "imgui_datatable.h"
+#include <algorithm>            // std::sort, std::inplace_merge, std::reverse
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Clang warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wold-style-cast"     // warning: use of old-style cast
+#pragma clang diagnostic ignored "-Wsign-conversion"    // warning: implicit conversion changes signedness
+#endif
+
+//-------------------------------------------------------------------------
+// [SECTION] Sorting
+//-------------------------------------------------------------------------
+
+template<typename T>
+static inline int ImGuiDataTable_CompareScalar(const ImGuiDataTableColumn* column, int row_a, int row_b)
+{
+    const T a = *(const T*)(const void*)((const char*)column->Data + (size_t)row_a * column->Stride);
+    const T b = *(const T*)(const void*)((const char*)column->Data + (size_t)row_b * column->Stride);
+    return (a < b) ? -1 : (b < a) ? +1 : 0;
+}
+
+static int ImGuiDataTable_CompareRows(const ImGuiDataTableColumn* column, int row_a, int row_b)
+{
+    switch (column->Kind)
+    {
+    case ImGuiDataTableColumnKind_Scalar:
+        switch (column->DataType)
+        {
+        case ImGuiDataType_S8:      return ImGuiDataTable_CompareScalar<ImS8>(column, row_a, row_b);
+        case ImGuiDataType_U8:      return ImGuiDataTable_CompareScalar<ImU8>(column, row_a, row_b);
+        case ImGuiDataType_S16:     return ImGuiDataTable_CompareScalar<ImS16>(column, row_a, row_b);
+        case ImGuiDataType_U16:     return ImGuiDataTable_CompareScalar<ImU16>(column, row_a, row_b);
+        case ImGuiDataType_S32:     return ImGuiDataTable_CompareScalar<ImS32>(column, row_a, row_b);
+        case ImGuiDataType_U32:     return ImGuiDataTable_CompareScalar<ImU32>(column, row_a, row_b);
+        case ImGuiDataType_S64:     return ImGuiDataTable_CompareScalar<ImS64>(column, row_a, row_b);
+        case ImGuiDataType_U64:     return ImGuiDataTable_CompareScalar<ImU64>(column, row_a, row_b);
+        case ImGuiDataType_Float:   return ImGuiDataTable_CompareScalar<float>(column, row_a, row_b);
+        case ImGuiDataType_Double:  return ImGuiDataTable_CompareScalar<double>(column, row_a, row_b);
+        default: break;
+        }
+        IM_ASSERT(0);
+        return 0;
+    case ImGuiDataTableColumnKind_String:
+    {
+        const char* a = *(const char* const*)(const void*)((const char*)column->Data + (size_t)row_a * column->Stride);
+        const char* b = *(const char* const*)(const void*)((const char*)column->Data + (size_t)row_b * column->Stride);
+        return strcmp(a ? a : "", b ? b : "");
+    }
+    case ImGuiDataTableColumnKind_Custom:
+        return column->CompareFunc ? column->CompareFunc(column->UserData, row_a, row_b) : 0;
+    }
+    return 0;
+}
+
+// Strict weak ordering over row indices for the current sort specs.
+// Ties are broken on row index, in the direction of the first sort spec. This gives a total order, so that
+// full and incremental sorts give the same result, and flipping the direction of every spec exactly reverses it.
+struct ImGuiDataTableRowLess
+{
+    const ImGuiDataTableColumn*     Columns;
+    const ImGuiDataTableSortSpec*   Specs;
+    int                             SpecsCount;
+
+    bool operator()(int row_a, int row_b) const
+    {
+        for (int n = 0; n < SpecsCount; n++)
+        {
+            int delta = ImGuiDataTable_CompareRows(&Columns[Specs[n].Column], row_a, row_b);
+            if (delta != 0)
+                return Specs[n].Descending ? (delta > 0) : (delta < 0);
+        }
+        return Specs[0].Descending ? (row_a > row_b) : (row_a < row_b);
+    }
+};
+
+// Sort 'count' rows, splitting the work across 'thread_count' threads: each thread sorts a chunk, then chunks are merged pairwise.
+static void ImGuiDataTable_ParallelSort(int* rows, int count, const ImGuiDataTableRowLess& less, int thread_count)
+{
+    if (thread_count <= 1)
+    {
+        std::sort(rows, rows + count, less);
+        return;
+    }
+    std::vector<int> bounds;
+    for (int n = 0; n <= thread_count; n++)
+        bounds.push_back((int)((ImS64)count * n / thread_count));
+
+    std::vector<std::thread> threads;
+    for (int n = 0; n < thread_count; n++)
+        threads.emplace_back([=, &less]() { std::sort(rows + bounds[n], rows + bounds[n + 1], less); });
+    for (std::thread& thread : threads)
+        thread.join();
+
+    // Merge adjacent runs, doubling their size at each step
+    for (int width = 1; width < thread_count; width *= 2)
+    {
+        threads.clear();
+        for (int n = 0; n + width < thread_count; n += width * 2)
+        {
+            int* first = rows + bounds[n];
+            int* middle = rows + bounds[n + width];
+            int* last = rows + bounds[ImMin(n + width * 2, thread_count)];
+            threads.emplace_back([=, &less]() { std::inplace_merge(first, middle, last, less); });
+        }
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] ImGuiDataTable
+//-------------------------------------------------------------------------
+
+ImGuiDataTable::ImGuiDataTable()
+{
+    RowCount = 0;
+    SortThreads = 0;
+    SortParallelThreshold = 65536;
+    OrderRowCount = 0;
+    WantFullSort = false;
+    LastSortRows = 0;
+    LastSortWasFull = false;
+    LastSortTime = 0.0;
+}
+
+int ImGuiDataTable::AddColumn(const char* name, ImGuiDataType data_type, const void* data, int stride, const char* format, ImGuiTableColumnFlags flags, float init_width_or_weight)
+{
+    IM_ASSERT(data_type >= 0 && data_type < ImGuiDataType_COUNT);
+    ImGuiDataTableColumn column;
+    column.Name = name;
+    column.Flags = flags;
+    column.InitWidthOrWeight = init_width_or_weight;
+    column.Kind = ImGuiDataTableColumnKind_Scalar;
+    column.DataType = data_type;
+    column.Data = data;
+    column.Stride = stride ? stride : (int)ImGui::DataTypeGetInfo(data_type)->Size;
+    column.Format = format;
+    Columns.push_back(column);
+    return Columns.Size - 1;
+}
+
+int ImGuiDataTable::AddColumnStrings(const char* name, const char* const* data, int stride, ImGuiTableColumnFlags flags, float init_width_or_weight)
+{
+    ImGuiDataTableColumn column;
+    column.Name = name;
+    column.Flags = flags;
+    column.InitWidthOrWeight = init_width_or_weight;
+    column.Kind = ImGuiDataTableColumnKind_String;
+    column.Data = data;
+    column.Stride = stride ? stride : (int)sizeof(const char*);
+    Columns.push_back(column);
+    return Columns.Size - 1;
+}
+
+int ImGuiDataTable::AddColumnCustom(const char* name, int (*compare_func)(void* user_data, int row_a, int row_b), void (*render_func)(void* user_data, int row), void* user_data, ImGuiTableColumnFlags flags, float init_width_or_weight)
+{
+    IM_ASSERT(render_func != NULL);
+    ImGuiDataTableColumn column;
+    column.Name = name;
+    column.Flags = flags | (compare_func ? 0 : ImGuiTableColumnFlags_NoSort);
+    column.InitWidthOrWeight = init_width_or_weight;
+    column.Kind = ImGuiDataTableColumnKind_Custom;
+    column.CompareFunc = compare_func;
+    column.RenderFunc = render_func;
+    column.UserData = user_data;
+    Columns.push_back(column);
+    return Columns.Size - 1;
+}
+
+void ImGuiDataTable::SetColumnData(int column, const void* data)
+{
+    Columns[column].Data = data;
+}
+
+void ImGuiDataTable::SetRowCount(int row_count)
+{
+    IM_ASSERT(row_count >= 0);
+    if (row_count < RowCount)
+        WantFullSort = true;
+    RowCount = row_count;
+}
+
+void ImGuiDataTable::MarkRowChanged(int row)
+{
+    IM_ASSERT(row >= 0 && row < RowCount);
+    if (!WantFullSort && row < OrderRowCount && SortSpecs.Size > 0)
+        ChangedRows.push_back(row);
+}
+
+void ImGuiDataTable::MarkAllChanged()
+{
+    WantFullSort = true;
+}
+
+void ImGuiDataTable::Clear()
+{
+    Columns.clear();
+    RowCount = OrderRowCount = 0;
+    Order.clear();
+    SortSpecs.clear();
+    ChangedRows.clear();
+    WantFullSort = false;
+}
+
+void ImGuiDataTable::UpdateOrder()
+{
+    const int appended_count = RowCount - OrderRowCount;
+    if (!WantFullSort && appended_count == 0 && ChangedRows.Size == 0)
+        return;
+
+    const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    ImGuiDataTableRowLess less = { Columns.Data, SortSpecs.Data, SortSpecs.Size };
+
+    // Rebuild everything if too much changed: merging would cost more than sorting again
+    const bool sorted = (SortSpecs.Size > 0);
+    if (sorted && !WantFullSort && (appended_count < 0 || ChangedRows.Size + appended_count > RowCount / 4))
+        WantFullSort = true;
+
+    if (!sorted || WantFullSort)
+    {
+        // Identity order, then full sort
+        if (WantFullSort || appended_count < 0)
+            Order.resize(0);
+        const int first_new_row = Order.Size;
+        Order.resize(RowCount);
+        for (int row = first_new_row; row < RowCount; row++)
+            Order[row] = row;
+        if (sorted)
+        {
+            int thread_count = SortThreads > 0 ? SortThreads : (int)std::thread::hardware_concurrency();
+            if (RowCount < SortParallelThreshold || thread_count < 1)
+                thread_count = 1;
+            ImGuiDataTable_ParallelSort(Order.Data, Order.Size, less, ImMin(thread_count, 64));
+        }
+        LastSortRows = sorted ? RowCount : 0;
+        LastSortWasFull = sorted;
+    }
+    else
+    {
+        // Incremental: remove changed rows from the order, sort them along with appended rows, merge back.
+        std::sort(ChangedRows.begin(), ChangedRows.end());
+        ChangedRows.Size = (int)(std::unique(ChangedRows.begin(), ChangedRows.end()) - ChangedRows.begin());
+        int kept_count = Order.Size;
+        if (ChangedRows.Size > 0)
+        {
+            ImBitVector changed;
+            changed.Create(OrderRowCount);
+            for (int row : ChangedRows)
+                changed.SetBit(row);
+            kept_count = 0;
+            for (int n = 0; n < Order.Size; n++)
+                if (!changed.TestBit(Order[n]))
+                    Order[kept_count++] = Order[n];
+        }
+        Order.resize(RowCount);
+        int* pending = Order.Data + kept_count;
+        memcpy(pending, ChangedRows.Data, (size_t)ChangedRows.Size * sizeof(int));
+        for (int n = 0; n < appended_count; n++)
+            pending[ChangedRows.Size + n] = OrderRowCount + n;
+        std::sort(pending, Order.Data + Order.Size, less);
+        std::inplace_merge(Order.Data, pending, Order.Data + Order.Size, less);
+        LastSortRows = ChangedRows.Size + appended_count;
+        LastSortWasFull = false;
+    }
+
+    OrderRowCount = RowCount;
+    ChangedRows.resize(0);
+    WantFullSort = false;
+    LastSortTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+bool ImGuiDataTable::Draw(const char* str_id, ImGuiTableFlags flags, const ImVec2& outer_size)
+{
+    if (flags == 0)
+        flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable;
+    if (Columns.Size == 0 || !ImGui::BeginTable(str_id, Columns.Size, flags, outer_size))
+        return false;
+
+    ImGui::TableSetupScrollFreeze(0, 1);
+    for (int column_n = 0; column_n < Columns.Size; column_n++)
+        ImGui::TableSetupColumn(Columns[column_n].Name, Columns[column_n].Flags, Columns[column_n].InitWidthOrWeight);
+    ImGui::TableHeadersRow();
+
+    // Sort specs changed: when every direction was flipped we can simply reverse the order, otherwise sort again.
+    ImGuiTableSortSpecs* table_sort_specs = ImGui::TableGetSortSpecs();
+    const int table_sort_specs_count = table_sort_specs ? table_sort_specs->SpecsCount : 0;
+    if ((table_sort_specs && table_sort_specs->SpecsDirty) || (table_sort_specs == NULL && SortSpecs.Size > 0))
+    {
+        bool all_flipped = (table_sort_specs_count == SortSpecs.Size && SortSpecs.Size > 0 && !WantFullSort);
+        for (int n = 0; n < table_sort_specs_count && all_flipped; n++)
+            all_flipped = (table_sort_specs->Specs[n].ColumnIndex == SortSpecs[n].Column) && ((table_sort_specs->Specs[n].SortDirection == ImGuiSortDirection_Descending) != SortSpecs[n].Descending);
+        SortSpecs.resize(table_sort_specs_count);
+        for (int n = 0; n < table_sort_specs_count; n++)
+        {
+            SortSpecs[n].Column = table_sort_specs->Specs[n].ColumnIndex;
+            SortSpecs[n].Descending = (table_sort_specs->Specs[n].SortDirection == ImGuiSortDirection_Descending);
+        }
+        if (all_flipped)
+        {
+            // Changed rows still need to be merged according to the new direction, so only reverse the part that was sorted
+            std::reverse(Order.Data, Order.Data + Order.Size);
+        }
+        else
+        {
+            WantFullSort = true;
+        }
+        if (table_sort_specs)
+            table_sort_specs->SpecsDirty = false;
+    }
+    UpdateOrder();
+
+    // Submit visible rows
+    char buf[64];
+    ImGuiListClipper clipper;
+    clipper.Begin(Order.Size);
+    while (clipper.Step())
+        for (int display_n = clipper.DisplayStart; display_n < clipper.DisplayEnd; display_n++)
+        {
+            const int row = Order[display_n];
+            ImGui::TableNextRow();
+            for (int column_n = 0; column_n < Columns.Size; column_n++)
+            {
+                if (!ImGui::TableNextColumn())
+                    continue;
+                const ImGuiDataTableColumn* column = &Columns[column_n];
+                if (column->RenderFunc)
+                {
+                    ImGui::PushID(row);
+                    column->RenderFunc(column->UserData, row);
+                    ImGui::PopID();
+                }
+                else if (column->Kind == ImGuiDataTableColumnKind_Scalar)
+                {
+                    const void* p_data = (const char*)column->Data + (size_t)row * column->Stride;
+                    int len = ImGui::DataTypeFormatString(buf, IM_ARRAYSIZE(buf), column->DataType, p_data, column->Format ? column->Format : ImGui::DataTypeGetInfo(column->DataType)->PrintFmt);
+                    ImGui::TextUnformatted(buf, buf + len);
+                }
+                else if (column->Kind == ImGuiDataTableColumnKind_String)
+                {
+                    const char* str = *(const char* const*)(const void*)((const char*)column->Data + (size_t)row * column->Stride);
+                    ImGui::TextUnformatted(str ? str : "");
+                }
+            }
+        }
+
+    ImGui::EndTable();
+    return true;
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+#endif // #ifndef IMGUI_DISABLE
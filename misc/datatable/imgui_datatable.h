@@ -0,0 +1,102 @@
+// dear imgui: data table for large row counts over columnar storage
+// (headers)
+
+// Changelog:
+// - v0.10: Initial version.
+
+// ImGuiDataTable is a layer on top of BeginTable()/EndTable() for displaying very large datasets (millions of rows):
+// - Your data stays where it is: each column is an accessor over your own storage (typically one array per column).
+// - The table keeps a permutation of row indices sorted according to the user's sort specs (including multi-sort).
+//   Full sorts are split across threads. Rows which were appended or modified are sorted separately and merged
+//   into the existing order, so updating a few rows of a large dataset doesn't re-sort everything.
+// - Only the visible rows are submitted, using ImGuiListClipper.
+//
+// Usage:
+//   static ImGuiDataTable table;
+//   if (table.Columns.Size == 0)
+//   {
+//       table.AddColumn("ID", ImGuiDataType_S32, ids.Data);
+//       table.AddColumn("Value", ImGuiDataType_Float, values.Data, 0, "%.3f");
+//       table.AddColumnStrings("Name", names.Data);
+//   }
+//   table.SetRowCount(ids.Size);                   // Appended rows are merged into current order.
+//   table.MarkRowChanged(n);                       // After modifying the values of row 'n'.
+//   table.Draw("##data");
+// If your storage may reallocate (e.g. growing an ImVector), update the column pointers with SetColumnData().
+
+#pragma once
+#include "imgui.h"      // IMGUI_API
+#ifndef IMGUI_DISABLE
+
+enum ImGuiDataTableColumnKind
+{
+    ImGuiDataTableColumnKind_Scalar,    // Array of ImGuiDataType values
+    ImGuiDataTableColumnKind_String,    // Array of 'const char*'
+    ImGuiDataTableColumnKind_Custom,    // User provided CompareFunc/RenderFunc
+};
+
+// Accessor over one column of your data.
+// For Scalar/String columns, the value of row 'n' is stored at ((const char*)Data + n * Stride).
+struct ImGuiDataTableColumn
+{
+    const char*             Name;
+    ImGuiTableColumnFlags   Flags;
+    float                   InitWidthOrWeight;
+    ImGuiDataTableColumnKind Kind;
+    ImGuiDataType           DataType;       // For Scalar columns
+    const void*             Data;
+    int                     Stride;         // In bytes
+    const char*             Format;         // printf format for Scalar columns, NULL for default
+    int                   (*CompareFunc)(void* user_data, int row_a, int row_b);   // Custom: return <0, 0 or >0. Called from multiple threads!
+    void                  (*RenderFunc)(void* user_data, int row);                // Optional: submit contents of the cell (any kind). Default to Text() of the value.
+    void*                   UserData;
+
+    ImGuiDataTableColumn()  { memset(this, 0, sizeof(*this)); }
+};
+
+struct ImGuiDataTableSortSpec
+{
+    int                     Column;
+    bool                    Descending;
+};
+
+struct ImGuiDataTable
+{
+    ImVector<ImGuiDataTableColumn>  Columns;
+    int                     RowCount;       // Set with SetRowCount()
+    int                     SortThreads;    // = 0      // Number of threads used by a full sort. 0: use std::thread::hardware_concurrency().
+    int                     SortParallelThreshold; // = 65536 // Don't bother splitting sorts of less rows than this.
+
+    // Sorted state
+    ImVector<int>           Order;          // Display order: Order[display_index] == row index. Covers rows [0, OrderRowCount).
+    int                     OrderRowCount;
+    ImVector<ImGuiDataTableSortSpec> SortSpecs;
+    bool                    WantFullSort;
+    ImVector<int>           ChangedRows;    // Rows marked with MarkRowChanged() since the last update
+
+    // Statistics of the last update
+    int                     LastSortRows;   // Number of rows which had to be sorted (all rows for a full sort, changed+appended ones otherwise)
+    bool                    LastSortWasFull;
+    double                  LastSortTime;   // In seconds
+
+    IMGUI_API ImGuiDataTable();
+
+    // Setup
+    IMGUI_API int           AddColumn(const char* name, ImGuiDataType data_type, const void* data, int stride = 0, const char* format = NULL, ImGuiTableColumnFlags flags = 0, float init_width_or_weight = 0.0f);
+    IMGUI_API int           AddColumnStrings(const char* name, const char* const* data, int stride = 0, ImGuiTableColumnFlags flags = 0, float init_width_or_weight = 0.0f);
+    IMGUI_API int           AddColumnCustom(const char* name, int (*compare_func)(void* user_data, int row_a, int row_b), void (*render_func)(void* user_data, int row), void* user_data, ImGuiTableColumnFlags flags = 0, float init_width_or_weight = 0.0f);
+    IMGUI_API void          SetColumnData(int column, const void* data);
+
+    // Data changes
+    IMGUI_API void          SetRowCount(int row_count);     // Growing: new rows are merged into current order. Shrinking: full re-sort.
+    IMGUI_API void          MarkRowChanged(int row);        // Values of 'row' changed: it will be removed from the order and merged back at its new place.
+    IMGUI_API void          MarkAllChanged();               // Request a full re-sort.
+    IMGUI_API void          Clear();                        // Remove columns and rows.
+
+    // Display
+    IMGUI_API bool          Draw(const char* str_id, ImGuiTableFlags flags = 0, const ImVec2& outer_size = ImVec2(0.0f, 0.0f)); // Return true if the table is visible. flags = 0 uses sensible defaults for a scrolling, sortable table.
+    IMGUI_API void          UpdateOrder();                  // Called by Draw(). Bring Order up to date with RowCount/changed rows/SortSpecs.
+    int                     GetRowAt(int display_index) const { return Order[display_index]; }
+};
+
+#endif // #ifndef IMGUI_DISABLE
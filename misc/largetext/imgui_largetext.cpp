@@ -0,0 +1,878 @@
+// dear imgui: multi-line text editor for large documents
+
+// Changelog:
+// - v0.10: Initial version.
+
+// See imgui_largetext.h for usage.
+
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_internal.h"     // ImTextCharFromUtf8(), SetActiveID(), SetKeyOwner(), Shortcut(), ScrollToRectEx()
+#include "imgui_largetext.h"
+
+// Clang warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wold-style-cast"     // warning: use of old-style cast
+#pragma clang diagnostic ignored "-Wsign-conversion"    // warning: implicit conversion changes signedness
+#endif
+
+//-------------------------------------------------------------------------
+// [SECTION] Helpers
+//-------------------------------------------------------------------------
+
+static int ImGuiLargeText_CountLineBreaks(const char* p, const char* p_end)
+{
+    int count = 0;
+    while (p < p_end && (p = (const char*)memchr(p, '\n', (size_t)(p_end - p))) != NULL)
+    {
+        count++;
+        p++;
+    }
+    return count;
+}
+
+static void ImGuiLargeText_AppendToVector(ImVector<char>* out, const char* p, const char* p_end)
+{
+    const int size = out->Size;
+    out->resize(size + (int)(p_end - p));
+    if (p_end > p)
+        memcpy(out->Data + size, p, (size_t)(p_end - p));
+}
+
+static inline bool ImGuiLargeText_IsUtf8Continuation(char c) { return (c & 0xC0) == 0x80; }
+static inline bool ImGuiLargeText_IsWordChar(char c)         { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || (unsigned char)c >= 0x80; }
+
+// Horizontal position of byte 'offset' within a line of text
+static float ImGuiLargeText_CalcOffsetX(ImFont* font, float font_size, const char* line, int offset)
+{
+    return offset > 0 ? font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, line, line + offset).x : 0.0f;
+}
+
+// Byte offset of the character boundary closest to horizontal position 'x' within a line of text
+static int ImGuiLargeText_CalcOffsetFromX(ImFont* font, float font_size, const char* line, int line_len, float x)
+{
+    const float scale = font_size / font->FontSize;
+    const char* s = line;
+    const char* s_end = line + line_len;
+    float line_x = 0.0f;
+    while (s < s_end)
+    {
+        unsigned int c;
+        const int c_len = ImTextCharFromUtf8(&c, s, s_end);
+        const float advance = (c == '\r') ? 0.0f : font->GetCharAdvance((ImWchar)c) * scale; // Consistent with CalcTextSizeA()
+        if (x < line_x + advance * 0.5f)
+            break;
+        line_x += advance;
+        s += c_len;
+    }
+    return (int)(s - line);
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] Storage
+//-------------------------------------------------------------------------
+
+ImGuiLargeText::ImGuiLargeText()
+{
+    ChunkSizeMax = 8192;
+    TextSize = LineBreaks = 0;
+    ReadOnly = false;
+    AllowTabInput = true;
+    Cursor = SelectionAnchor = 0;
+    CursorPreferredX = -1.0f;
+    Edited = false;
+    MaxLineWidth = 0.0f;
+    UndoRecordsCurrent = 0;
+    IndexValidCount = 0;
+    CursorAnimTime = 0.0f;
+    ScrollToCursor = IsSelectingWithMouse = false;
+}
+
+ImGuiLargeText::~ImGuiLargeText()
+{
+    Clear();
+}
+
+void ImGuiLargeText::Clear()
+{
+    for (ImGuiLargeTextChunk& chunk : Chunks)
+        IM_FREE(chunk.Data);
+    Chunks.clear();
+    ChunkStarts.clear();
+    ChunkLines.clear();
+    IndexValidCount = 0;
+    TextSize = LineBreaks = 0;
+    Cursor = SelectionAnchor = 0;
+    CursorPreferredX = -1.0f;
+    MaxLineWidth = 0.0f;
+    ClearUndo();
+}
+
+void ImGuiLargeText::ClearUndo()
+{
+    UndoRecords.clear();
+    UndoText.clear();
+    UndoRecordsCurrent = 0;
+}
+
+void ImGuiLargeText::InvalidateIndex(int chunk_n)
+{
+    IndexValidCount = ImMin(IndexValidCount, chunk_n);
+}
+
+// Only the entries following the first modified chunk are recomputed.
+void ImGuiLargeText::UpdateIndex()
+{
+    if (IndexValidCount == Chunks.Size)
+        return;
+    ChunkStarts.resize(Chunks.Size);
+    ChunkLines.resize(Chunks.Size);
+    for (int n = IndexValidCount; n < Chunks.Size; n++)
+    {
+        ChunkStarts[n] = (n > 0) ? ChunkStarts[n - 1] + Chunks[n - 1].Size : 0;
+        ChunkLines[n] = (n > 0) ? ChunkLines[n - 1] + Chunks[n - 1].LineBreaks : 0;
+    }
+    IndexValidCount = Chunks.Size;
+}
+
+int ImGuiLargeText::FindChunk(int pos)
+{
+    IM_ASSERT(pos >= 0 && pos <= TextSize);
+    UpdateIndex();
+    if (Chunks.Size == 0)
+        return -1;
+    int lo = 0, hi = Chunks.Size - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) / 2;
+        if (ChunkStarts[mid] <= pos)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+// Split a chunk which grew past ChunkSizeMax into chunks of ChunkSizeMax/2
+void ImGuiLargeText::SplitChunk(int chunk_n)
+{
+    const int piece_size = ImMax(ChunkSizeMax / 2, 1);
+    const int size = Chunks[chunk_n].Size;
+    const int new_count = (size - 1) / piece_size;
+    if (new_count <= 0)
+        return;
+    Chunks.resize(Chunks.Size + new_count);
+    memmove(Chunks.Data + chunk_n + 1 + new_count, Chunks.Data + chunk_n + 1, (size_t)(Chunks.Size - chunk_n - 1 - new_count) * sizeof(ImGuiLargeTextChunk));
+
+    ImGuiLargeTextChunk* src = &Chunks[chunk_n];
+    for (int n = 1; n <= new_count; n++)
+    {
+        ImGuiLargeTextChunk* dst = &Chunks[chunk_n + n];
+        const int offset = n * piece_size;
+        dst->Size = dst->Capacity = ImMin(piece_size, size - offset);
+        dst->Data = (char*)IM_ALLOC((size_t)dst->Capacity);
+        memcpy(dst->Data, src->Data + offset, (size_t)dst->Size);
+        dst->LineBreaks = ImGuiLargeText_CountLineBreaks(dst->Data, dst->Data + dst->Size);
+    }
+
+    // Don't keep a large buffer around for the first piece (e.g. after inserting a whole file)
+    if (src->Capacity > ChunkSizeMax)
+    {
+        char* data = (char*)IM_ALLOC((size_t)ChunkSizeMax);
+        memcpy(data, src->Data, (size_t)piece_size);
+        IM_FREE(src->Data);
+        src->Data = data;
+        src->Capacity = ChunkSizeMax;
+    }
+    src->Size = piece_size;
+    src->LineBreaks = ImGuiLargeText_CountLineBreaks(src->Data, src->Data + src->Size);
+    InvalidateIndex(chunk_n + 1);
+}
+
+void ImGuiLargeText::RemoveChunk(int chunk_n)
+{
+    IM_FREE(Chunks[chunk_n].Data);
+    Chunks.erase(Chunks.Data + chunk_n);
+    InvalidateIndex(chunk_n);
+}
+
+// Merge chunk_n+1 into chunk_n when they are both small, so that many edits don't leave many tiny chunks behind.
+static void ImGuiLargeText_TryMergeChunks(ImGuiLargeText* text, int chunk_n)
+{
+    if (chunk_n < 0 || chunk_n + 1 >= text->Chunks.Size)
+        return;
+    ImGuiLargeTextChunk* chunk = &text->Chunks[chunk_n];
+    ImGuiLargeTextChunk* next = &text->Chunks[chunk_n + 1];
+    if (chunk->Size + next->Size > text->ChunkSizeMax / 2)
+        return;
+    if (chunk->Capacity < chunk->Size + next->Size)
+    {
+        char* data = (char*)IM_ALLOC((size_t)text->ChunkSizeMax);
+        memcpy(data, chunk->Data, (size_t)chunk->Size);
+        IM_FREE(chunk->Data);
+        chunk->Data = data;
+        chunk->Capacity = text->ChunkSizeMax;
+    }
+    memcpy(chunk->Data + chunk->Size, next->Data, (size_t)next->Size);
+    chunk->Size += next->Size;
+    chunk->LineBreaks += next->LineBreaks;
+    text->RemoveChunk(chunk_n + 1);
+}
+
+static void ImGuiLargeText_InsertRange(ImGuiLargeText* text, int pos, const char* src, int len)
+{
+    if (text->Chunks.Size == 0)
+    {
+        ImGuiLargeTextChunk chunk;
+        memset(&chunk, 0, sizeof(chunk));
+        text->Chunks.push_back(chunk);
+        text->InvalidateIndex(0);
+    }
+    const int chunk_n = text->FindChunk(pos);
+    ImGuiLargeTextChunk* chunk = &text->Chunks[chunk_n];
+    const int offset = pos - text->ChunkStarts[chunk_n];
+    if (chunk->Size + len > chunk->Capacity)
+    {
+        const int capacity = ImMax(chunk->Size + len, text->ChunkSizeMax);
+        char* data = (char*)IM_ALLOC((size_t)capacity);
+        if (chunk->Data)
+        {
+            memcpy(data, chunk->Data, (size_t)chunk->Size);
+            IM_FREE(chunk->Data);
+        }
+        chunk->Data = data;
+        chunk->Capacity = capacity;
+    }
+    memmove(chunk->Data + offset + len, chunk->Data + offset, (size_t)(chunk->Size - offset));
+    memcpy(chunk->Data + offset, src, (size_t)len);
+    const int line_breaks = ImGuiLargeText_CountLineBreaks(src, src + len);
+    chunk->Size += len;
+    chunk->LineBreaks += line_breaks;
+    text->TextSize += len;
+    text->LineBreaks += line_breaks;
+    text->InvalidateIndex(chunk_n + 1);
+    if (chunk->Size > text->ChunkSizeMax)
+        text->SplitChunk(chunk_n);
+}
+
+static void ImGuiLargeText_EraseRange(ImGuiLargeText* text, int pos, int len)
+{
+    if (len <= 0)
+        return;
+    const int chunk_n = text->FindChunk(pos);
+    int remaining = len;
+
+    // Partial or whole first chunk
+    {
+        ImGuiLargeTextChunk* chunk = &text->Chunks[chunk_n];
+        const int offset = pos - text->ChunkStarts[chunk_n];
+        const int erase_len = ImMin(remaining, chunk->Size - offset);
+        const int line_breaks = ImGuiLargeText_CountLineBreaks(chunk->Data + offset, chunk->Data + offset + erase_len);
+        memmove(chunk->Data + offset, chunk->Data + offset + erase_len, (size_t)(chunk->Size - offset - erase_len));
+        chunk->Size -= erase_len;
+        chunk->LineBreaks -= line_breaks;
+        text->TextSize -= erase_len;
+        text->LineBreaks -= line_breaks;
+        remaining -= erase_len;
+    }
+
+    // Whole chunks, removed at once
+    int last_n = chunk_n + 1;
+    while (remaining > 0 && last_n < text->Chunks.Size && text->Chunks[last_n].Size <= remaining)
+    {
+        ImGuiLargeTextChunk* chunk = &text->Chunks[last_n++];
+        text->TextSize -= chunk->Size;
+        text->LineBreaks -= chunk->LineBreaks;
+        remaining -= chunk->Size;
+        IM_FREE(chunk->Data);
+    }
+    if (last_n > chunk_n + 1)
+        text->Chunks.erase(text->Chunks.Data + chunk_n + 1, text->Chunks.Data + last_n);
+
+    // Beginning of the last chunk
+    if (remaining > 0)
+    {
+        ImGuiLargeTextChunk* chunk = &text->Chunks[chunk_n + 1];
+        const int line_breaks = ImGuiLargeText_CountLineBreaks(chunk->Data, chunk->Data + remaining);
+        memmove(chunk->Data, chunk->Data + remaining, (size_t)(chunk->Size - remaining));
+        chunk->Size -= remaining;
+        chunk->LineBreaks -= line_breaks;
+        text->TextSize -= remaining;
+        text->LineBreaks -= line_breaks;
+    }
+    text->InvalidateIndex(chunk_n + 1);
+
+    if (text->Chunks[chunk_n].Size == 0 && text->Chunks.Size > 1)
+        text->RemoveChunk(chunk_n);
+    else
+        ImGuiLargeText_TryMergeChunks(text, chunk_n);
+    ImGuiLargeText_TryMergeChunks(text, chunk_n - 1);
+}
+
+static void ImGuiLargeText_CopyRange(ImGuiLargeText* text, int pos, int len, char* out)
+{
+    if (len <= 0)
+        return;
+    int chunk_n = text->FindChunk(pos);
+    int offset = pos - text->ChunkStarts[chunk_n];
+    while (len > 0)
+    {
+        const ImGuiLargeTextChunk* chunk = &text->Chunks[chunk_n++];
+        const int copy_len = ImMin(len, chunk->Size - offset);
+        memcpy(out, chunk->Data + offset, (size_t)copy_len);
+        out += copy_len;
+        len -= copy_len;
+        offset = 0;
+    }
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] Document
+//-------------------------------------------------------------------------
+
+void ImGuiLargeText::SetText(const char* text, const char* text_end)
+{
+    Clear();
+    Insert(0, text, text_end);
+}
+
+void ImGuiLargeText::Append(const char* text, const char* text_end)
+{
+    Insert(TextSize, text, text_end);
+}
+
+void ImGuiLargeText::Insert(int pos, const char* text, const char* text_end)
+{
+    if (text_end == NULL)
+        text_end = text + strlen(text);
+    ClearUndo();
+    ApplyEdit(pos, 0, text, (int)(text_end - text), false);
+}
+
+void ImGuiLargeText::Erase(int pos, int len)
+{
+    ClearUndo();
+    ApplyEdit(pos, len, NULL, 0, false);
+}
+
+// Replace 'erase_len' bytes at 'pos' with 'text', keeping the cursor and selection at the same place in the text around the edit.
+void ImGuiLargeText::ApplyEdit(int pos, int erase_len, const char* text, int text_len, bool record_undo)
+{
+    IM_ASSERT(pos >= 0 && erase_len >= 0 && pos + erase_len <= TextSize);
+    if (erase_len == 0 && text_len == 0)
+        return;
+
+    if (record_undo)
+    {
+        // Drop redo history
+        if (UndoRecordsCurrent < UndoRecords.Size)
+        {
+            UndoText.resize(UndoRecords[UndoRecordsCurrent].TextOffset);
+            UndoRecords.resize(UndoRecordsCurrent);
+        }
+
+        // Consecutive typing is merged into a single record
+        ImGuiLargeTextUndoRecord* last = UndoRecords.Size > 0 ? &UndoRecords.back() : NULL;
+        if (last && erase_len == 0 && text_len == 1 && text[0] != '\n' && last->InsertedLen > 0 && last->Pos + last->InsertedLen == pos)
+        {
+            UndoText.push_back(text[0]);
+            last->InsertedLen++;
+        }
+        else
+        {
+            ImGuiLargeTextUndoRecord record;
+            record.Pos = pos;
+            record.ErasedLen = erase_len;
+            record.InsertedLen = text_len;
+            record.TextOffset = UndoText.Size;
+            UndoText.resize(UndoText.Size + erase_len + text_len);
+            ImGuiLargeText_CopyRange(this, pos, erase_len, UndoText.Data + record.TextOffset);
+            if (text_len > 0)
+                memcpy(UndoText.Data + record.TextOffset + erase_len, text, (size_t)text_len);
+            UndoRecords.push_back(record);
+        }
+        UndoRecordsCurrent = UndoRecords.Size;
+    }
+
+    ImGuiLargeText_EraseRange(this, pos, erase_len);
+    if (text_len > 0)
+        ImGuiLargeText_InsertRange(this, pos, text, text_len);
+
+    int* positions[2] = { &Cursor, &SelectionAnchor };
+    for (int* p : positions)
+        if (*p > pos)
+            *p = (*p < pos + erase_len) ? pos : *p - erase_len + text_len;
+}
+
+void ImGuiLargeText::GetText(ImVector<char>* out, int pos, int len)
+{
+    pos = ImClamp(pos, 0, TextSize);
+    len = (len < 0) ? TextSize - pos : ImMin(len, TextSize - pos);
+    out->resize(len + 1);
+    ImGuiLargeText_CopyRange(this, pos, len, out->Data);
+    out->Data[len] = 0;
+}
+
+char ImGuiLargeText::GetChar(int pos)
+{
+    if (pos < 0 || pos >= TextSize)
+        return 0;
+    const int chunk_n = FindChunk(pos);
+    return Chunks[chunk_n].Data[pos - ChunkStarts[chunk_n]];
+}
+
+int ImGuiLargeText::GetLineStart(int line)
+{
+    if (line <= 0)
+        return 0;
+    if (line > LineBreaks)
+        return TextSize;
+    UpdateIndex();
+
+    // Find the last chunk with less than 'line' line breaks before it: it contains the one ending line-1.
+    int lo = 0, hi = Chunks.Size - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) / 2;
+        if (ChunkLines[mid] < line)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    const ImGuiLargeTextChunk* chunk = &Chunks[lo];
+    const char* p = chunk->Data;
+    const char* p_end = chunk->Data + chunk->Size;
+    for (int line_breaks = line - ChunkLines[lo]; line_breaks > 0; line_breaks--)
+    {
+        p = (const char*)memchr(p, '\n', (size_t)(p_end - p));
+        IM_ASSERT(p != NULL);
+        p++;
+    }
+    return ChunkStarts[lo] + (int)(p - chunk->Data);
+}
+
+int ImGuiLargeText::GetLineEnd(int line)
+{
+    return (line >= LineBreaks) ? TextSize : GetLineStart(line + 1) - 1;
+}
+
+int ImGuiLargeText::GetLineFromPos(int pos)
+{
+    pos = ImClamp(pos, 0, TextSize);
+    const int chunk_n = FindChunk(pos);
+    if (chunk_n < 0)
+        return 0;
+    const ImGuiLargeTextChunk* chunk = &Chunks[chunk_n];
+    return ChunkLines[chunk_n] + ImGuiLargeText_CountLineBreaks(chunk->Data, chunk->Data + pos - ChunkStarts[chunk_n]);
+}
+
+int ImGuiLargeText::ReadLine(int pos, ImVector<char>* out)
+{
+    out->resize(0);
+    if (pos < 0 || pos > TextSize)
+        return -1;
+    int chunk_n = FindChunk(pos);
+    if (chunk_n < 0)
+        return -1;
+    int offset = pos - ChunkStarts[chunk_n];
+    for (; chunk_n < Chunks.Size; chunk_n++, offset = 0)
+    {
+        const ImGuiLargeTextChunk* chunk = &Chunks[chunk_n];
+        const char* p = chunk->Data + offset;
+        const char* p_end = chunk->Data + chunk->Size;
+        const char* eol = (const char*)memchr(p, '\n', (size_t)(p_end - p));
+        ImGuiLargeText_AppendToVector(out, p, eol ? eol : p_end);
+        if (eol)
+            return ChunkStarts[chunk_n] + (int)(eol - chunk->Data) + 1;
+    }
+    return -1;
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] Editing
+//-------------------------------------------------------------------------
+
+void ImGuiLargeText::SetCursor(int pos, bool select)
+{
+    Cursor = ImClamp(pos, 0, TextSize);
+    if (!select)
+        SelectionAnchor = Cursor;
+    CursorPreferredX = -1.0f;
+    CursorAnimTime = -0.30f; // Keep cursor visible while moving it
+    ScrollToCursor = true;
+}
+
+void ImGuiLargeText::SelectAll()
+{
+    SelectionAnchor = 0;
+    Cursor = TextSize;
+    CursorPreferredX = -1.0f;
+}
+
+void ImGuiLargeText::ReplaceSelection(const char* text, const char* text_end)
+{
+    if (text_end == NULL)
+        text_end = text + strlen(text);
+    const int sel_min = ImMin(Cursor, SelectionAnchor);
+    const int sel_max = ImMax(Cursor, SelectionAnchor);
+    const int text_len = (int)(text_end - text);
+    ApplyEdit(sel_min, sel_max - sel_min, text, text_len, true);
+    SetCursor(sel_min + text_len);
+}
+
+void ImGuiLargeText::Undo()
+{
+    if (UndoRecordsCurrent == 0)
+        return;
+    const ImGuiLargeTextUndoRecord record = UndoRecords[--UndoRecordsCurrent];
+    ApplyEdit(record.Pos, record.InsertedLen, UndoText.Data + record.TextOffset, record.ErasedLen, false);
+    SetCursor(record.Pos + record.ErasedLen);
+}
+
+void ImGuiLargeText::Redo()
+{
+    if (UndoRecordsCurrent == UndoRecords.Size)
+        return;
+    const ImGuiLargeTextUndoRecord record = UndoRecords[UndoRecordsCurrent++];
+    ApplyEdit(record.Pos, record.ErasedLen, UndoText.Data + record.TextOffset + record.ErasedLen, record.InsertedLen, false);
+    SetCursor(record.Pos + record.InsertedLen);
+}
+
+static int ImGuiLargeText_PrevCharPos(ImGuiLargeText* text, int pos)
+{
+    if (pos <= 0)
+        return 0;
+    pos--;
+    while (pos > 0 && ImGuiLargeText_IsUtf8Continuation(text->GetChar(pos)))
+        pos--;
+    return pos;
+}
+
+static int ImGuiLargeText_NextCharPos(ImGuiLargeText* text, int pos)
+{
+    if (pos >= text->TextSize)
+        return text->TextSize;
+    pos++;
+    while (pos < text->TextSize && ImGuiLargeText_IsUtf8Continuation(text->GetChar(pos)))
+        pos++;
+    return pos;
+}
+
+static int ImGuiLargeText_WordLeftPos(ImGuiLargeText* text, int pos)
+{
+    while (pos > 0 && !ImGuiLargeText_IsWordChar(text->GetChar(pos - 1)) && text->GetChar(pos - 1) != '\n')
+        pos--;
+    if (pos > 0 && text->GetChar(pos - 1) == '\n' && !ImGuiLargeText_IsWordChar(text->GetChar(pos)))
+        return pos - 1;
+    while (pos > 0 && ImGuiLargeText_IsWordChar(text->GetChar(pos - 1)))
+        pos--;
+    return pos;
+}
+
+static int ImGuiLargeText_WordRightPos(ImGuiLargeText* text, int pos)
+{
+    if (text->GetChar(pos) == '\n')
+        return pos + 1;
+    while (pos < text->TextSize && ImGuiLargeText_IsWordChar(text->GetChar(pos)))
+        pos++;
+    while (pos < text->TextSize && !ImGuiLargeText_IsWordChar(text->GetChar(pos)) && text->GetChar(pos) != '\n')
+        pos++;
+    return pos;
+}
+
+// Horizontal position of 'pos' within its line
+static float ImGuiLargeText_CalcPosX(ImGuiLargeText* text, int pos, ImFont* font, float font_size)
+{
+    const int line_start = text->GetLineStart(text->GetLineFromPos(pos));
+    text->ReadLine(line_start, &text->LineBuf);
+    return ImGuiLargeText_CalcOffsetX(font, font_size, text->LineBuf.Data, pos - line_start);
+}
+
+static int ImGuiLargeText_CalcPosFromLineX(ImGuiLargeText* text, int line, float x, ImFont* font, float font_size)
+{
+    const int line_start = text->GetLineStart(line);
+    text->ReadLine(line_start, &text->LineBuf);
+    return line_start + ImGuiLargeText_CalcOffsetFromX(font, font_size, text->LineBuf.Data, text->LineBuf.Size, x);
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] Display
+//-------------------------------------------------------------------------
+
+bool ImGuiLargeText::Draw(const char* str_id, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    const ImGuiStyle& style = g.Style;
+    Edited = false;
+
+    ImGuiWindow* parent_window = ImGui::GetCurrentWindow();
+    if (parent_window->SkipItems)
+        return false;
+    const ImGuiID id = parent_window->GetID(str_id);
+    const ImVec2 size = ImGui::CalcItemSize(size_arg, ImGui::CalcItemWidth(), g.FontSize * 8.0f + style.FramePadding.y * 2.0f);
+    if (!ImGui::BeginChildFrame(id, size, ImGuiWindowFlags_HorizontalScrollbar | ImGuiWindowFlags_NoNavInputs))
+    {
+        ImGui::EndChildFrame();
+        return false;
+    }
+
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    const ImGuiID text_id = window->GetID("#text");
+    ImFont* font = g.Font;
+    const float font_size = g.FontSize;
+    const float line_height = g.FontSize;
+    const ImVec2 text_origin = window->DC.CursorPos; // Top-left of the first line, scrolled
+    const ImRect frame_bb = window->InnerRect;
+    const int lines_per_page = ImMax((int)((frame_bb.GetHeight() - style.FramePadding.y * 2.0f) / line_height), 1);
+
+    ImGui::ItemAdd(frame_bb, text_id);
+    const bool hovered = ImGui::ItemHoverable(frame_bb, text_id, ImGuiItemFlags_None);
+    if (hovered)
+        g.MouseCursor = ImGuiMouseCursor_TextInput;
+
+    // Mouse
+    const ImVec2 mouse_rel = io.MousePos - text_origin;
+    const int mouse_line = ImClamp((int)ImFloor(mouse_rel.y / line_height), 0, GetLinesCount() - 1);
+    if (hovered && io.MouseClicked[0])
+    {
+        ImGui::SetActiveID(text_id, window);
+        ImGui::SetFocusID(text_id, window);
+        ImGui::FocusWindow(window);
+        const int pos = ImGuiLargeText_CalcPosFromLineX(this, mouse_line, mouse_rel.x, font, font_size);
+        if (io.MouseClickedCount[0] >= 3 && !io.KeyShift)
+        {
+            // Triple-click: select line
+            SetCursor(GetLineStart(mouse_line));
+            SetCursor(ImMin(GetLineEnd(mouse_line) + 1, TextSize), true);
+        }
+        else if (io.MouseClickedCount[0] == 2 && !io.KeyShift)
+        {
+            // Double-click: select word
+            SetCursor(ImGuiLargeText_IsWordChar(GetChar(pos - 1)) ? ImGuiLargeText_WordLeftPos(this, pos) : pos);
+            int word_end = SelectionAnchor;
+            while (word_end < TextSize && ImGuiLargeText_IsWordChar(GetChar(word_end)))
+                word_end++;
+            SetCursor(word_end, true);
+        }
+        else
+        {
+            SetCursor(pos, io.KeyShift);
+        }
+        IsSelectingWithMouse = true;
+    }
+    else if (g.ActiveId == text_id && io.MouseClicked[0] && !hovered)
+    {
+        ImGui::ClearActiveID();
+    }
+    if (IsSelectingWithMouse)
+    {
+        if (g.ActiveId == text_id && io.MouseDown[0])
+        {
+            if (ImGui::IsMouseDragging(0))
+                SetCursor(ImGuiLargeText_CalcPosFromLineX(this, mouse_line, mouse_rel.x, font, font_size), true);
+        }
+        else
+        {
+            IsSelectingWithMouse = false;
+        }
+    }
+
+    // Keyboard
+    const bool is_active = (g.ActiveId == text_id);
+    if (is_active)
+    {
+        g.ActiveIdUsingNavDirMask |= (1 << ImGuiDir_Left) | (1 << ImGuiDir_Right) | (1 << ImGuiDir_Up) | (1 << ImGuiDir_Down);
+        g.ActiveIdAllowOverlap = !io.MouseDown[0];
+        ImGui::SetKeyOwner(ImGuiKey_Home, text_id);
+        ImGui::SetKeyOwner(ImGuiKey_End, text_id);
+        ImGui::SetKeyOwner(ImGuiKey_PageUp, text_id);
+        ImGui::SetKeyOwner(ImGuiKey_PageDown, text_id);
+        if (AllowTabInput && !ReadOnly)
+            ImGui::SetKeyOwner(ImGuiKey_Tab, text_id);
+        if (!ReadOnly)
+            g.WantTextInputNextFrame = 1;
+
+        const bool is_osx = io.ConfigMacOSXBehaviors;
+        const bool is_wordmove_key_down = is_osx ? io.KeyAlt : io.KeyCtrl;
+        const bool select = io.KeyShift;
+        const ImGuiInputFlags f_repeat = ImGuiInputFlags_Repeat;
+        const bool is_cut = (ImGui::Shortcut(ImGuiMod_Shortcut | ImGuiKey_X, text_id, f_repeat) || ImGui::Shortcut(ImGuiMod_Shift | ImGuiKey_Delete, text_id, f_repeat)) && !ReadOnly && HasSelection();
+        const bool is_copy = (ImGui::Shortcut(ImGuiMod_Shortcut | ImGuiKey_C, text_id) || ImGui::Shortcut(ImGuiMod_Ctrl | ImGuiKey_Insert, text_id)) && HasSelection();
+        const bool is_paste = (ImGui::Shortcut(ImGuiMod_Shortcut | ImGuiKey_V, text_id, f_repeat) || ImGui::Shortcut(ImGuiMod_Shift | ImGuiKey_Insert, text_id, f_repeat)) && !ReadOnly;
+        const bool is_undo = ImGui::Shortcut(ImGuiMod_Shortcut | ImGuiKey_Z, text_id, f_repeat) && !ReadOnly;
+        const bool is_redo = (ImGui::Shortcut(ImGuiMod_Shortcut | ImGuiKey_Y, text_id, f_repeat) || (is_osx && ImGui::Shortcut(ImGuiMod_Shortcut | ImGuiMod_Shift | ImGuiKey_Z, text_id, f_repeat))) && !ReadOnly;
+        const bool is_select_all = ImGui::Shortcut(ImGuiMod_Shortcut | ImGuiKey_A, text_id);
+        const int sel_min = ImMin(Cursor, SelectionAnchor);
+        const int sel_max = ImMax(Cursor, SelectionAnchor);
+
+        if (ImGui::IsKeyPressed(ImGuiKey_LeftArrow))
+            SetCursor((HasSelection() && !select) ? sel_min : is_wordmove_key_down ? ImGuiLargeText_WordLeftPos(this, Cursor) : ImGuiLargeText_PrevCharPos(this, Cursor), select);
+        else if (ImGui::IsKeyPressed(ImGuiKey_RightArrow))
+            SetCursor((HasSelection() && !select) ? sel_max : is_wordmove_key_down ? ImGuiLargeText_WordRightPos(this, Cursor) : ImGuiLargeText_NextCharPos(this, Cursor), select);
+        else if (ImGui::IsKeyPressed(ImGuiKey_UpArrow) || ImGui::IsKeyPressed(ImGuiKey_DownArrow) || ImGui::IsKeyPressed(ImGuiKey_PageUp) || ImGui::IsKeyPressed(ImGuiKey_PageDown))
+        {
+            const int line_delta = ImGui::IsKeyPressed(ImGuiKey_UpArrow) ? -1 : ImGui::IsKeyPressed(ImGuiKey_DownArrow) ? +1 : ImGui::IsKeyPressed(ImGuiKey_PageUp) ? -lines_per_page : +lines_per_page;
+            const float preferred_x = (CursorPreferredX >= 0.0f) ? CursorPreferredX : ImGuiLargeText_CalcPosX(this, Cursor, font, font_size);
+            const int line = ImClamp(GetLineFromPos(Cursor) + line_delta, 0, GetLinesCount() - 1);
+            SetCursor(ImGuiLargeText_CalcPosFromLineX(this, line, preferred_x, font, font_size), select);
+            CursorPreferredX = preferred_x;
+        }
+        else if (ImGui::IsKeyPressed(ImGuiKey_Home))
+            SetCursor(io.KeyCtrl ? 0 : GetLineStart(GetLineFromPos(Cursor)), select);
+        else if (ImGui::IsKeyPressed(ImGuiKey_End))
+            SetCursor(io.KeyCtrl ? TextSize : GetLineEnd(GetLineFromPos(Cursor)), select);
+        else if (ImGui::IsKeyPressed(ImGuiKey_Delete) && !ReadOnly && !is_cut)
+        {
+            if (!HasSelection())
+                SetCursor(is_wordmove_key_down ? ImGuiLargeText_WordRightPos(this, Cursor) : ImGuiLargeText_NextCharPos(this, Cursor), true);
+            if (HasSelection())
+            {
+                ReplaceSelection("");
+                Edited = true;
+            }
+        }
+        else if (ImGui::IsKeyPressed(ImGuiKey_Backspace) && !ReadOnly)
+        {
+            if (!HasSelection())
+                SetCursor(is_wordmove_key_down ? ImGuiLargeText_WordLeftPos(this, Cursor) : ImGuiLargeText_PrevCharPos(this, Cursor), true);
+            if (HasSelection())
+            {
+                ReplaceSelection("");
+                Edited = true;
+            }
+        }
+        else if ((ImGui::IsKeyPressed(ImGuiKey_Enter) || ImGui::IsKeyPressed(ImGuiKey_KeypadEnter)) && !ReadOnly)
+        {
+            ReplaceSelection("\n");
+            Edited = true;
+        }
+        else if (ImGui::IsKeyPressed(ImGuiKey_Tab) && AllowTabInput && !ReadOnly && !io.KeyCtrl && !io.KeyShift && !io.KeyAlt)
+        {
+            ReplaceSelection("\t");
+            Edited = true;
+        }
+        else if (ImGui::Shortcut(ImGuiKey_Escape, text_id))
+        {
+            ImGui::ClearActiveID();
+        }
+        else if (is_undo || is_redo)
+        {
+            if (is_undo)
+                Undo();
+            else
+                Redo();
+            Edited = true;
+        }
+        else if (is_select_all)
+        {
+            SelectAll();
+        }
+        else if (is_cut || is_copy)
+        {
+            ImVector<char> clipboard;
+            GetText(&clipboard, sel_min, sel_max - sel_min);
+            ImGui::SetClipboardText(clipboard.Data);
+            if (is_cut)
+            {
+                ReplaceSelection("");
+                Edited = true;
+            }
+        }
+        else if (is_paste)
+        {
+            if (const char* clipboard = ImGui::GetClipboardText())
+            {
+                ReplaceSelection(clipboard);
+                Edited = true;
+            }
+        }
+
+        // Text input
+        const bool ignore_char_inputs = (io.KeyCtrl && !io.KeyAlt) || (is_osx && io.KeySuper);
+        if (!ReadOnly && !ignore_char_inputs && io.InputQueueCharacters.Size > 0)
+        {
+            ImVector<char> typed;
+            for (ImWchar c : io.InputQueueCharacters)
+            {
+                if (c < 0x20 || c == 0x7F || (c >= 0xE000 && c <= 0xF8FF)) // Control characters and private use area (e.g. function keys on OSX)
+                    continue;
+                char buf[5];
+                ImTextCharToUtf8(buf, c);
+                ImGuiLargeText_AppendToVector(&typed, buf, buf + strlen(buf));
+            }
+            if (typed.Size > 0)
+            {
+                // Insert one character at a time so that typing is merged in the undo history
+                for (const char* p = typed.begin(); p < typed.end(); p++)
+                    ReplaceSelection(p, p + 1);
+                Edited = true;
+            }
+        }
+        if (!ReadOnly)
+            io.InputQueueCharacters.resize(0);
+    }
+
+    // Declare content size: all lines, but only visible ones are ever read and measured
+    ImGui::ItemSize(ImVec2(MaxLineWidth + font_size, GetLinesCount() * line_height));
+
+    // Scroll to cursor
+    if (ScrollToCursor)
+    {
+        const int cursor_line = GetLineFromPos(Cursor);
+        const float cursor_x = ImGuiLargeText_CalcPosX(this, Cursor, font, font_size);
+        const ImVec2 cursor_pos = text_origin + ImVec2(cursor_x, cursor_line * line_height);
+        ImGui::ScrollToRectEx(window, ImRect(cursor_pos, cursor_pos + ImVec2(1.0f, line_height)), ImGuiScrollFlags_KeepVisibleEdgeX | ImGuiScrollFlags_KeepVisibleEdgeY);
+        ScrollToCursor = false;
+    }
+
+    // Render visible lines
+    const int line_first = ImMax((int)((window->ClipRect.Min.y - text_origin.y) / line_height), 0);
+    const int line_last = ImMin((int)((window->ClipRect.Max.y - text_origin.y) / line_height), GetLinesCount() - 1);
+    const int sel_min = ImMin(Cursor, SelectionAnchor);
+    const int sel_max = ImMax(Cursor, SelectionAnchor);
+    const ImU32 col_text = ImGui::GetColorU32(ImGuiCol_Text);
+    const ImU32 col_sel = ImGui::GetColorU32(ImGuiCol_TextSelectedBg, is_active ? 1.0f : 0.6f);
+    CursorAnimTime += io.DeltaTime;
+    const bool cursor_is_visible = is_active && (!io.ConfigInputTextCursorBlink || CursorAnimTime <= 0.0f || ImFmod(CursorAnimTime, 1.20f) <= 0.80f);
+    ImDrawList* draw_list = window->DrawList;
+    int line_start = GetLineStart(line_first);
+    for (int line = line_first; line <= line_last && line_start >= 0; line++)
+    {
+        const int next_line_start = ReadLine(line_start, &LineBuf);
+        const char* line_text = LineBuf.Data;
+        const int line_len = LineBuf.Size;
+        const ImVec2 line_pos(text_origin.x, text_origin.y + line * line_height);
+        MaxLineWidth = ImMax(MaxLineWidth, ImGuiLargeText_CalcOffsetX(font, font_size, line_text, line_len));
+
+        if (sel_min < sel_max && sel_min <= line_start + line_len && sel_max > line_start)
+        {
+            const float x0 = ImGuiLargeText_CalcOffsetX(font, font_size, line_text, ImMax(sel_min - line_start, 0));
+            float x1 = ImGuiLargeText_CalcOffsetX(font, font_size, line_text, ImMin(sel_max - line_start, line_len));
+            if (sel_max > line_start + line_len)
+                x1 += font_size * 0.4f; // Selected line break
+            draw_list->AddRectFilled(ImVec2(line_pos.x + x0, line_pos.y), ImVec2(line_pos.x + x1, line_pos.y + line_height), col_sel);
+        }
+        if (line_len > 0)
+            draw_list->AddText(font, font_size, line_pos, col_text, line_text, line_text + line_len);
+        if (cursor_is_visible && Cursor >= line_start && Cursor <= line_start + line_len)
+        {
+            const float x = line_pos.x + ImGuiLargeText_CalcOffsetX(font, font_size, line_text, Cursor - line_start);
+            draw_list->AddLine(ImVec2(x, line_pos.y + 0.5f), ImVec2(x, line_pos.y + line_height - 1.5f), col_text);
+        }
+        line_start = next_line_start;
+    }
+
+    ImGui::EndChildFrame();
+    return Edited;
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,119 @@
+// dear imgui: multi-line text editor for large documents
+// (headers)
+
+// Changelog:
+// - v0.10: Initial version.
+
+// ImGuiLargeText is an alternative to InputTextMultiline() for documents of many megabytes (logs, configuration files...).
+// InputTextMultiline() works on a single contiguous buffer, keeps a full ImWchar copy of it while active, and scans it
+// entirely every frame to count lines and measure text. Here:
+// - Text is stored as UTF-8 in chunks of a few KB. Each chunk knows how many line breaks it contains, and a prefix
+//   index over chunks (rebuilt lazily from the first modified chunk) maps a byte offset or a line number to a chunk.
+//   An edit only touches the chunks it covers: its cost depends on the size of the edit, not the size of the document.
+// - Only visible lines are read, measured and rendered. The content width is the widest line seen so far.
+// - Undo/redo records the edited ranges only.
+//
+// Usage:
+//   static ImGuiLargeText text;
+//   if (first_time)
+//       text.SetText(file_data, file_data + file_size);
+//   text.Draw("##config", ImVec2(-FLT_MIN, -FLT_MIN));
+//   if (text.Edited) { ... }                       // Set on the frame the user modified the text.
+// For a read-only log: set ReadOnly = true and call Append() as lines come in.
+//
+// Positions are byte offsets in the UTF-8 text, lines are counted from 0.
+// The Insert()/Erase()/SetText()/Append() functions don't record undo history and clear it, as they would invalidate it.
+
+#pragma once
+#include "imgui.h"      // IMGUI_API
+#ifndef IMGUI_DISABLE
+
+// A chunk of the document (Data is not zero-terminated)
+struct ImGuiLargeTextChunk
+{
+    char*                   Data;
+    int                     Size;
+    int                     Capacity;
+    int                     LineBreaks;     // Number of '\n' in Data[0..Size)
+};
+
+// One user edit: 'ErasedLen' bytes at 'Pos' replaced by 'InsertedLen' bytes. Both texts are stored in UndoText[] at 'TextOffset', erased text first.
+struct ImGuiLargeTextUndoRecord
+{
+    int                     Pos;
+    int                     ErasedLen;
+    int                     InsertedLen;
+    int                     TextOffset;
+};
+
+struct ImGuiLargeText
+{
+    // Storage
+    ImVector<ImGuiLargeTextChunk> Chunks;   // Never contains empty chunks, unless the document is empty
+    int                     ChunkSizeMax;   // = 8192   // Chunks growing past this are split. Smaller chunks make edits cheaper but the index larger.
+    int                     TextSize;       // In bytes
+    int                     LineBreaks;     // Number of '\n' in the document. GetLinesCount() == LineBreaks + 1
+
+    // Options
+    bool                    ReadOnly;       // Allow selecting/copying only
+    bool                    AllowTabInput;  // = true   // Insert '\t' when pressing Tab (instead of moving focus)
+
+    // Editing state
+    int                     Cursor;         // Byte offset of the cursor
+    int                     SelectionAnchor;// Other end of the selection (== Cursor when there is no selection)
+    float                   CursorPreferredX;// Horizontal position to stay on when moving up/down. -1.0f when it needs to be recomputed from Cursor.
+    bool                    Edited;         // Set by Draw() when the user modified the text during this frame
+    float                   MaxLineWidth;   // Widest line measured so far, used as content width
+    ImVector<ImGuiLargeTextUndoRecord> UndoRecords;
+    int                     UndoRecordsCurrent; // Records [0, UndoRecordsCurrent) can be undone, following ones can be redone
+    ImVector<char>          UndoText;
+
+    // [Internal] Index: ChunkStarts[n] = byte offset of chunk n, ChunkLines[n] = number of '\n' before chunk n. Valid for n < IndexValidCount.
+    ImVector<int>           ChunkStarts;
+    ImVector<int>           ChunkLines;
+    int                     IndexValidCount;
+    ImVector<char>          LineBuf;        // [Internal] Text of the line being processed
+    float                   CursorAnimTime;
+    bool                    ScrollToCursor;
+    bool                    IsSelectingWithMouse;
+
+    IMGUI_API ImGuiLargeText();
+    IMGUI_API ~ImGuiLargeText();
+
+    // Document
+    IMGUI_API void          Clear();
+    IMGUI_API void          SetText(const char* text, const char* text_end = NULL);
+    IMGUI_API void          Append(const char* text, const char* text_end = NULL);
+    IMGUI_API void          Insert(int pos, const char* text, const char* text_end = NULL);
+    IMGUI_API void          Erase(int pos, int len);
+    IMGUI_API void          GetText(ImVector<char>* out, int pos = 0, int len = -1);   // Copy a range of the text into 'out', zero-terminated.
+    IMGUI_API char          GetChar(int pos);
+    int                     GetTextSize() const     { return TextSize; }
+    int                     GetLinesCount() const   { return LineBreaks + 1; }
+    IMGUI_API int           GetLineStart(int line);                     // Byte offset of the first character of 'line'
+    IMGUI_API int           GetLineEnd(int line);                       // Byte offset of the '\n' ending 'line' (or TextSize on the last line)
+    IMGUI_API int           GetLineFromPos(int pos);
+    IMGUI_API int           ReadLine(int pos, ImVector<char>* out);     // Copy text from 'pos' to the end of its line into 'out' (without '\n', not zero-terminated). Return the start of the next line, or -1 after the last line.
+
+    // Editing
+    bool                    HasSelection() const    { return Cursor != SelectionAnchor; }
+    IMGUI_API void          SetCursor(int pos, bool select = false);   // Move the cursor. When 'select' is true, extend the selection instead of clearing it.
+    IMGUI_API void          SelectAll();
+    IMGUI_API void          ReplaceSelection(const char* text, const char* text_end = NULL); // Replace the selection (or insert at cursor) as a user edit: recorded for undo.
+    IMGUI_API void          Undo();
+    IMGUI_API void          Redo();
+
+    // Display
+    IMGUI_API bool          Draw(const char* str_id, const ImVec2& size = ImVec2(0.0f, 0.0f)); // Return true when the text was edited this frame.
+
+    // [Internal]
+    IMGUI_API void          UpdateIndex();
+    IMGUI_API int           FindChunk(int pos);                         // Index of the chunk containing byte 'pos' (the last chunk for pos == TextSize)
+    IMGUI_API void          InvalidateIndex(int chunk_n);
+    IMGUI_API void          SplitChunk(int chunk_n);
+    IMGUI_API void          RemoveChunk(int chunk_n);
+    IMGUI_API void          ApplyEdit(int pos, int erase_len, const char* text, int text_len, bool record_undo);
+    IMGUI_API void          ClearUndo();
+};
+
+#endif // #ifndef IMGUI_DISABLE
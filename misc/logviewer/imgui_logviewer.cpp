@@ -0,0 +1,367 @@
+// dear imgui: log viewer fed from multiple threads
+
+// Changelog:
+// - v0.10: Initial version.
+
+// See imgui_logviewer.h for usage.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_internal.h"     // ImFormatStringV(), ImUpperPowerOfTwo()
+#include "imgui_logviewer.h"
+
+// Clang warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wold-style-cast"     // warning: use of old-style cast
+#pragma clang diagnostic ignored "-Wsign-conversion"    // warning: implicit conversion changes signedness
+#endif
+
+//-------------------------------------------------------------------------
+// [SECTION] Ring buffer
+//-------------------------------------------------------------------------
+// Positions are free-running 32-bit counters, the slot of position 'pos' is Slots[pos & (SlotsCount - 1)].
+// - A producer reserves N slots by moving WriteHead forward (CAS), as long as it doesn't go past ReadTail + SlotsCount.
+//   It then fills the slots and publishes the message by storing Sequence = pos + 1 in its first slot (release).
+//   Otherwise the Sequence of a slot is always equal to its position modulo SlotsCount: slots start with their index, and the
+//   consumer stores pos back into a first slot once read. A slot which was a middle slot or unused in previous laps can
+//   therefore never be mistaken for ready, even after the 32-bit positions wrap around.
+// - The consumer reads messages in order from ReadTail, stopping at the first one not published yet, and moves ReadTail
+//   forward (release) once it's done with the slots, giving them back to producers.
+// Producers never wait on each other except for the CAS, and never wait on the consumer: a full ring drops the message.
+//-------------------------------------------------------------------------
+
+static const int IMGUI_LOGVIEWER_SLOT_DATA_SIZE = (int)sizeof(ImGuiLogViewerSlot::Data);
+
+ImGuiLogViewer::ImGuiLogViewer(int ring_size)
+{
+    SlotsCount = (ImU32)ImUpperPowerOfTwo(ImMax(ring_size / (int)sizeof(ImGuiLogViewerSlot), 64));
+    Slots = (ImGuiLogViewerSlot*)IM_ALLOC(SlotsCount * sizeof(ImGuiLogViewerSlot));
+    for (ImU32 n = 0; n < SlotsCount; n++)
+        IM_PLACEMENT_NEW(&Slots[n].Sequence) std::atomic<ImU32>(n);
+    WriteHead = ReadTail = 0;
+    DroppedCount = 0;
+    LinesPerBlock = 4096;
+    LinesCount = 0;
+    MaxLines = 0;
+    DiscardedLinesCount = 0;
+    FilterNextLine = 0;
+    FilterLinesPerFrame = 50000;
+    AutoScroll = true;
+}
+
+ImGuiLogViewer::~ImGuiLogViewer()
+{
+    Clear();
+    IM_FREE(Slots);
+}
+
+bool ImGuiLogViewer::AddText(const char* text, const char* text_end)
+{
+    if (text_end == NULL)
+        text_end = text + strlen(text);
+    if (text_end > text && text_end[-1] == '\n')
+        text_end--;
+
+    // Messages larger than the whole ring are truncated
+    int text_len = (int)(text_end - text);
+    const int max_text_len = (int)SlotsCount * IMGUI_LOGVIEWER_SLOT_DATA_SIZE - (int)sizeof(ImU32);
+    text_len = ImMin(text_len, max_text_len);
+    const ImU32 slots_needed = (ImU32)((sizeof(ImU32) + text_len + IMGUI_LOGVIEWER_SLOT_DATA_SIZE - 1) / IMGUI_LOGVIEWER_SLOT_DATA_SIZE);
+
+    // Reserve slots
+    ImU32 pos = WriteHead.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        const ImU32 tail = ReadTail.load(std::memory_order_acquire);
+        if (pos - tail + slots_needed > SlotsCount)
+        {
+            DroppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (WriteHead.compare_exchange_weak(pos, pos + slots_needed, std::memory_order_relaxed))
+            break;
+    }
+
+    // Fill them: [size][text], wrapping around the end of the ring if needed
+    const ImU32 mask = SlotsCount - 1;
+    ImGuiLogViewerSlot* first_slot = &Slots[pos & mask];
+    const ImU32 size = (ImU32)text_len;
+    memcpy(first_slot->Data, &size, sizeof(size));
+    int slot_offset = (int)sizeof(size);
+    ImU32 slot_pos = pos;
+    while (text_len > 0)
+    {
+        if (slot_offset == IMGUI_LOGVIEWER_SLOT_DATA_SIZE)
+        {
+            slot_pos++;
+            slot_offset = 0;
+        }
+        const int copy_len = ImMin(text_len, IMGUI_LOGVIEWER_SLOT_DATA_SIZE - slot_offset);
+        memcpy(Slots[slot_pos & mask].Data + slot_offset, text, (size_t)copy_len);
+        text += copy_len;
+        text_len -= copy_len;
+        slot_offset += copy_len;
+    }
+
+    // Publish
+    first_slot->Sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool ImGuiLogViewer::AddLogV(const char* fmt, va_list args)
+{
+    char buf[4096];
+    const int len = ImFormatStringV(buf, IM_ARRAYSIZE(buf), fmt, args);
+    return AddText(buf, buf + len);
+}
+
+bool ImGuiLogViewer::AddLog(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    const bool ret = AddLogV(fmt, args);
+    va_end(args);
+    return ret;
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] Lines
+//-------------------------------------------------------------------------
+
+void ImGuiLogViewer::Clear()
+{
+    for (ImGuiLogViewerBlock* block : Blocks)
+        IM_DELETE(block);
+    Blocks.clear();
+    LinesCount = 0;
+    FilteredLines.clear();
+    FilterNextLine = 0;
+}
+
+void ImGuiLogViewer::GetLine(int line, const char** out_begin, const char** out_end) const
+{
+    IM_ASSERT(line >= 0 && line < LinesCount);
+    const ImGuiLogViewerBlock* block = Blocks[line / LinesPerBlock];
+    const int line_in_block = line % LinesPerBlock;
+    const char* text = block->Text.Data;
+    *out_begin = text + (line_in_block > 0 ? block->LineEnds[line_in_block - 1] : 0);
+    *out_end = text + block->LineEnds[line_in_block];
+}
+
+void ImGuiLogViewer::AddLine(const char* line, const char* line_end)
+{
+    if (LinesCount == Blocks.Size * LinesPerBlock)
+    {
+        // The newest block is always kept, so a MaxLines smaller than LinesPerBlock doesn't empty the log
+        while (MaxLines > 0 && LinesCount + 1 > MaxLines && Blocks.Size > 1)
+            DiscardOldestBlock();
+        ImGuiLogViewerBlock* block = IM_NEW(ImGuiLogViewerBlock)();
+        block->LineEnds.reserve(LinesPerBlock);
+        Blocks.push_back(block);
+    }
+    ImGuiLogViewerBlock* block = Blocks.back();
+    const int offset = block->Text.Size;
+    block->Text.resize(offset + (int)(line_end - line));
+    if (line_end > line)
+        memcpy(block->Text.Data + offset, line, (size_t)(line_end - line));
+    block->LineEnds.push_back(block->Text.Size);
+    LinesCount++;
+}
+
+// Lines are numbered from the oldest one kept, so discarding a block shifts every line number down by LinesPerBlock.
+void ImGuiLogViewer::DiscardOldestBlock()
+{
+    IM_DELETE(Blocks[0]);
+    Blocks.erase(Blocks.Data);
+    LinesCount -= LinesPerBlock;
+    DiscardedLinesCount += LinesPerBlock;
+
+    int remove_count = 0;
+    while (remove_count < FilteredLines.Size && FilteredLines[remove_count] < LinesPerBlock)
+        remove_count++;
+    if (remove_count > 0)
+        FilteredLines.erase(FilteredLines.Data, FilteredLines.Data + remove_count);
+    for (int& line : FilteredLines)
+        line -= LinesPerBlock;
+    FilterNextLine = ImMax(FilterNextLine - LinesPerBlock, 0);
+}
+
+void ImGuiLogViewer::ResetFilter()
+{
+    FilteredLines.resize(0);
+    FilterNextLine = 0;
+}
+
+void ImGuiLogViewer::Update()
+{
+    // Drain the ring. Lines are copied straight from the slots when they don't straddle two slots.
+    const ImU32 mask = SlotsCount - 1;
+    ImU32 tail = ReadTail.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        ImGuiLogViewerSlot* first_slot = &Slots[tail & mask];
+        if (first_slot->Sequence.load(std::memory_order_acquire) != tail + 1)
+            break;
+        ImU32 size;
+        memcpy(&size, first_slot->Data, sizeof(size));
+        const ImU32 slots_used = (ImU32)((sizeof(ImU32) + size + IMGUI_LOGVIEWER_SLOT_DATA_SIZE - 1) / IMGUI_LOGVIEWER_SLOT_DATA_SIZE);
+
+        const char* text;
+        if (slots_used == 1)
+        {
+            text = first_slot->Data + sizeof(size);
+        }
+        else
+        {
+            // Gather the message in a contiguous buffer
+            if (MessageBuf.Size < (int)size)
+                MessageBuf.resize((int)size);
+            int remaining = (int)size;
+            int slot_offset = (int)sizeof(size);
+            char* dst = MessageBuf.Data;
+            for (ImU32 slot_pos = tail; remaining > 0; slot_pos++, slot_offset = 0)
+            {
+                const int copy_len = ImMin(remaining, IMGUI_LOGVIEWER_SLOT_DATA_SIZE - slot_offset);
+                memcpy(dst, Slots[slot_pos & mask].Data + slot_offset, (size_t)copy_len);
+                dst += copy_len;
+                remaining -= copy_len;
+            }
+            text = MessageBuf.Data;
+        }
+
+        // Split into lines
+        const char* text_end = text + size;
+        while (true)
+        {
+            const char* line_end = (const char*)memchr(text, '\n', (size_t)(text_end - text));
+            AddLine(text, line_end ? line_end : text_end);
+            if (line_end == NULL)
+                break;
+            text = line_end + 1;
+        }
+
+        first_slot->Sequence.store(tail, std::memory_order_relaxed); // Not ready, until published again on a later lap
+        tail += slots_used;
+        ReadTail.store(tail, std::memory_order_release);
+    }
+
+    // Filter new lines
+    if (Filter.IsActive())
+    {
+        const int filter_end = (FilterLinesPerFrame > 0) ? ImMin(LinesCount, FilterNextLine + FilterLinesPerFrame) : LinesCount;
+        for (int line = FilterNextLine; line < filter_end; line++)
+        {
+            const char* line_begin;
+            const char* line_end;
+            GetLine(line, &line_begin, &line_end);
+            if (Filter.PassFilter(line_begin, line_end))
+                FilteredLines.push_back(line);
+        }
+        FilterNextLine = filter_end;
+    }
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] Display
+//-------------------------------------------------------------------------
+
+static void ImGuiLogViewer_DrawLines(ImGuiLogViewer* log)
+{
+    const bool filtered = log->Filter.IsActive();
+    ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+    ImGuiListClipper clipper;
+    clipper.Begin(filtered ? log->FilteredLines.Size : log->LinesCount);
+    while (clipper.Step())
+        for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+        {
+            const char* line_begin;
+            const char* line_end;
+            log->GetLine(filtered ? log->FilteredLines[n] : n, &line_begin, &line_end);
+            ImGui::TextUnformatted(line_begin, line_end);
+        }
+    clipper.End();
+    ImGui::PopStyleVar();
+
+    // Keep up at the bottom of the scroll region if we were already at the bottom at the beginning of the frame.
+    if (log->AutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+        ImGui::SetScrollHereY(1.0f);
+}
+
+void ImGuiLogViewer::Draw(const char* str_id, const ImVec2& size)
+{
+    ImGui::PushID(str_id);
+    ImGui::BeginGroup();
+
+    // Options menu
+    if (ImGui::BeginPopup("Options"))
+    {
+        ImGui::Checkbox("Auto-scroll", &AutoScroll);
+        ImGui::EndPopup();
+    }
+    if (ImGui::Button("Options"))
+        ImGui::OpenPopup("Options");
+    ImGui::SameLine();
+    const bool clear = ImGui::Button("Clear");
+    ImGui::SameLine();
+    const bool copy = ImGui::Button("Copy");
+    ImGui::SameLine();
+    if (Filter.Draw("Filter", -100.0f))
+        ResetFilter();
+
+    Update();
+    if (clear)
+        Clear();
+    if (copy)
+    {
+        // Copy all displayed lines, not only the visible ones
+        ImGuiTextBuffer buf;
+        const bool filtered = Filter.IsActive();
+        const int count = filtered ? FilteredLines.Size : LinesCount;
+        for (int n = 0; n < count; n++)
+        {
+            const char* line_begin;
+            const char* line_end;
+            GetLine(filtered ? FilteredLines[n] : n, &line_begin, &line_end);
+            buf.append(line_begin, line_end);
+            buf.append("\n");
+        }
+        ImGui::SetClipboardText(buf.c_str());
+    }
+
+    // Status
+    const int dropped_count = DroppedCount.load(std::memory_order_relaxed);
+    if (Filter.IsActive() && FilterNextLine < LinesCount)
+        ImGui::Text("%d lines, filtering... (%d%%)", LinesCount, (int)((ImS64)FilterNextLine * 100 / LinesCount));
+    else if (Filter.IsActive())
+        ImGui::Text("%d/%d lines", FilteredLines.Size, LinesCount);
+    else
+        ImGui::Text("%d lines", LinesCount);
+    if (dropped_count > 0)
+    {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(%d messages dropped: ring full)", dropped_count);
+    }
+
+    ImGui::Separator();
+    if (ImGui::BeginChild("scrolling", size, false, ImGuiWindowFlags_HorizontalScrollbar))
+        ImGuiLogViewer_DrawLines(this);
+    ImGui::EndChild();
+
+    ImGui::EndGroup();
+    ImGui::PopID();
+}
+
+void ImGuiLogViewer::DrawLines()
+{
+    Update();
+    ImGuiLogViewer_DrawLines(this);
+}
+
+//-------------------------------------------------------------------------
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,95 @@
+// dear imgui: log viewer fed from multiple threads
+// (headers)
+
+// Changelog:
+// - v0.10: Initial version.
+
+// ImGuiLogViewer is a replacement for the ExampleAppLog pattern of imgui_demo.cpp (ImGuiTextBuffer + ImVector<int> of line
+// offsets, filtered from scratch every frame), for logs receiving a lot of lines from any thread:
+// - AddLog()/AddText() can be called from any thread, concurrently. They never lock nor allocate: messages are copied
+//   into a fixed size ring buffer (lock-free, multiple producers, single consumer). When the ring is full the message
+//   is dropped and counted in DroppedCount. Size the ring to hold a few frames worth of messages.
+// - The ring is drained on the UI thread by Draw() (or Update()) into blocks of lines: appending never moves existing
+//   text, and the oldest blocks can be discarded cheaply to keep about MaxLines lines (rounded up to whole blocks).
+// - Filtering is incremental: only lines added since the last frame are tested. When the filter changes, existing lines
+//   are filtered again over several frames (FilterLinesPerFrame) instead of stalling the UI.
+// - Only visible lines are submitted, using ImGuiListClipper.
+//
+// Usage:
+//   static ImGuiLogViewer log;
+//   log.AddLog("[%05d] Hello from thread %d\n", frame, thread_id);   // From any thread
+//   log.Draw("##log");                                                 // From the UI thread, inside a window
+// Each message is one or more lines (a trailing '\n' is optional). AddLog() formats into a 4 KB stack buffer, use
+// AddText() for longer messages.
+// The ring can't be resized once created. Clear() only clears the displayed lines: it may be called while other threads
+// are adding messages. Producer threads must be stopped before destroying the log.
+
+#pragma once
+#include "imgui.h"      // IMGUI_API, ImGuiTextFilter
+#ifndef IMGUI_DISABLE
+#include <atomic>
+
+// A slot of the ring buffer. A message occupies one or more consecutive slots: [size:4 bytes][text...].
+// Sequence is written last by the producer of the message (= its position + 1), telling the consumer the slot is ready.
+struct ImGuiLogViewerSlot
+{
+    std::atomic<ImU32>      Sequence;
+    char                    Data[60];       // Fill a 64 bytes cache line
+};
+
+// Block of consecutive lines. Text is never moved once stored.
+struct ImGuiLogViewerBlock
+{
+    ImVector<char>          Text;
+    ImVector<int>           LineEnds;       // Offset of the end of each line in Text[]. Line n starts at LineEnds[n - 1] (or 0).
+};
+
+struct ImGuiLogViewer
+{
+    // Ring buffer (producers: any thread)
+    ImGuiLogViewerSlot*     Slots;
+    ImU32                   SlotsCount;     // Power of two
+    std::atomic<ImU32>      WriteHead;      // Next slot to reserve
+    std::atomic<ImU32>      ReadTail;       // Next slot to read. Slots [ReadTail, WriteHead) are reserved or ready.
+    std::atomic<int>        DroppedCount;   // Messages dropped because the ring was full
+
+    // Lines (UI thread)
+    ImVector<ImGuiLogViewerBlock*> Blocks;  // Line n is stored in Blocks[n / LinesPerBlock]
+    int                     LinesPerBlock;  // = 4096
+    int                     LinesCount;
+    int                     MaxLines;       // = 0      // When > 0, the oldest lines are discarded by whole blocks: at most MaxLines rounded up to a multiple of LinesPerBlock are kept (at least 2 blocks, the newest full block is never discarded).
+    int                     DiscardedLinesCount;// Lines discarded because of MaxLines
+    ImVector<char>          MessageBuf;     // [Internal] Message straddling several slots
+
+    // Filter
+    ImGuiTextFilter         Filter;
+    ImVector<int>           FilteredLines;  // Lines passing Filter, when Filter.IsActive()
+    int                     FilterNextLine; // Next line to be tested against Filter
+    int                     FilterLinesPerFrame;// = 50000  // Maximum number of lines tested in a frame. Only matters after changing the filter.
+
+    // Display
+    bool                    AutoScroll;     // = true   // Keep scrolling if already at the bottom
+
+    IMGUI_API ImGuiLogViewer(int ring_size = 4 * 1024 * 1024);    // Size of the ring buffer in bytes
+    IMGUI_API ~ImGuiLogViewer();
+
+    // Producers (any thread)
+    IMGUI_API bool          AddLog(const char* fmt, ...) IM_FMTARGS(2);    // Return false if the message was dropped
+    IMGUI_API bool          AddLogV(const char* fmt, va_list args) IM_FMTLIST(2);
+    IMGUI_API bool          AddText(const char* text, const char* text_end = NULL);
+
+    // UI thread
+    IMGUI_API void          Draw(const char* str_id, const ImVec2& size = ImVec2(0.0f, 0.0f)); // Options, filter and lines
+    IMGUI_API void          DrawLines();                                    // Lines only, inside the current window/child
+    IMGUI_API void          Update();                                       // Called by Draw()/DrawLines(). Drain the ring and filter new lines.
+    IMGUI_API void          Clear();
+    IMGUI_API void          ResetFilter();                                  // Call after modifying Filter yourself (Draw() does it when the filter is edited)
+    int                     GetLinesCount() const { return LinesCount; }
+    IMGUI_API void          GetLine(int line, const char** out_begin, const char** out_end) const;
+
+    // [Internal]
+    IMGUI_API void          AddLine(const char* line, const char* line_end);
+    IMGUI_API void          DiscardOldestBlock();
+};
+
+#endif // #ifndef IMGUI_DISABLE
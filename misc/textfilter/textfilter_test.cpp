@@ -0,0 +1,288 @@
+// dear imgui
+// (textfilter_test.cpp)
+// Command line tool to check and measure ImGuiTextFilter matching (ImStristrUpper(), PassFilter(), PassFilterBatch()).
+
+// - Fuzz: compares ImStristrUpper() against ImStristr() on random haystacks/needles made of characters which are
+//   easy to confuse when folding case with the 0x20 bit ('@' vs '`', '[' vs '{', high bytes...), at every length
+//   around the 16 bytes blocks of the SSE path. Haystacks are allocated at their exact size, so a read past the end
+//   is caught when building with -fsanitize=address. Then compares PassFilter() and PassFilterBatch() (single and
+//   multi-threaded) against a reference implementation using ImStristr() with random filters.
+// - Benchmark: filters a generated 1M lines log with a few typical filters, using the reference implementation,
+//   PassFilter() in a loop and PassFilterBatch() split across threads.
+// Build once with SSE (default on x86/x64) and once with IMGUI_DISABLE_SSE defined to cover both paths.
+
+// Build with, e.g:
+//   # g++ -O2 -I../.. textfilter_test.cpp ../../imgui*.cpp -pthread
+//   # g++ -O2 -DIMGUI_DISABLE_SSE -I../.. textfilter_test.cpp ../../imgui*.cpp -pthread
+//   # g++ -O1 -g -fsanitize=address -I../.. textfilter_test.cpp ../../imgui*.cpp -pthread
+//   # cl.exe /O2 /I..\.. textfilter_test.cpp ..\..\imgui*.cpp
+
+// Usage:
+//   textfilter_test.exe [-fuzz <iterations>] [-lines <count>] [-threads <count>]
+
+#define _CRT_SECURE_NO_WARNINGS
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Small deterministic generator, so failures can be reproduced
+static ImU32 g_Seed = 0x12345678;
+static ImU32 Rand()             { g_Seed ^= g_Seed << 13; g_Seed ^= g_Seed >> 17; g_Seed ^= g_Seed << 5; return g_Seed; }
+static int   Rand(int n)        { return (int)(Rand() % (ImU32)n); }
+
+static double GetTimeMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ImGuiTextFilter::PassFilter() as it was before InputBufUpper and ImStristrUpper()
+static bool PassFilterReference(const ImGuiTextFilter& filter, const char* text, const char* text_end)
+{
+    if (filter.Filters.empty())
+        return true;
+    if (text == NULL)
+        text = "";
+    for (const ImGuiTextFilter::ImGuiTextRange& f : filter.Filters)
+    {
+        if (f.empty())
+            continue;
+        if (f.b[0] == '-')
+        {
+            if (ImStristr(text, text_end, f.b + 1, f.e) != NULL)
+                return false;
+        }
+        else
+        {
+            if (ImStristr(text, text_end, f.b, f.e) != NULL)
+                return true;
+        }
+    }
+    if (filter.CountGrep == 0)
+        return true;
+    return false;
+}
+
+static void RandomString(char* out, int len, const char* alphabet)
+{
+    const int alphabet_len = (int)strlen(alphabet);
+    for (int n = 0; n < len; n++)
+        out[n] = alphabet[Rand(alphabet_len)];
+    out[len] = 0;
+}
+
+static int FuzzStristr(int iterations)
+{
+    // Small alphabet so matches are frequent. Includes characters which only differ by their 0x20 bit from a letter.
+    static const char alphabet[] = "aAbBzZ@`[{^~\x7f_ \xc0\xe0";
+    int errors = 0;
+    for (int it = 0; it < iterations && errors < 10; it++)
+    {
+        const int haystack_len = Rand(it & 1 ? 80 : 40);
+        const int needle_len = 1 + Rand((it & 3) == 0 ? 20 : 4);
+        char* haystack = (char*)malloc((size_t)haystack_len + 1); // Exact size (+ zero terminator for the reference)
+        char needle[32], needle_upper[32];
+        RandomString(haystack, haystack_len, alphabet);
+        RandomString(needle, needle_len, alphabet);
+        if (haystack_len > needle_len && Rand(2))
+            memcpy(haystack + Rand(haystack_len - needle_len + 1), needle, (size_t)needle_len); // Ensure some hits
+        for (int n = 0; n <= needle_len; n++)
+            needle_upper[n] = (char)ImToUpper(needle[n]);
+
+        const char* expected = ImStristr(haystack, haystack + haystack_len, needle, needle + needle_len);
+        const char* result = ImStristrUpper(haystack, haystack + haystack_len, needle_upper, needle_upper + needle_len);
+        const char* result_zero_terminated = ImStristrUpper(haystack, NULL, needle_upper, needle_upper + needle_len);
+        if (result != expected || result_zero_terminated != expected)
+        {
+            printf("ImStristrUpper() mismatch: haystack \"%s\" (%d), needle \"%s\" (%d): expected offset %d, got %d/%d\n", haystack, haystack_len, needle, needle_len,
+                expected ? (int)(expected - haystack) : -1, result ? (int)(result - haystack) : -1, result_zero_terminated ? (int)(result_zero_terminated - haystack) : -1);
+            errors++;
+        }
+        free(haystack);
+    }
+    return errors;
+}
+
+static int FuzzPassFilter(int iterations, int threads_count)
+{
+    static const char alphabet_text[] = "aAbBcC@`[{ \xc0\xe0";
+    static const char* terms[] = { "a", "B", "ab", "-a", "-bc", "-", "@", "`", " c ", "[a", "{A", "\xc0", "abcab", "", "-@b" };
+    const int texts_count = 64;
+    std::vector<char*> texts(texts_count);
+    std::vector<const char*> texts_end(texts_count);
+    bool out_passed[texts_count];
+    int errors = 0;
+    for (int it = 0; it < iterations && errors < 10; it++)
+    {
+        // Random filter made of 1-4 terms, e.g. "ab,-a, c "
+        char filter_text[256] = "";
+        for (int n = 1 + Rand(4); n > 0; n--)
+        {
+            strcat(filter_text, terms[Rand(IM_ARRAYSIZE(terms))]);
+            if (n > 1)
+                strcat(filter_text, ",");
+        }
+        ImGuiTextFilter filter(filter_text);
+
+        for (int n = 0; n < texts_count; n++)
+        {
+            const int len = Rand(48);
+            texts[n] = (char*)malloc((size_t)len + 1);
+            RandomString(texts[n], len, alphabet_text);
+            texts_end[n] = texts[n] + len;
+        }
+
+        // Zero-terminated and explicit ends, split across threads every other iteration
+        const bool use_texts_end = (it & 1) != 0;
+        int passed_count = 0;
+        if ((it & 2) && threads_count > 1)
+        {
+            std::vector<std::thread> threads;
+            std::vector<int> thread_passed_count(threads_count);
+            for (int t = 0; t < threads_count; t++)
+            {
+                const int n_begin = texts_count * t / threads_count, n_end = texts_count * (t + 1) / threads_count;
+                threads.emplace_back([&, t, n_begin, n_end]() { thread_passed_count[t] = filter.PassFilterBatch(texts.data() + n_begin, use_texts_end ? texts_end.data() + n_begin : NULL, n_end - n_begin, out_passed + n_begin); });
+            }
+            for (int t = 0; t < threads_count; t++)
+            {
+                threads[t].join();
+                passed_count += thread_passed_count[t];
+            }
+        }
+        else
+        {
+            passed_count = filter.PassFilterBatch(texts.data(), use_texts_end ? texts_end.data() : NULL, texts_count, out_passed);
+        }
+
+        int expected_passed_count = 0;
+        for (int n = 0; n < texts_count; n++)
+        {
+            const bool expected = PassFilterReference(filter, texts[n], texts_end[n]);
+            expected_passed_count += expected ? 1 : 0;
+            if (out_passed[n] != expected || filter.PassFilter(texts[n]) != expected || filter.PassFilter(texts[n], texts_end[n]) != expected)
+            {
+                printf("PassFilter() mismatch: filter \"%s\", text \"%s\": expected %d\n", filter_text, texts[n], expected);
+                errors++;
+            }
+        }
+        if (passed_count != expected_passed_count)
+        {
+            printf("PassFilterBatch() returned %d, expected %d (filter \"%s\")\n", passed_count, expected_passed_count, filter_text);
+            errors++;
+        }
+        for (int n = 0; n < texts_count; n++)
+            free(texts[n]);
+    }
+    return errors;
+}
+
+static int Benchmark(int lines_count, int threads_count)
+{
+    // Generate a log-like corpus, e.g. "[004213] texture_manager: loaded 'atlas_17.png' in 3.2 ms"
+    static const char* modules[] = { "renderer", "texture_manager", "audio", "network", "input", "scene_loader", "physics", "ui" };
+    static const char* levels[] = { "info", "debug", "warning", "error" };
+    static const char* words[] = { "loaded", "created", "destroyed", "updated", "resized", "connection", "timeout", "frame", "buffer", "vulkan", "shader", "atlas", "request", "queued" };
+    ImGuiTextBuffer corpus;
+    ImVector<int> offsets;
+    offsets.reserve(lines_count + 1);
+    for (int n = 0; n < lines_count; n++)
+    {
+        offsets.push_back(corpus.size());
+        corpus.appendf("[%06d] %s %s:", n, levels[Rand(IM_ARRAYSIZE(levels))], modules[Rand(IM_ARRAYSIZE(modules))]);
+        for (int w = 2 + Rand(8); w > 0; w--)
+            corpus.appendf(" %s", words[Rand(IM_ARRAYSIZE(words))]);
+        corpus.appendf(" in %d.%d ms\n", Rand(100), Rand(10));
+    }
+    offsets.push_back(corpus.size());
+    std::vector<const char*> texts(lines_count), texts_end(lines_count);
+    for (int n = 0; n < lines_count; n++)
+    {
+        texts[n] = corpus.begin() + offsets[n];
+        texts_end[n] = corpus.begin() + offsets[n + 1] - 1; // Exclude '\n'
+    }
+    std::vector<bool> expected(lines_count);
+    bool* out_passed = (bool*)malloc((size_t)lines_count);
+
+    printf("Benchmark: %d lines, %.1f MB, %d threads, SSE %s\n", lines_count, corpus.size() / (1024.0 * 1024.0), threads_count,
+#ifdef IMGUI_ENABLE_SSE
+        "enabled");
+#else
+        "disabled");
+#endif
+    printf("  %-32s %10s %12s %12s %12s\n", "filter", "passed", "reference", "PassFilter", "Batch");
+
+    static const char* filters[] = { "e", "error", "ERROR,warning", "vulkan,-debug", "texture,shader,-atlas,-timeout", "xyz" };
+    int errors = 0;
+    for (const char* filter_text : filters)
+    {
+        ImGuiTextFilter filter(filter_text);
+
+        double t0 = GetTimeMs();
+        int expected_passed_count = 0;
+        for (int n = 0; n < lines_count; n++)
+            if ((expected[n] = PassFilterReference(filter, texts[n], texts_end[n])))
+                expected_passed_count++;
+
+        double t1 = GetTimeMs();
+        int passed_count = 0;
+        for (int n = 0; n < lines_count; n++)
+            if (filter.PassFilter(texts[n], texts_end[n]))
+                passed_count++;
+
+        double t2 = GetTimeMs();
+        std::vector<std::thread> threads;
+        std::vector<int> thread_passed_count(threads_count);
+        for (int t = 0; t < threads_count; t++)
+        {
+            const int n_begin = (int)((ImS64)lines_count * t / threads_count), n_end = (int)((ImS64)lines_count * (t + 1) / threads_count);
+            threads.emplace_back([&, t, n_begin, n_end]() { thread_passed_count[t] = filter.PassFilterBatch(texts.data() + n_begin, texts_end.data() + n_begin, n_end - n_begin, out_passed + n_begin); });
+        }
+        int batch_passed_count = 0;
+        for (int t = 0; t < threads_count; t++)
+        {
+            threads[t].join();
+            batch_passed_count += thread_passed_count[t];
+        }
+        double t3 = GetTimeMs();
+
+        for (int n = 0; n < lines_count; n++)
+            if (out_passed[n] != expected[n])
+                errors++;
+        if (passed_count != expected_passed_count || batch_passed_count != expected_passed_count)
+            errors++;
+        printf("  %-32s %10d %9.1f ms %9.1f ms %9.1f ms\n", filter_text, expected_passed_count, t1 - t0, t2 - t1, t3 - t2);
+    }
+    free(out_passed);
+    return errors;
+}
+
+int main(int argc, char** argv)
+{
+    int fuzz_iterations = 200000;
+    int lines_count = 1000000;
+    int threads_count = ImMax((int)std::thread::hardware_concurrency(), 1);
+    for (int n = 1; n + 1 < argc; n += 2)
+    {
+        if (strcmp(argv[n], "-fuzz") == 0)         { fuzz_iterations = atoi(argv[n + 1]); }
+        else if (strcmp(argv[n], "-lines") == 0)   { lines_count = atoi(argv[n + 1]); }
+        else if (strcmp(argv[n], "-threads") == 0) { threads_count = ImMax(atoi(argv[n + 1]), 1); }
+        else { printf("Syntax: %s [-fuzz <iterations>] [-lines <count>] [-threads <count>]\n", argv[0]); return 1; }
+    }
+
+    int errors = 0;
+    errors += FuzzStristr(fuzz_iterations);
+    errors += FuzzPassFilter(fuzz_iterations / 20, threads_count);
+    printf("Fuzz: %d iterations, %d errors\n", fuzz_iterations, errors);
+    if (lines_count > 0)
+    {
+        const int benchmark_errors = Benchmark(lines_count, threads_count);
+        printf("Benchmark: %d mismatches\n", benchmark_errors);
+        errors += benchmark_errors;
+    }
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,382 @@
+// dear imgui: Chrome Trace Event export of profiler zones
+
+// Changelog:
+// - v0.10: Initial version.
+
+// See imgui_traceexport.h for usage.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_internal.h"     // ImGuiProfiler, AddContextHook(), ImFormatString()
+#include "imgui_traceexport.h"
+
+// Clang warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wold-style-cast"     // warning: use of old-style cast
+#pragma clang diagnostic ignored "-Wsign-conversion"    // warning: implicit conversion changes signedness
+#endif
+
+//-------------------------------------------------------------------------
+// [SECTION] Output buffer (writer thread)
+//-------------------------------------------------------------------------
+// The writer thread must not allocate through IM_ALLOC() (which updates context counters non-atomically):
+// events are formatted into a fixed buffer flushed to the file with fwrite().
+//-------------------------------------------------------------------------
+
+struct ImGuiTraceExporter_Output
+{
+    FILE*   File;
+    ImU64   BytesWritten;
+    int     Len;
+    char    Buf[64 * 1024];
+
+    ImGuiTraceExporter_Output(FILE* f) { File = f; BytesWritten = 0; Len = 0; }
+    void    Flush()                     { if (Len > 0) { fwrite(Buf, 1, (size_t)Len, File); BytesWritten += (ImU64)Len; Len = 0; } }
+    void    Reserve(int size)           { if (Len + size > (int)sizeof(Buf)) Flush(); }
+    void    Append(const char* fmt, ...) IM_FMTARGS(2)
+    {
+        Reserve(256);
+        va_list args;
+        va_start(args, fmt);
+        Len += ImFormatStringV(Buf + Len, sizeof(Buf) - (size_t)Len, fmt, args);
+        va_end(args);
+    }
+    void    AppendRaw(const char* s, int len)
+    {
+        Reserve(len);
+        memcpy(Buf + Len, s, (size_t)len);
+        Len += len;
+    }
+    void    AppendTime(ImS64 ns)          // Microseconds with 3 decimals, without going through vsnprintf() for the most common field
+    {
+        Reserve(32);
+        if (ns < 0)
+        {
+            Buf[Len++] = '-';
+            ns = -ns;
+        }
+        char tmp[24];
+        int tmp_len = 0;
+        for (ImU64 us = (ImU64)ns / 1000; us != 0 || tmp_len == 0; us /= 10)
+            tmp[tmp_len++] = (char)('0' + us % 10);
+        while (tmp_len > 0)
+            Buf[Len++] = tmp[--tmp_len];
+        const int frac = (int)((ImU64)ns % 1000);
+        Buf[Len++] = '.';
+        Buf[Len++] = (char)('0' + frac / 100);
+        Buf[Len++] = (char)('0' + frac / 10 % 10);
+        Buf[Len++] = (char)('0' + frac % 10);
+    }
+    void    AppendEscaped(const char* s)
+    {
+        for (; *s; s++)
+        {
+            Reserve(8);
+            const unsigned char c = (unsigned char)*s;
+            if (c == '"' || c == '\\')
+            {
+                Buf[Len++] = '\\';
+                Buf[Len++] = (char)c;
+            }
+            else if (c < 0x20)
+            {
+                Len += ImFormatString(Buf + Len, 8, "\\u%04x", c);
+            }
+            else
+            {
+                Buf[Len++] = (char)c;
+            }
+        }
+    }
+};
+
+#define IMGUI_TRACEEXPORT_APPEND_LITERAL(_OUT, _STR)   (_OUT)->AppendRaw(_STR, (int)sizeof(_STR) - 1)
+
+static const char* ImGuiTraceExporter_GetCategoryName(char category)
+{
+    switch (category)
+    {
+    case 'f': return "frame";
+    case 'w': return "window";
+    default: return "zone";
+    }
+}
+
+static void ImGuiTraceExporter_WriteFrame(ImGuiTraceExporter_Output* out, const ImGuiTraceFrame* frame, ImU64 base_time)
+{
+    for (const ImGuiTraceEvent& event : frame->Events)
+    {
+        if (event.Phase == 'E')
+        {
+            IMGUI_TRACEEXPORT_APPEND_LITERAL(out, ",\n{\"ph\":\"E\",\"pid\":1,\"tid\":1,\"ts\":");
+            out->AppendTime((ImS64)(event.Time - base_time));
+            IMGUI_TRACEEXPORT_APPEND_LITERAL(out, "}");
+            continue;
+        }
+        IMGUI_TRACEEXPORT_APPEND_LITERAL(out, ",\n{\"name\":\"");
+        out->AppendEscaped(event.Name ? event.Name : frame->Names.Data + event.NameOffset);
+        out->Append("\",\"cat\":\"%s\",\"ph\":\"B\",\"pid\":1,\"tid\":1,\"ts\":", ImGuiTraceExporter_GetCategoryName(event.Category));
+        out->AppendTime((ImS64)(event.Time - base_time));
+        if (event.Category == 'f')
+            out->Append(",\"args\":{\"frame\":%d}", frame->FrameCount);
+        IMGUI_TRACEEXPORT_APPEND_LITERAL(out, "}");
+    }
+    if (frame->RenderTime != 0)
+        out->Append(",\n{\"name\":\"DrawData\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"tid\":1,\"args\":{\"vertices\":%d,\"indices\":%d,\"draw_lists\":%d}}",
+            (double)(ImS64)(frame->RenderTime - base_time) / 1000.0, frame->RenderVtxCount, frame->RenderIdxCount, frame->RenderDrawListsCount);
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] ImGuiTraceExporter
+//-------------------------------------------------------------------------
+
+ImGuiTraceExporter::ImGuiTraceExporter()
+{
+    MaxPendingFrames = 64;
+    FramesWritten = 0;
+    FramesDropped = 0;
+    BytesWritten = 0;
+    Ctx = NULL;
+    memset(HookIds, 0, sizeof(HookIds));
+    BackupProfilerEnabled = false;
+    File = NULL;
+    BaseTime = 0;
+    LastExportedFrame = -1;
+    RenderStats.FrameCount = -1;
+    RenderStats.RenderTime = 0;
+    RenderStats.RenderVtxCount = RenderStats.RenderIdxCount = RenderStats.RenderDrawListsCount = 0;
+    StopRequested = false;
+}
+
+ImGuiTraceExporter::~ImGuiTraceExporter()
+{
+    Stop();
+}
+
+bool ImGuiTraceExporter::Start(ImGuiContext* ctx, const char* filename)
+{
+    IM_ASSERT(Ctx == NULL && "Already recording!");
+    IM_ASSERT(ctx != NULL && ctx == GImGui && MaxPendingFrames > 0);
+    File = fopen(filename, "wb");
+    if (File == NULL)
+        return false;
+    fputs("[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Dear ImGui\"}},\n"
+          "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"UI\"}}", File);
+
+    Ctx = ctx;
+    BackupProfilerEnabled = ctx->Profiler.Enabled;
+    ctx->Profiler.Enabled = true;
+    BaseTime = 0;
+    LastExportedFrame = ctx->Profiler.FramesCount > 0 ? ctx->Profiler.GetFrame(0)->FrameCount : -1; // Only export frames completed from now on
+    RenderStats.FrameCount = -1;
+    FramesWritten = 0;
+    FramesDropped = 0;
+    BytesWritten = 0;
+
+    // Packets pool. The writer thread moves indices between the two lists without ever growing them.
+    FreeFrames.reserve(MaxPendingFrames);
+    PendingFrames.reserve(MaxPendingFrames);
+    for (int n = 0; n < MaxPendingFrames; n++)
+    {
+        Frames.push_back(IM_NEW(ImGuiTraceFrame)());
+        FreeFrames.push_back(n);
+    }
+
+    ImGuiContextHook hook;
+    hook.Callback = HookCallback;
+    hook.UserData = this;
+    hook.Type = ImGuiContextHookType_NewFramePre;
+    HookIds[0] = ImGui::AddContextHook(ctx, &hook);
+    hook.Type = ImGuiContextHookType_RenderPost;
+    HookIds[1] = ImGui::AddContextHook(ctx, &hook);
+    hook.Type = ImGuiContextHookType_Shutdown;
+    HookIds[2] = ImGui::AddContextHook(ctx, &hook);
+
+    StopRequested = false;
+    Writer = std::thread([this]() { WriterThread(); });
+    return true;
+}
+
+void ImGuiTraceExporter::Stop()
+{
+    if (Ctx == NULL)
+        return;
+    for (ImGuiID hook_id : HookIds)
+        ImGui::RemoveContextHook(Ctx, hook_id);
+    memset(HookIds, 0, sizeof(HookIds));
+
+    // Write queued frames and wait for the writer thread to exit
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        StopRequested = true;
+    }
+    PendingCond.notify_one();
+    Writer.join();
+    fputs("\n]\n", File);
+    fclose(File);
+    File = NULL;
+
+    Ctx->Profiler.Enabled = BackupProfilerEnabled;
+    for (ImGuiTraceFrame* frame : Frames)
+        IM_DELETE(frame);
+    Frames.clear();
+    FreeFrames.clear();
+    PendingFrames.clear();
+    Ctx = NULL;
+}
+
+void ImGuiTraceExporter::HookCallback(ImGuiContext* ctx, ImGuiContextHook* hook)
+{
+    ImGuiTraceExporter* exporter = (ImGuiTraceExporter*)hook->UserData;
+    IM_ASSERT(exporter->Ctx == ctx);
+    switch (hook->Type)
+    {
+    case ImGuiContextHookType_NewFramePre:
+        exporter->ExportFrame();
+        break;
+    case ImGuiContextHookType_RenderPost:
+        if (ImDrawData* draw_data = ImGui::GetDrawData())
+        {
+            ImGuiTraceFrame& stats = exporter->RenderStats;
+            stats.FrameCount = ctx->FrameCount;
+            stats.RenderTime = ImGui::ProfilerGetTime();
+            stats.RenderVtxCount = draw_data->TotalVtxCount;
+            stats.RenderIdxCount = draw_data->TotalIdxCount;
+            stats.RenderDrawListsCount = draw_data->CmdListsCount;
+        }
+        break;
+    case ImGuiContextHookType_Shutdown:
+        exporter->Stop();
+        break;
+    default:
+        break;
+    }
+}
+
+// Called from the NewFramePre hook: the profiler completed the previous frame in ProfilerNewFrame() just before.
+void ImGuiTraceExporter::ExportFrame()
+{
+    ImGuiContext& g = *Ctx;
+    ImGuiProfiler& prof = g.Profiler;
+    if (prof.FramesCount == 0)
+        return;
+    const ImGuiProfilerFrame* src = prof.GetFrame(0);
+    if (src->FrameCount == LastExportedFrame) // Profiler paused
+        return;
+    LastExportedFrame = src->FrameCount;
+
+    int frame_n;
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        if (FreeFrames.Size == 0)
+        {
+            FramesDropped++;
+            return;
+        }
+        frame_n = FreeFrames.back();
+        FreeFrames.pop_back();
+    }
+    if (BaseTime == 0)
+        BaseTime = src->StartTime;
+
+    ImGuiTraceFrame* dst = Frames[frame_n];
+    dst->FrameCount = src->FrameCount;
+    dst->Events.resize(0);
+    dst->Names.resize(0);
+    dst->Events.reserve(src->Zones.Size * 2 + 2);
+    const bool has_render_stats = (RenderStats.FrameCount == src->FrameCount);
+    dst->RenderTime = has_render_stats ? RenderStats.RenderTime : 0;
+    dst->RenderVtxCount = RenderStats.RenderVtxCount;
+    dst->RenderIdxCount = RenderStats.RenderIdxCount;
+    dst->RenderDrawListsCount = RenderStats.RenderDrawListsCount;
+
+    // Zones are sorted by start time with their depth: turn them into properly nested begin/end pairs.
+    ImGuiTraceEvent event;
+    event.NameOffset = -1;
+    event.Time = src->StartTime;
+    event.Name = "Frame";
+    event.Phase = 'B';
+    event.Category = 'f';
+    dst->Events.push_back(event);
+    ImVector<int>& stack = prof.TempOrder; // Scratch buffer, not in use during NewFrame()
+    stack.resize(0);
+    for (int zone_n = 0; zone_n < src->Zones.Size; zone_n++)
+    {
+        const ImGuiProfilerZone& zone = src->Zones[zone_n];
+        for (; stack.Size > zone.Depth; stack.pop_back())
+        {
+            event.Time = src->Zones[stack.back()].EndTime;
+            event.Name = NULL;
+            event.Phase = 'E';
+            dst->Events.push_back(event);
+        }
+        event.Time = zone.StartTime;
+        event.Name = zone.Name;
+        event.Phase = 'B';
+        event.Category = 'z';
+        if (strcmp(zone.Name, "Window") == 0)
+        {
+            event.Category = 'w';
+            if (ImGuiWindow* window = ImGui::FindWindowByID(zone.WindowID))
+            {
+                // Copy window names: the window may be gone by the time the writer thread gets to it
+                event.Name = NULL;
+                event.NameOffset = dst->Names.Size;
+                dst->Names.resize(dst->Names.Size + (int)strlen(window->Name) + 1);
+                strcpy(dst->Names.Data + event.NameOffset, window->Name);
+            }
+        }
+        dst->Events.push_back(event);
+        stack.push_back(zone_n);
+    }
+    for (; stack.Size > 0; stack.pop_back())
+    {
+        event.Time = src->Zones[stack.back()].EndTime;
+        event.Name = NULL;
+        event.Phase = 'E';
+        dst->Events.push_back(event);
+    }
+    event.Time = src->EndTime;
+    event.Phase = 'E';
+    dst->Events.push_back(event);
+
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        PendingFrames.push_back(frame_n);
+    }
+    PendingCond.notify_one();
+}
+
+void ImGuiTraceExporter::WriterThread()
+{
+    ImGuiTraceExporter_Output* out = new ImGuiTraceExporter_Output(File); // Not IM_NEW(): see above
+    for (;;)
+    {
+        int frame_n;
+        {
+            std::unique_lock<std::mutex> lock(Mutex);
+            PendingCond.wait(lock, [this]() { return PendingFrames.Size > 0 || StopRequested; });
+            if (PendingFrames.Size == 0)
+                break; // Stop requested, queue drained
+            frame_n = PendingFrames[0];
+            PendingFrames.erase(PendingFrames.Data);
+        }
+        ImGuiTraceExporter_WriteFrame(out, Frames[frame_n], BaseTime);
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            FreeFrames.push_back(frame_n);
+        }
+        FramesWritten++;
+        BytesWritten = out->BytesWritten + (ImU64)out->Len;
+    }
+    out->Flush();
+    BytesWritten = out->BytesWritten;
+    delete out;
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+#endif // #ifndef IMGUI_DISABLE
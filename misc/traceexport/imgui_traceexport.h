@@ -0,0 +1,101 @@
+// dear imgui: Chrome Trace Event export of profiler zones
+// (headers)
+
+// Changelog:
+// - v0.10: Initial version.
+
+// ImGuiTraceExporter streams the zones recorded by the built-in profiler (see ShowProfilerWindow() and
+// IMGUI_PROFILE_SCOPE() in imgui_internal.h) to a JSON file in the Chrome Trace Event format, to capture many frames
+// (e.g. from a headless benchmark) and analyze them offline in chrome://tracing, https://ui.perfetto.dev or a script.
+// - Start() installs context hooks and makes the profiler record every frame (g.Profiler.Enabled).
+// - On NewFrame(), the hook copies the zones of the frame which just completed into a packet and queues it. Window
+//   names are copied, so windows may be destroyed before the packet is written. On Render(), the hook records draw
+//   data statistics for the frame (emitted as a counter).
+// - A background thread formats queued packets and writes them to the file. The UI thread never formats nor waits for IO.
+// - Memory is bounded: packets come from a pool of MaxPendingFrames packets, allocated by Start() and reused (no heap
+//   allocation in steady state once packets reached their size). If the writer falls behind and no packet is free,
+//   the frame is dropped and counted in FramesDropped.
+// - Events: a "Frame" begin/end pair per frame, and a begin/end pair per zone. Window zones are named after their window.
+//   Timestamps are in microseconds since the first exported frame.
+// - The file uses the JSON Array Format: a trace cut short (e.g. crash) can still be loaded.
+//
+// Usage:
+//   static ImGuiTraceExporter exporter;
+//   exporter.Start(ImGui::GetCurrentContext(), "trace.json");
+//   [...] run frames
+//   exporter.Stop();                                           // Also called if the context is destroyed
+// Frames are exported one frame late (when the next NewFrame() completes them): Stop() drops the frame in progress.
+// Pausing the profiler window stops recording, and therefore exporting.
+// Call Start()/Stop() from the thread running the context, outside of NewFrame()/Render().
+
+#pragma once
+#include "imgui.h"      // IMGUI_API, ImVector
+#ifndef IMGUI_DISABLE
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdio.h>      // FILE
+#include <thread>
+
+struct ImGuiContext;
+struct ImGuiContextHook;
+
+struct ImGuiTraceEvent
+{
+    ImU64                   Time;           // Nanoseconds, see ImGui::ProfilerGetTime()
+    const char*             Name;           // Persistent string, or NULL: name is at NameOffset in ImGuiTraceFrame::Names[]
+    int                     NameOffset;
+    char                    Phase;          // 'B' or 'E'
+    char                    Category;       // 'f': frame, 'w': window, 'z': zone
+};
+
+// A completed frame, queued for writing
+struct ImGuiTraceFrame
+{
+    int                     FrameCount;
+    ImVector<ImGuiTraceEvent> Events;
+    ImVector<char>          Names;          // Zero-terminated names of windows
+    ImU64                   RenderTime;     // End of Render(), 0 if not recorded
+    int                     RenderVtxCount;
+    int                     RenderIdxCount;
+    int                     RenderDrawListsCount;
+};
+
+struct ImGuiTraceExporter
+{
+    int                     MaxPendingFrames;   // = 64     // Size of the packet pool, read by Start()
+
+    // Statistics (readable from any thread)
+    std::atomic<int>        FramesWritten;
+    std::atomic<int>        FramesDropped;      // Writer thread too slow: no free packet
+    std::atomic<ImU64>      BytesWritten;
+
+    IMGUI_API ImGuiTraceExporter();
+    IMGUI_API ~ImGuiTraceExporter();
+
+    IMGUI_API bool          Start(ImGuiContext* ctx, const char* filename);   // Return false if the file can't be opened
+    IMGUI_API void          Stop();                                         // Flush queued frames, close the file
+    bool                    IsRecording() const { return Ctx != NULL; }
+
+    // [Internal]
+    ImGuiContext*           Ctx;
+    ImGuiID                 HookIds[3];
+    bool                    BackupProfilerEnabled;
+    FILE*                   File;
+    ImU64                   BaseTime;           // Timestamps are relative to the first exported frame
+    int                     LastExportedFrame;
+    ImGuiTraceFrame         RenderStats;        // Render statistics of the frame in progress (no events)
+    ImVector<ImGuiTraceFrame*> Frames;          // Pool, owned
+    ImVector<int>           FreeFrames;         // Indices in Frames[]. Capacity reserved by Start(): never reallocated.
+    ImVector<int>           PendingFrames;      // "
+    std::mutex              Mutex;              // Protects FreeFrames, PendingFrames, StopRequested
+    std::condition_variable PendingCond;
+    bool                    StopRequested;
+    std::thread             Writer;
+
+    IMGUI_API void          ExportFrame();      // Called on NewFrame(): queue the frame the profiler just completed
+    IMGUI_API void          WriterThread();
+    IMGUI_API static void   HookCallback(ImGuiContext* ctx, ImGuiContextHook* hook);
+};
+
+#endif // #ifndef IMGUI_DISABLE